@@ -0,0 +1,32 @@
+// Host definitions for the Arduino, ESP-IDF and logging functions the display
+// code calls. Log output goes to stdout.
+#include "Arduino.h"
+#include "esp_timer.h"
+#include "logging.h"
+#include <time.h>
+
+int64_t esp_timer_get_time() {
+    static timespec start = {};
+    timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    if (start.tv_sec == 0 && start.tv_nsec == 0) {
+        start = now;
+    }
+    return (int64_t)(now.tv_sec - start.tv_sec) * 1000000 + (now.tv_nsec - start.tv_nsec) / 1000;
+}
+
+unsigned long millis() {
+    return (unsigned long)(esp_timer_get_time() / 1000);
+}
+
+void logAndPublish(const char* messageBuffer) {
+    printf("%s\n", messageBuffer);
+}
+
+void errorPublish(const char* messageBuffer) {
+    printf("Error: %s\n", messageBuffer);
+}
+
+void logStackHighWaterMark(const char* taskName) {
+    printf("Stack HWM: %s n/a on host\n", taskName);
+}
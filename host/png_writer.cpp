@@ -0,0 +1,100 @@
+#include "png_writer.h"
+#include <cstdio>
+#include <vector>
+
+static uint32_t crcTable[256];
+
+static void initCrcTable() {
+    for (uint32_t n = 0; n < 256; n++) {
+        uint32_t c = n;
+        for (int k = 0; k < 8; k++) {
+            c = (c & 1) ? 0xEDB88320u ^ (c >> 1) : c >> 1;
+        }
+        crcTable[n] = c;
+    }
+}
+
+static uint32_t crc32(const uint8_t* data, size_t len, uint32_t crc = 0xFFFFFFFFu) {
+    for (size_t i = 0; i < len; i++) {
+        crc = crcTable[(crc ^ data[i]) & 0xFF] ^ (crc >> 8);
+    }
+    return crc;
+}
+
+static void putBe32(std::vector<uint8_t>& out, uint32_t v) {
+    out.push_back(v >> 24);
+    out.push_back(v >> 16);
+    out.push_back(v >> 8);
+    out.push_back(v);
+}
+
+// Appends length, type, data and CRC (over type and data)
+static void writeChunk(FILE* f, const char* type, const std::vector<uint8_t>& data) {
+    std::vector<uint8_t> chunk;
+    putBe32(chunk, data.size());
+    chunk.insert(chunk.end(), type, type + 4);
+    chunk.insert(chunk.end(), data.begin(), data.end());
+    putBe32(chunk, crc32(chunk.data() + 4, chunk.size() - 4) ^ 0xFFFFFFFFu);
+    fwrite(chunk.data(), 1, chunk.size(), f);
+}
+
+bool writePngRgb565(const char* path, const uint16_t* pixels, int width, int height) {
+    if (crcTable[1] == 0) {
+        initCrcTable();
+    }
+    FILE* f = fopen(path, "wb");
+    if (!f) {
+        return false;
+    }
+    static const uint8_t signature[8] = {0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n'};
+    fwrite(signature, 1, sizeof(signature), f);
+
+    std::vector<uint8_t> ihdr;
+    putBe32(ihdr, width);
+    putBe32(ihdr, height);
+    ihdr.insert(ihdr.end(), {8, 2, 0, 0, 0}); // 8-bit RGB, deflate, no filter, no interlace
+    writeChunk(f, "IHDR", ihdr);
+
+    // Scanlines: filter byte 0 then RGB888 expanded from RGB565
+    std::vector<uint8_t> raw;
+    raw.reserve((size_t)height * (width * 3 + 1));
+    for (int y = 0; y < height; y++) {
+        raw.push_back(0);
+        for (int x = 0; x < width; x++) {
+            uint16_t p = pixels[y * width + x];
+            uint8_t r = (p >> 11) & 0x1F, g = (p >> 5) & 0x3F, b = p & 0x1F;
+            raw.push_back((r << 3) | (r >> 2));
+            raw.push_back((g << 2) | (g >> 4));
+            raw.push_back((b << 3) | (b >> 2));
+        }
+    }
+
+    // zlib stream of stored deflate blocks (at most 65535 bytes each)
+    std::vector<uint8_t> idat = {0x78, 0x01};
+    uint32_t adlerA = 1, adlerB = 0;
+    for (size_t pos = 0; pos < raw.size() || raw.empty();) {
+        size_t len = raw.size() - pos < 65535 ? raw.size() - pos : 65535;
+        bool last = pos + len == raw.size();
+        idat.push_back(last ? 1 : 0);
+        idat.push_back(len & 0xFF);
+        idat.push_back(len >> 8);
+        idat.push_back(~len & 0xFF);
+        idat.push_back((~len >> 8) & 0xFF);
+        idat.insert(idat.end(), raw.begin() + pos, raw.begin() + pos + len);
+        for (size_t i = pos; i < pos + len; i++) {
+            adlerA = (adlerA + raw[i]) % 65521;
+            adlerB = (adlerB + adlerA) % 65521;
+        }
+        pos += len;
+        if (last) {
+            break;
+        }
+    }
+    putBe32(idat, (adlerB << 16) | adlerA);
+    writeChunk(f, "IDAT", idat);
+    writeChunk(f, "IEND", {});
+
+    bool ok = ferror(f) == 0;
+    fclose(f);
+    return ok;
+}
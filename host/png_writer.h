@@ -0,0 +1,11 @@
+#ifndef PNG_WRITER_H
+#define PNG_WRITER_H
+
+#include <stdint.h>
+
+// Writes an RGB565 framebuffer as a 24-bit PNG. Uses stored (uncompressed)
+// deflate blocks so it needs no zlib; files are large but byte-exact.
+// Returns false if the file can't be written.
+bool writePngRgb565(const char* path, const uint16_t* pixels, int width, int height);
+
+#endif // PNG_WRITER_H
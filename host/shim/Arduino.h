@@ -0,0 +1,31 @@
+#ifndef HOST_ARDUINO_H
+#define HOST_ARDUINO_H
+
+// Just enough of the Arduino core for the display code to build on Linux
+// (see host/README.md). Everything runs on one thread, so the FreeRTOS
+// primitives in freertos/ are no-ops.
+#include "freertos/FreeRTOS.h"
+#include "freertos/queue.h"
+#include "freertos/semphr.h"
+#include "freertos/task.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <cstdio>
+#include <cstring>
+
+using std::max;
+using std::min;
+
+unsigned long millis();
+
+// esp_heap_caps.h: every allocation comes from the one host heap
+#define MALLOC_CAP_SPIRAM (1 << 10)
+#define MALLOC_CAP_8BIT (1 << 2)
+#define MALLOC_CAP_INTERNAL (1 << 11)
+inline void* heap_caps_malloc(size_t size, uint32_t caps) {
+    return malloc(size);
+}
+
+#endif // HOST_ARDUINO_H
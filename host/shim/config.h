@@ -0,0 +1,6 @@
+#ifndef HOST_CONFIG_H
+#define HOST_CONFIG_H
+// Host builds use the template's placeholder credentials; only the numeric
+// settings (battery capacity, price, firmware version) reach the UI.
+#include "config.hxx"
+#endif // HOST_CONFIG_H
@@ -0,0 +1,4 @@
+#ifndef HOST_ESP_SYSTEM_H
+#define HOST_ESP_SYSTEM_H
+// Included by types.h; nothing from it is used by the display code.
+#endif // HOST_ESP_SYSTEM_H
@@ -0,0 +1,4 @@
+#ifndef HOST_ESP_TASK_WDT_H
+#define HOST_ESP_TASK_WDT_H
+// Included by types.h; the host build has no task watchdog.
+#endif // HOST_ESP_TASK_WDT_H
@@ -0,0 +1,9 @@
+#ifndef HOST_ESP_TIMER_H
+#define HOST_ESP_TIMER_H
+
+#include <stdint.h>
+
+// Microseconds since the host process started (CLOCK_MONOTONIC)
+int64_t esp_timer_get_time();
+
+#endif // HOST_ESP_TIMER_H
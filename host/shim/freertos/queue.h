@@ -0,0 +1,9 @@
+#ifndef HOST_FREERTOS_QUEUE_H
+#define HOST_FREERTOS_QUEUE_H
+
+#include "FreeRTOS.h"
+
+// No queue ever has data on the host; status messages are set directly.
+inline BaseType_t xQueueReceive(QueueHandle_t, void*, TickType_t) { return pdFALSE; }
+
+#endif // HOST_FREERTOS_QUEUE_H
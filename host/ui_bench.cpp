@@ -0,0 +1,241 @@
+// Headless render benchmark for the dashboard UI. Builds ui_Screen1, the
+// bindings and the theme against an in-memory RGB565 framebuffer, replays a
+// script of data changes through the same update functions loop() calls, and
+// reports per-step render time, pixels redrawn and LVGL heap high-water mark.
+// Each step's frame is written as a PNG so layout regressions can be diffed.
+// Then times the reading trend history (RingHistory vs the old array shift)
+// and MQTT topic dispatch (perfect hash vs the old strcmp scan).
+//
+//   pio run -e native && .pio/build/native/program [frame dir]
+#include "ScreenUpdates.h"
+#include "UIBindings.h"
+#include "esp_timer.h"
+#include "png_writer.h"
+#include "RingHistory.h"
+#include "TopicTable.h"
+#include "types.h"
+#include <cstdio>
+#include <sys/stat.h>
+
+// Globals main.cpp provides on the device
+Weather weather = {0.0, 0.0, 0.0, 0.0, false, 0, "", "", "--:--:--"};
+UV uv = {0, 0, "--:--:--"};
+Solar solar = {0, 0, 0, 0.0, 0.0, 0.0, 0.0, 0.0, "--:--:--", 100, 0, false, 0.0, 0.0};
+AirQuality airQuality = {0.0, 0.0, 0.0, 0, 0, "--:--:--"};
+InsideAirQuality insideAirQuality = {};
+const ReadingInfo readingInfo[]{READING_INFO_ARRAY};
+Readings readings[READING_COUNT];
+QueueHandle_t statusMessageQueue = nullptr;
+FixedString<STATUS_TEXT_LEN> statusMessageValue;
+SeqLock<Readings[READING_COUNT]> roomsLock(readings);
+SeqLock<Weather> weatherLock(weather);
+SeqLock<UV> uvLock(uv);
+SeqLock<AirQuality> airQualityLock(airQuality);
+SeqLock<InsideAirQuality> insideAirQualityLock(insideAirQuality);
+SeqLock<Solar> solarLock(solar);
+SeqLock<FixedString<STATUS_TEXT_LEN>> statusLock(statusMessageValue);
+std::atomic<bool> dirtyRooms(true);
+std::atomic<bool> dirtySolar(true);
+std::atomic<bool> dirtyWeather(true);
+std::atomic<bool> dirtyUv(true);
+std::atomic<bool> dirtyInsideAQ(false);
+std::atomic<bool> dirtyStatusMessage(true);
+
+void markDirty(std::atomic<bool>& flag) {
+    flag = true;
+}
+
+// The native unit tests link this file for the globals above but bring their own main()
+#ifndef PIO_UNIT_TESTING
+
+static uint16_t framebuffer[LCD_WIDTH * LCD_HEIGHT];
+static uint32_t flushedPixels = 0;
+
+// DIRECT mode renders straight into the framebuffer; the flush only counts
+// the area LVGL redrew.
+static void hostFlush(lv_display_t* disp, const lv_area_t* area, uint8_t* px_map) {
+    flushedPixels += lv_area_get_size(area);
+    lv_display_flush_ready(disp);
+}
+
+static uint32_t hostTick() {
+    return millis();
+}
+
+// Applies pending data the way loop() does, then renders one frame
+static void applyUpdates() {
+    updateRoomDisplay();
+    updateUVDisplay();
+    updateWeatherDisplay();
+    updateInsideAQDisplay();
+    if (dirtySolar) {
+        dirtySolar = false;
+        set_solar_values();
+    }
+}
+
+static void setRoom(int i, float temp, float humidity, float battery, ReadingState state) {
+    readings[i].currentValue = temp;
+    readings[i].readingState = state;
+    snprintf(readings[i].output, sizeof(readings[i].output), "%2.1f", temp);
+    readings[i + ROOM_COUNT].currentValue = humidity;
+    readings[i + ROOM_COUNT].readingState = state;
+    snprintf(readings[i + ROOM_COUNT].output, sizeof(readings[i + ROOM_COUNT].output), "%2.0f%%", humidity);
+    readings[i + 2 * ROOM_COUNT].currentValue = battery;
+    markDirty(dirtyRooms);
+}
+
+static void scriptRooms() {
+    for (int i = 0; i < ROOM_COUNT; i++) {
+        setRoom(i, 18.0f + i * 1.5f, 45.0f + i * 3, 4.0f - i * 0.3f, ReadingState::STABLE);
+    }
+}
+
+static void scriptRoomTick() {
+    setRoom(1, 21.3f, 51.0f, 3.7f, ReadingState::TRENDING_UP);
+}
+
+static void scriptRoomStale() {
+    readings[3].readingState = ReadingState::STALE;
+    markDirty(dirtyRooms);
+}
+
+static void scriptSolar() {
+    time_t now = time(nullptr);
+    solar.currentUpdateTime = now;
+    solar.dailyUpdateTime = now;
+    solar.monthlyUpdateTime = now;
+    solar.batteryCharge = 72.0f;
+    solar.usingPower = 1.8f;
+    solar.gridPower = 0.0f;
+    solar.batteryPower = -1.2f;
+    solar.solarPower = 3.0f;
+    solar.time = "12:34:56";
+    solar.todayBatteryMin = 38.0f;
+    solar.todayBatteryMax = 72.0f;
+    solar.todayBuy = 2.0f;
+    solar.todayUse = 14.0f;
+    solar.todayGeneration = 18.0f;
+    solar.monthBuy = 95.0f;
+    solar.monthUse = 410.0f;
+    solar.monthGeneration = 520.0f;
+    markDirty(dirtySolar);
+}
+
+static void scriptSolarRefresh() {
+    solar.batteryCharge = 74.0f;
+    solar.batteryPower = -1.0f;
+    solar.solarPower = 2.8f;
+    markDirty(dirtySolar);
+}
+
+static void scriptWeather() {
+    time_t now = time(nullptr);
+    weather.temperature = 24.0f;
+    weather.windSpeed = 12.0f;
+    weather.minTemp = 16.0f;
+    weather.maxTemp = 27.0f;
+    weather.updateTime = now;
+    weather.windDir = "SE";
+    weather.description = "Partly cloudy";
+    weather.timeString = "12:30:00";
+    uv.index = 7;
+    uv.updateTime = now;
+    uv.timeString = "12:30:00";
+    airQuality.europeanAqi = 32;
+    airQuality.updateTime = now;
+    airQuality.timeString = "12:30:00";
+    markDirty(dirtyWeather);
+    markDirty(dirtyUv);
+}
+
+static void scriptInsideAQ() {
+    insideAirQuality.co2 = 1450.0f;
+    insideAirQuality.co2State = ReadingState::STABLE;
+    insideAirQuality.pm25 = 8.5f;
+    insideAirQuality.pm25State = ReadingState::STABLE;
+    markDirty(dirtyInsideAQ);
+}
+
+static void scriptDay() {
+    weather.isDay = true;
+    apply_theme(false);
+    markDirty(dirtyUv); // UV update time is only shown by day
+}
+
+static void scriptNight() {
+    weather.isDay = false;
+    apply_theme(true);
+    markDirty(dirtyUv);
+}
+
+static void scriptNothing() {}
+
+struct Step {
+    const char* name;
+    void (*apply)();
+};
+
+static const Step steps[] = {
+    {"boot", scriptNothing},
+    {"rooms", scriptRooms},
+    {"room_tick", scriptRoomTick},
+    {"room_stale", scriptRoomStale},
+    {"solar", scriptSolar},
+    {"solar_refresh", scriptSolarRefresh},
+    {"weather_uv", scriptWeather},
+    {"inside_aq", scriptInsideAQ},
+    {"day", scriptDay},
+    {"night", scriptNight},
+    {"unchanged", scriptNothing},
+};
+
+int main(int argc, char** argv) {
+    const char* frameDir = argc > 1 ? argv[1] : "host_frames";
+    mkdir(frameDir, 0755);
+
+    lv_init();
+    lv_tick_set_cb(hostTick);
+    lv_display_t* disp = lv_display_create(LCD_WIDTH, LCD_HEIGHT);
+    lv_display_set_color_format(disp, LV_COLOR_FORMAT_RGB565);
+    lv_display_set_buffers(disp, framebuffer, nullptr, sizeof(framebuffer), LV_DISPLAY_RENDER_MODE_DIRECT);
+    lv_display_set_flush_cb(disp, hostFlush);
+
+    ui_init();
+    theme_init();
+    apply_theme(true);
+    uiBindingsInit();
+    static_layer_init();
+
+    printf("%-14s %10s %12s %8s %12s\n", "step", "update us", "render us", "pixels", "heap max");
+    int index = 0;
+    for (const Step& step : steps) {
+        flushedPixels = 0;
+        int64_t start = esp_timer_get_time();
+        step.apply();
+        applyUpdates();
+        int64_t updated = esp_timer_get_time();
+        lv_refr_now(disp);
+        int64_t rendered = esp_timer_get_time();
+
+        lv_mem_monitor_t mon;
+        lv_mem_monitor(&mon);
+        printf("%-14s %10lld %12lld %8lu %12lu\n", step.name, (long long)(updated - start), (long long)(rendered - updated),
+               (unsigned long)flushedPixels, (unsigned long)mon.max_used);
+
+        char path[256];
+        snprintf(path, sizeof(path), "%s/%02d_%s.png", frameDir, index++, step.name);
+        if (!writePngRgb565(path, framebuffer, LCD_WIDTH, LCD_HEIGHT)) {
+            fprintf(stderr, "Failed to write %s\n", path);
+        }
+    }
+
+    char report[CHAR_LEN];
+    ringHistoryBenchmark(report, sizeof(report));
+    printf("%s\n", report);
+    topicDispatchBenchmark(report, sizeof(report));
+    printf("%s\n", report);
+    return 0;
+}
+
+#endif // PIO_UNIT_TESTING
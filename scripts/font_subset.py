@@ -0,0 +1,214 @@
+"""Cuts the SquareLine icon fonts down to the glyphs the firmware uses.
+
+Run by PlatformIO before each firmware build, or by
+hand:  python scripts/font_subset.py
+
+SquareLine converts each font with the ranges in SL/assets/*.fcfg, usually all
+of ASCII, while the UI shows a handful of icons. The used codepoints are
+collected from
+  - constants in src/ whose trailing comment names the font, or every font
+    the constant is shown in, e.g.
+        static const char CHAR_UP = 'a'; // ui_font_Epicycles
+        static const char CHAR_BLANK = 32; // ui_font_Epicycles, ui_font_Battery2
+  - the initial label text in the SquareLine export (src/UI/ui_Screen1.c) of
+    every label whose style uses the font,
+and each font in SUBSET_FONTS is rewritten in place with only those glyphs.
+The rewrite works on the exported C file (glyph bitmaps, descriptors and
+cmaps), so no font converter is needed; re-exporting from SquareLine restores
+the full range and the next build cuts it down again.
+
+The build fails if a codepoint referenced from src/ isn't in the font; that
+needs the range extended in SquareLine and the font re-exported. Placeholder
+text in the SquareLine screen that the font lacks only produces a warning,
+since the firmware replaces it before the first frame.
+"""
+
+import glob
+import os
+import re
+import sys
+
+# Icon fonts whose every use is known; text fonts show runtime strings and stay whole
+SUBSET_FONTS = ["ui_font_Battery2", "ui_font_Epicycles", "ui_font_MDWiFi", "ui_font_Phosphor48"]
+
+CONSTANT_RE = re.compile(r"static const char(?:\s*\*\s*const)?\s+\w+\s*=\s*(.+?);\s*//(.*)")
+FONT_TAG_RE = re.compile(r"\bui_font_\w+")
+LABEL_FONT_RE = re.compile(r"lv_obj_set_style_text_font\(\s*(\w+)\s*,\s*&(ui_font_\w+)")
+LABEL_TEXT_RE = re.compile(r'lv_label_set_text\(\s*(\w+)\s*,\s*("(?:[^"\\]|\\.)*")\s*\)')
+
+BITMAP_RE = re.compile(r"(static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap\[\] = \{)(.*?)(\n\};\n)", re.S)
+GLYPH_DSC_RE = re.compile(r"static const lv_font_fmt_txt_glyph_dsc_t glyph_dsc\[\] = \{.*?\n\};\n", re.S)
+DSC_ENTRY_RE = re.compile(
+    r"\{\.bitmap_index = (\d+), \.adv_w = (\d+), \.box_w = (\d+), \.box_h = (\d+), \.ofs_x = (-?\d+), \.ofs_y = (-?\d+)\}"
+)
+CMAP_SECTION_RE = re.compile(r"(/\*-+\n \*  CHARACTER MAPPING\n \*-+\*/\n)(.*?)(\n\n*/\*-+\n \*  ALL CUSTOM DATA)", re.S)
+CMAP_NUM_RE = re.compile(r"\.cmap_num = \d+,")
+GLYPH_COMMENT_RE = re.compile(r"/\* U\+([0-9A-F]+) ")
+
+
+class FontError(Exception):
+    pass
+
+
+def c_literal_codepoints(literal):
+    """Codepoints of a C char, integer or string literal."""
+    literal = literal.strip()
+    if re.fullmatch(r"\d+", literal):
+        return {int(literal)}
+    if literal[0] in "'\"":
+        raw = literal[1:-1].encode("latin-1").decode("unicode_escape").encode("latin-1")
+        return {ord(c) for c in raw.decode("utf-8")}
+    return set()
+
+
+def used_codepoints(project_dir):
+    used = {}  # font -> {codepoint: where}
+    soft = {}  # font -> {codepoint: where}, SquareLine placeholder text
+    for path in glob.glob(os.path.join(project_dir, "src", "*.[ch]*")):
+        with open(path, encoding="utf-8") as f:
+            for number, line in enumerate(f, 1):
+                m = CONSTANT_RE.search(line)
+                if not m:
+                    continue
+                for font in FONT_TAG_RE.findall(m.group(2)):
+                    for cp in c_literal_codepoints(m.group(1)):
+                        used.setdefault(font, {})[cp] = "%s:%d" % (os.path.basename(path), number)
+
+    with open(os.path.join(project_dir, "src", "UI", "ui_Screen1.c"), encoding="utf-8") as f:
+        screen = f.read()
+    label_font = dict(LABEL_FONT_RE.findall(screen))
+    for label, text in LABEL_TEXT_RE.findall(screen):
+        font = label_font.get(label)
+        if font:
+            used.setdefault(font, {})
+            for cp in c_literal_codepoints(text):
+                soft.setdefault(font, {})[cp] = "ui_Screen1.c %s" % label
+    return used, soft
+
+
+def parse_font(source, name):
+    bitmap = BITMAP_RE.search(source)
+    dsc = GLYPH_DSC_RE.search(source)
+    cmaps = CMAP_SECTION_RE.search(source)
+    if not bitmap or not dsc or not cmaps:
+        raise FontError("%s: not a SquareLine/lv_font_conv font file" % name)
+    body = bitmap.group(2)
+    codepoints = [int(cp, 16) for cp in GLYPH_COMMENT_RE.findall(body)]
+    data = bytes(int(v, 16) for v in re.sub(r"/\*.*?\*/", "", body, flags=re.S).replace("\n", "").split(",") if v.strip())
+    entries = [tuple(int(v) for v in e) for e in DSC_ENTRY_RE.findall(dsc.group(0))][1:]  # id 0 is reserved
+    if len(entries) != len(codepoints):
+        raise FontError("%s: %d glyph descriptors but %d bitmaps" % (name, len(entries), len(codepoints)))
+    glyphs = {}
+    for i, (cp, entry) in enumerate(zip(codepoints, entries)):
+        end = entries[i + 1][0] if i + 1 < len(entries) else len(data)
+        glyphs[cp] = (entry, data[entry[0] : end])
+    return glyphs
+
+
+def glyph_comment(cp):
+    char = chr(cp)
+    shown = char if cp >= 0x20 and char not in '"\\' and cp != 0x7F else ""
+    return '/* U+%04X "%s" */' % (cp, shown)
+
+
+def subset_font(source, name, keep):
+    glyphs = parse_font(source, name)
+    keep = sorted(keep)
+
+    bitmap_lines = []
+    dsc_lines = ["    {.bitmap_index = 0, .adv_w = 0, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0} /* id = 0 reserved */"]
+    index = 0
+    for cp in keep:
+        entry, data = glyphs[cp]
+        hexes = ["0x%x" % b for b in data]
+        rows = [", ".join(hexes[i : i + 8]) for i in range(0, len(hexes), 8)]
+        bitmap_lines.append("    " + glyph_comment(cp) + "\n    " + ",\n    ".join(rows))
+        dsc_lines.append(
+            "    {.bitmap_index = %d, .adv_w = %d, .box_w = %d, .box_h = %d, .ofs_x = %d, .ofs_y = %d}" % ((index,) + entry[1:])
+        )
+        index += len(data)
+
+    # Sparse cmaps; a cmap's unicode_list holds 16-bit offsets from its range_start
+    groups = []
+    for cp in keep:
+        if groups and cp - groups[-1][0] <= 0xFFFF:
+            groups[-1].append(cp)
+        else:
+            groups.append([cp])
+    cmap_arrays = []
+    cmap_entries = []
+    glyph_id = 1
+    for n, group in enumerate(groups):
+        offsets = ", ".join(str(cp - group[0]) for cp in group)
+        cmap_arrays.append("static const uint16_t unicode_list_%d[] = {\n    %s\n};\n" % (n, offsets))
+        cmap_entries.append(
+            "    {\n"
+            "        .range_start = %d, .range_length = %d, .glyph_id_start = %d,\n"
+            "        .unicode_list = unicode_list_%d, .glyph_id_ofs_list = NULL, .list_length = %d, .type = LV_FONT_FMT_TXT_CMAP_SPARSE_TINY\n"
+            "    }" % (group[0], group[-1] - group[0] + 1, glyph_id, n, len(group))
+        )
+        glyph_id += len(group)
+    cmap_text = (
+        "\n".join(cmap_arrays)
+        + "\n/*Collect the unicode lists and glyph_id offsets*/\n"
+        + "static const lv_font_fmt_txt_cmap_t cmaps[] =\n{\n"
+        + ",\n".join(cmap_entries)
+        + "\n};\n"
+    )
+
+    source = BITMAP_RE.sub(lambda m: m.group(1) + "\n" + ",\n\n".join(bitmap_lines) + m.group(3), source, count=1)
+    source = GLYPH_DSC_RE.sub(
+        lambda m: "static const lv_font_fmt_txt_glyph_dsc_t glyph_dsc[] = {\n" + ",\n".join(dsc_lines) + "\n};\n", source, count=1
+    )
+    source = CMAP_SECTION_RE.sub(lambda m: m.group(1) + "\n" + cmap_text + m.group(3), source, count=1)
+    source = CMAP_NUM_RE.sub(".cmap_num = %d," % len(groups), source, count=1)
+    subset_note = " * Subset: %s (scripts/font_subset.py)\n" % ", ".join("U+%04X" % cp for cp in keep)
+    if " * Subset: " in source:
+        source = re.sub(r" \* Subset: .*\n", lambda m: subset_note, source, count=1)
+    else:
+        source = source.replace(" ******************************************************************************/", subset_note.rstrip("\n") + "\n ******************************************************************************/", 1)
+    return source
+
+
+def run(project_dir):
+    used, soft = used_codepoints(project_dir)
+    errors = []
+    for name in SUBSET_FONTS:
+        path = os.path.join(project_dir, "src", "UI", name + ".c")
+        with open(path, encoding="utf-8") as f:
+            source = f.read()
+        glyphs = parse_font(source, name)
+        if name not in used:
+            print("font_subset: %s is not used by any label or constant, left as is" % name)
+            continue
+        missing = {cp: where for cp, where in used[name].items() if cp not in glyphs}
+        for cp, where in sorted(missing.items()):
+            errors.append("%s has no glyph U+%04X (used at %s)" % (name, cp, where))
+        for cp, where in sorted(soft.get(name, {}).items()):
+            if cp not in glyphs and cp not in used[name]:
+                print("font_subset: warning: %s has no glyph U+%04X for the placeholder text of %s" % (name, cp, where))
+        keep = {cp for cp in list(used[name]) + list(soft.get(name, {})) if cp in glyphs}
+        if keep == set(glyphs):
+            continue
+        before = sum(len(data) for _, data in glyphs.values())
+        with open(path, "w", encoding="utf-8") as f:
+            f.write(subset_font(source, name, keep))
+        after = sum(len(glyphs[cp][1]) for cp in keep)
+        print("font_subset: %s %d -> %d glyphs, %d -> %d bitmap bytes" % (name, len(glyphs), len(keep), before, after))
+    if errors:
+        raise FontError("\n".join(errors) + "\nExtend the font's range in SquareLine (SL/assets/*.fcfg) and re-export the fonts.")
+
+
+if __name__ == "__main__":
+    try:
+        run(os.path.dirname(os.path.dirname(os.path.abspath(__file__))))
+    except FontError as e:
+        sys.exit("font_subset: " + str(e))
+else:
+    Import("env")  # noqa: F821 (provided by PlatformIO)
+
+    try:
+        run(env.subst("$PROJECT_DIR"))  # noqa: F821
+    except FontError as e:
+        sys.stderr.write("font_subset: %s\n" % e)
+        env.Exit(1)  # noqa: F821
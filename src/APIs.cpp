@@ -137,12 +137,12 @@ static bool fetchUV() {
         return false;
     }
     float UV = root["data"][0]["uv"];
-    xSemaphoreTake(dataMutex, portMAX_DELAY);
+    uvLock.beginWrite();
     uv.index = UV;
     uv.updateTime = time(nullptr);
-    formatTimeHMS(uv.updateTime, uv.timeString, sizeof(uv.timeString));
-    xSemaphoreGive(dataMutex);
-    dirtyUv = true;
+    formatTimeHMS(uv.updateTime, uv.timeString);
+    uvLock.endWrite();
+    markDirty(dirtyUv);
     logAndPublish("UV updated");
     saveDataBlock(UV_DATA_FILENAME, &uv, sizeof(uv));
     return true;
@@ -194,18 +194,18 @@ static bool fetchWeather() {
     bool weatherIsDay = root["current"]["is_day"];
     int weatherCode = root["current"]["weather_code"];
 
-    xSemaphoreTake(dataMutex, portMAX_DELAY);
+    weatherLock.beginWrite();
     weather.temperature = weatherTemperature;
     weather.windSpeed = weatherWindSpeed;
     weather.maxTemp = weatherMaxTemp;
     weather.minTemp = weatherMinTemp;
     weather.isDay = weatherIsDay;
-    snprintf(weather.description, CHAR_LEN, "%s", wmoToText(weatherCode, weatherIsDay));
-    snprintf(weather.windDir, CHAR_LEN, "%s", degreesToDirection(weatherWindDir));
+    weather.description = wmoToText(weatherCode, weatherIsDay);
+    weather.windDir = degreesToDirection(weatherWindDir);
     weather.updateTime = time(nullptr);
-    formatTimeHMS(weather.updateTime, weather.timeString, sizeof(weather.timeString));
-    xSemaphoreGive(dataMutex);
-    dirtyWeather = true;
+    formatTimeHMS(weather.updateTime, weather.timeString);
+    weatherLock.endWrite();
+    markDirty(dirtyWeather);
     logAndPublish("Weather updated");
     saveDataBlock(WEATHER_DATA_FILENAME, &weather, sizeof(weather));
     return true;
@@ -246,15 +246,15 @@ static bool fetchAirQuality() {
         return false;
     }
 
-    xSemaphoreTake(dataMutex, portMAX_DELAY);
+    airQualityLock.beginWrite();
     airQuality.pm10 = root["current"]["pm10"];
     airQuality.pm25 = root["current"]["pm2_5"];
     airQuality.ozone = root["current"]["ozone"];
     airQuality.europeanAqi = root["current"]["european_aqi"];
     airQuality.updateTime = time(nullptr);
-    formatTimeHMS(airQuality.updateTime, airQuality.timeString, sizeof(airQuality.timeString));
-    xSemaphoreGive(dataMutex);
-    dirtyWeather = true;
+    formatTimeHMS(airQuality.updateTime, airQuality.timeString);
+    airQualityLock.endWrite();
+    markDirty(dirtyWeather);
     char logMessage[CHAR_LEN];
     snprintf(logMessage, CHAR_LEN, "Air quality updated. PM10: %.2f, PM2.5: %.2f, Ozone: %.2f, AQI: %d", airQuality.pm10, airQuality.pm25, airQuality.ozone,
              airQuality.europeanAqi);
@@ -371,7 +371,7 @@ static bool fetchCurrentSolar() {
     float recSolarPower = root["generationPower"];
 
     struct tm ts;
-    char timeBuf[CHAR_LEN];
+    char timeBuf[TIME_STRING_LEN + 1];
     localtime_r(&recTime, &ts);
     strftime(timeBuf, sizeof(timeBuf), "%H:%M:%S", &ts);
 
@@ -381,17 +381,17 @@ static bool fetchCurrentSolar() {
     struct tm nowTm;
     localtime_r(&nowT, &nowTm);
 
-    xSemaphoreTake(dataMutex, portMAX_DELAY);
+    solarLock.beginWrite();
     solar.currentUpdateTime = nowT;
     solar.solarPower = recSolarPower / 1000;
     solar.batteryPower = recBatteryPower / 1000;
     solar.usingPower = recUsingPower / 1000;
     solar.batteryCharge = recBatteryCharge;
     solar.gridPower = recGridPower / 1000;
-    snprintf(solar.time, CHAR_LEN, "%s", timeBuf);
+    solar.time = timeBuf;
 
     // Track daily battery min/max, resetting at midnight. NVS writes happen
-    // after the mutex is released — they can take tens of milliseconds.
+    // after endWrite() — they can take tens of milliseconds.
     bool saveMin = false;
     bool saveMax = false;
     if (nowTm.tm_hour == 0 && solar.isMinMaxReset == false) {
@@ -413,7 +413,7 @@ static bool fetchCurrentSolar() {
     }
     float minToSave = solar.todayBatteryMin;
     float maxToSave = solar.todayBatteryMax;
-    xSemaphoreGive(dataMutex);
+    solarLock.endWrite();
 
     if (saveMin || saveMax) {
         storage.begin("KO");
@@ -425,7 +425,7 @@ static bool fetchCurrentSolar() {
         }
         storage.end();
     }
-    dirtySolar = true;
+    markDirty(dirtySolar);
     logAndPublish("Solar status updated");
     saveDataBlock(SOLAR_DATA_FILENAME, &solar, sizeof(solar));
     return true;
@@ -437,7 +437,7 @@ static bool fetchDailySolar() {
     if (WiFi.status() != WL_CONNECTED)
         return true;
 
-    char currentDate[CHAR_LEN];
+    char currentDate[sizeof("YYYY-MM-DD")];
 
     time_t nowTime = time(nullptr);
     struct tm CurrentTimeInfo;
@@ -483,13 +483,13 @@ static bool fetchDailySolar() {
         logAndPublish("Solar today's values update failed: No success");
         return true;
     }
-    xSemaphoreTake(dataMutex, portMAX_DELAY);
+    solarLock.beginWrite();
     solar.todayBuy = root["stationDataItems"][0]["buyValue"];
     solar.todayUse = root["stationDataItems"][0]["useValue"];
     solar.todayGeneration = root["stationDataItems"][0]["generationValue"];
     solar.dailyUpdateTime = time(nullptr);
-    xSemaphoreGive(dataMutex);
-    dirtySolar = true;
+    solarLock.endWrite();
+    markDirty(dirtySolar);
     logAndPublish("Solar today's values updated");
     saveDataBlock(SOLAR_DATA_FILENAME, &solar, sizeof(solar));
     return true;
@@ -501,7 +501,7 @@ static bool fetchMonthlySolar() {
     if (WiFi.status() != WL_CONNECTED)
         return true;
 
-    char currentYearMonth[CHAR_LEN];
+    char currentYearMonth[sizeof("YYYY-MM")];
 
     time_t nowTime = time(nullptr);
     struct tm CurrentTimeInfo;
@@ -545,18 +545,46 @@ static bool fetchMonthlySolar() {
     if (recSuccess != true || root["stationDataItems"][0].isNull()) {
         return true;
     }
-    xSemaphoreTake(dataMutex, portMAX_DELAY);
+    solarLock.beginWrite();
     solar.monthBuy = root["stationDataItems"][0]["buyValue"];
     solar.monthUse = root["stationDataItems"][0]["useValue"];
     solar.monthGeneration = root["stationDataItems"][0]["generationValue"];
     solar.monthlyUpdateTime = time(nullptr);
-    xSemaphoreGive(dataMutex);
-    dirtySolar = true;
+    solarLock.endWrite();
+    markDirty(dirtySolar);
     logAndPublish("Solar month's values updated");
     saveDataBlock(SOLAR_DATA_FILENAME, &solar, sizeof(solar));
     return true;
 }
 
+// Clears API-sourced data (weather, UV, outdoor AQ) if it exceeds MAX_API_DATA_AGE_SEC.
+// Handles old SD card restores and prolonged API outages — mirrors invalidateOldReadings()
+// for MQTT sensors. The display functions' updateTime > 0 checks then show "--"/hidden.
+void invalidateStaleApiData() {
+    if (time(nullptr) <= TIME_SYNC_THRESHOLD)
+        return;
+    time_t now = time(nullptr);
+
+    if (weather.updateTime > 0 && (now - weather.updateTime) > MAX_API_DATA_AGE_SEC) {
+        weatherLock.beginWrite();
+        weather.updateTime = 0;
+        weatherLock.endWrite();
+        markDirty(dirtyWeather);
+    }
+    if (uv.updateTime > 0 && (now - uv.updateTime) > MAX_API_DATA_AGE_SEC) {
+        uvLock.beginWrite();
+        uv.updateTime = 0;
+        uvLock.endWrite();
+        markDirty(dirtyUv);
+    }
+    if (airQuality.updateTime > 0 && (now - airQuality.updateTime) > MAX_API_DATA_AGE_SEC) {
+        airQualityLock.beginWrite();
+        airQuality.updateTime = 0;
+        airQualityLock.endWrite();
+        markDirty(dirtyWeather);
+    }
+}
+
 // Consolidated API manager task - replaces 7 API tasks + OTA check task
 void api_manager_t(void* pvParameters) {
     esp_task_wdt_add(nullptr);
@@ -569,9 +597,7 @@ void api_manager_t(void* pvParameters) {
 
         if (now - lastHwmLog > HWM_LOG_INTERVAL_SEC) {
             lastHwmLog = now;
-            char hwmMsg[CHAR_LEN];
-            snprintf(hwmMsg, CHAR_LEN, "Stack HWM: API Manager %u words", uxTaskGetStackHighWaterMark(nullptr));
-            logAndPublish(hwmMsg);
+            logStackHighWaterMark("API Manager");
         }
 
         // NOTE: attemptFetch feeds the watchdog before every fetch. A single
@@ -579,6 +605,10 @@ void api_manager_t(void* pvParameters) {
         // internet is down each call runs to its timeout and one reset per
         // pass is not enough to stay inside the 60 s watchdog window.
 
+        // This task is the only writer of weather, UV and air quality (see
+        // SeqLock.h), so it also ages them out
+        invalidateStaleApiData();
+
         // Solar token - fetch if empty or expired (tokens last ~24h, refresh after 12h)
         if (strlen(solarToken.token) == 0 || (solarToken.tokenTime > 0 && (now - solarToken.tokenTime) > SOLAR_TOKEN_REFRESH_SEC)) {
             if (canRetry(solarTokenBackoff) && (now - solarTokenBackoff.lastAttemptTime >= API_FAIL_DELAY_SEC)) {
@@ -595,12 +625,12 @@ void api_manager_t(void* pvParameters) {
         if (weather.updateTime > 0 && !weather.isDay) {
             if (!uvNightApplied) {
                 uvNightApplied = true;
-                xSemaphoreTake(dataMutex, portMAX_DELAY);
+                uvLock.beginWrite();
                 uv.index = 0;
                 uv.updateTime = time(nullptr);
-                formatTimeHMS(uv.updateTime, uv.timeString, sizeof(uv.timeString));
-                xSemaphoreGive(dataMutex);
-                dirtyUv = true;
+                formatTimeHMS(uv.updateTime, uv.timeString);
+                uvLock.endWrite();
+                markDirty(dirtyUv);
                 saveDataBlock(UV_DATA_FILENAME, &uv, sizeof(uv));
             }
         } else {
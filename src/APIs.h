@@ -9,6 +9,7 @@
 #include <WiFi.h>
 
 void api_manager_t(void* pvParameters);
+void invalidateStaleApiData();
 int readChunkedPayload(WiFiClient* stream, char* buffer, size_t bufferSize);
 int readFixedLengthPayload(WiFiClient* stream, char* buffer, size_t bufferSize, size_t contentLength);
 
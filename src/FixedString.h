@@ -0,0 +1,122 @@
+#ifndef FIXEDSTRING_H
+#define FIXEDSTRING_H
+
+#include <cstdarg>
+#include <cstdio>
+#include <cstring>
+#include <stddef.h>
+#include <stdint.h>
+
+// NUL-terminated string with room for N characters and a stored length, for
+// text that used to sit in a CHAR_LEN buffer whatever it held. Writes never
+// overflow: anything past N characters is dropped, backing off to the start of
+// a cut UTF-8 sequence, and the writer returns false. Trivially copyable and
+// byte-aligned, so it can live in the packed structs saved to SD and in queue
+// items. Pass c_str() to printf-style functions.
+template <size_t N> class __attribute__((packed)) FixedString {
+    static_assert(N > 0 && N <= UINT8_MAX, "FixedString length is stored in one byte");
+
+public:
+    FixedString() {
+        clear();
+    }
+    FixedString(const char* text) {
+        assign(text);
+    }
+
+    FixedString& operator=(const char* text) {
+        assign(text);
+        return *this;
+    }
+
+    void clear() {
+        len = 0;
+        chars[0] = '\0';
+    }
+
+    bool assign(const char* text) {
+        clear();
+        return append(text);
+    }
+
+    bool append(const char* text) {
+        size_t add = strnlen(text, N - len + 1);
+        bool fits = add <= N - len;
+        memcpy(chars + len, text, fits ? add : N - len);
+        setLength(fits ? len + add : N, fits);
+        return fits;
+    }
+
+    bool format(const char* fmt, ...) __attribute__((format(printf, 2, 3))) {
+        va_list args;
+        va_start(args, fmt);
+        clear();
+        bool fits = appendv(fmt, args);
+        va_end(args);
+        return fits;
+    }
+
+    bool appendf(const char* fmt, ...) __attribute__((format(printf, 2, 3))) {
+        va_list args;
+        va_start(args, fmt);
+        bool fits = appendv(fmt, args);
+        va_end(args);
+        return fits;
+    }
+
+    bool appendv(const char* fmt, va_list args) {
+        int written = vsnprintf(chars + len, N + 1 - len, fmt, args);
+        if (written < 0) {
+            chars[len] = '\0';
+            return false;
+        }
+        bool fits = (size_t)written <= N - len;
+        setLength(fits ? len + written : N, fits);
+        return fits;
+    }
+
+    const char* c_str() const {
+        return chars;
+    }
+    size_t length() const {
+        return len;
+    }
+    bool empty() const {
+        return len == 0;
+    }
+    static constexpr size_t capacity() {
+        return N;
+    }
+
+    bool operator==(const char* text) const {
+        return strcmp(chars, text) == 0;
+    }
+    bool operator!=(const char* text) const {
+        return !(*this == text);
+    }
+
+private:
+    char chars[N + 1];
+    uint8_t len;
+
+    void setLength(size_t length, bool complete) {
+        if (!complete) {
+            // Drop a multi-byte character whose tail didn't fit
+            size_t lead = length;
+            while (lead > 0 && ((uint8_t)chars[lead - 1] & 0xC0) == 0x80) {
+                lead--;
+            }
+            if (lead > 0 && ((uint8_t)chars[lead - 1] & 0xC0) == 0xC0) {
+                uint8_t c = (uint8_t)chars[lead - 1];
+                size_t need = c >= 0xF0 ? 4 : c >= 0xE0 ? 3 : 2;
+                if (length - (lead - 1) < need) {
+                    length = lead - 1;
+                }
+            }
+        }
+        len = (uint8_t)length;
+        chars[len] = '\0';
+    }
+};
+
+#endif // FIXEDSTRING_H
@@ -0,0 +1,205 @@
+#include "LvglMemory.h"
+#include "constants.h"
+#include <lvgl.h>
+#include <multi_heap.h>
+
+#if LV_USE_STDLIB_MALLOC == LV_STDLIB_CUSTOM
+
+struct LvglPool {
+    const char* name;
+    uint8_t* start;
+    size_t size;
+    multi_heap_handle_t heap;
+    uint32_t allocs;
+    uint32_t failures; // Requests this pool couldn't satisfy
+};
+
+static LvglPool pools[2] = {{"Internal (hot)"}, {"PSRAM"}};
+static LvglPool& hotPool = pools[0];
+static LvglPool& psramPool = pools[1];
+static portMUX_TYPE poolLock = portMUX_INITIALIZER_UNLOCKED;
+
+static void pool_create(LvglPool& pool, size_t size, uint32_t caps) {
+    pool.start = (uint8_t*)heap_caps_malloc(size, caps);
+    if (!pool.start) {
+        return;
+    }
+    pool.heap = multi_heap_register(pool.start, size);
+    if (!pool.heap) {
+        heap_caps_free(pool.start);
+        pool.start = nullptr;
+        return;
+    }
+    multi_heap_set_lock(pool.heap, &poolLock);
+    pool.size = size;
+}
+
+static LvglPool* pool_of(const void* p) {
+    for (LvglPool& pool : pools) {
+        if (pool.heap && (const uint8_t*)p >= pool.start && (const uint8_t*)p < pool.start + pool.size) {
+            return &pool;
+        }
+    }
+    return nullptr;
+}
+
+static void* pool_malloc(LvglPool& pool, size_t size) {
+    if (!pool.heap) {
+        return nullptr;
+    }
+    void* p = multi_heap_malloc(pool.heap, size);
+    if (p) {
+        pool.allocs++;
+    } else {
+        pool.failures++;
+    }
+    return p;
+}
+
+// Called from lv_init(), which runs after PSRAM is up. If a pool can't be
+// created its allocations fall through to the system heap (see lv_malloc_core).
+extern "C" void lv_mem_init(void) {
+    pool_create(hotPool, LVGL_HOT_POOL_SIZE, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+    pool_create(psramPool, LVGL_PSRAM_POOL_SIZE, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+    if (!psramPool.heap) {
+        Serial.println("LVGL memory: PSRAM pool allocation failed, using the system heap");
+    }
+}
+
+extern "C" void lv_mem_deinit(void) {
+    for (LvglPool& pool : pools) {
+        if (pool.start) {
+            heap_caps_free(pool.start);
+        }
+        pool = {pool.name};
+    }
+}
+
+// The pools are fixed at lv_mem_init(); say so rather than drop the memory silently
+extern "C" lv_mem_pool_t lv_mem_add_pool(void* mem, size_t bytes) {
+    Serial.printf("LVGL memory: lv_mem_add_pool(%p, %u) ignored, pools are fixed\n", mem, (unsigned)bytes);
+    return nullptr;
+}
+
+extern "C" void lv_mem_remove_pool(lv_mem_pool_t pool) {
+    (void)pool;
+}
+
+extern "C" void* lv_malloc_core(size_t size) {
+    void* p = pool_malloc(psramPool, size);
+    if (!p) {
+        p = heap_caps_malloc(size, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+    }
+    return p;
+}
+
+extern "C" void lv_free_core(void* p) {
+    LvglPool* pool = pool_of(p);
+    if (pool) {
+        multi_heap_free(pool->heap, p);
+    } else {
+        heap_caps_free(p);
+    }
+}
+
+// Grows in place when the owning pool allows it, otherwise moves the block to
+// wherever lv_malloc_core() would put a new one.
+extern "C" void* lv_realloc_core(void* p, size_t newSize) {
+    if (!p) {
+        return lv_malloc_core(newSize);
+    }
+    LvglPool* pool = pool_of(p);
+    if (!pool) {
+        return heap_caps_realloc(p, newSize, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+    }
+    void* grown = multi_heap_realloc(pool->heap, p, newSize);
+    if (grown) {
+        return grown;
+    }
+    void* moved = lv_malloc_core(newSize);
+    if (moved) {
+        memcpy(moved, p, min(multi_heap_get_allocated_size(pool->heap, p), newSize));
+        multi_heap_free(pool->heap, p);
+    }
+    return moved;
+}
+
+extern "C" void lv_mem_monitor_core(lv_mem_monitor_t* mon) {
+    memset(mon, 0, sizeof(*mon));
+    for (LvglPool& pool : pools) {
+        if (!pool.heap) {
+            continue;
+        }
+        multi_heap_info_t info;
+        multi_heap_get_info(pool.heap, &info);
+        mon->total_size += pool.size;
+        mon->free_size += info.total_free_bytes;
+        mon->free_cnt += info.free_blocks;
+        mon->used_cnt += info.allocated_blocks;
+        mon->max_used += pool.size - info.minimum_free_bytes;
+        mon->free_biggest_size = max(mon->free_biggest_size, info.largest_free_block);
+    }
+    if (mon->total_size) {
+        mon->used_pct = 100 - (100U * mon->free_size) / mon->total_size;
+    }
+    if (mon->free_size) {
+        mon->frag_pct = 100 - (100U * mon->free_biggest_size) / mon->free_size;
+    }
+}
+
+extern "C" lv_result_t lv_mem_test_core(void) {
+    for (LvglPool& pool : pools) {
+        if (pool.heap && !multi_heap_check(pool.heap, false)) {
+            return LV_RESULT_INVALID;
+        }
+    }
+    return LV_RESULT_OK;
+}
+
+// Draw-buffer handler: LVGL's default allocates LV_DRAW_BUF_ALIGN - 1 spare
+// bytes so align_pointer_cb can align the start; keep that
+static void* scratch_malloc(size_t size, lv_color_format_t colorFormat) {
+    (void)colorFormat;
+    size += LV_DRAW_BUF_ALIGN - 1;
+    void* p = size <= LVGL_HOT_ALLOC_MAX ? pool_malloc(hotPool, size) : nullptr;
+    return p ? p : lv_malloc_core(size);
+}
+
+void lvglMemoryUseScratchPool() {
+    lv_draw_buf_handlers_t* handlers = lv_draw_buf_get_handlers();
+    handlers->buf_malloc_cb = scratch_malloc;
+    handlers->buf_free_cb = lv_free_core;
+}
+
+void lvglMemoryReport(String& content) {
+    content += "<p class='section-title'>LVGL Memory</p>"
+               "<table class='data-table'><tr><th>Pool</th><th>Size</th><th>Used</th><th>Peak</th><th>Largest free</th>"
+               "<th>Fragmentation</th><th>Blocks</th><th>Allocations</th><th>Misses</th></tr>";
+    for (LvglPool& pool : pools) {
+        if (!pool.heap) {
+            content += "<tr><td>" + String(pool.name) + "</td><td colspan='8'>Not allocated</td></tr>";
+            continue;
+        }
+        multi_heap_info_t info;
+        multi_heap_get_info(pool.heap, &info);
+        size_t used = pool.size - info.total_free_bytes;
+        size_t peak = pool.size - info.minimum_free_bytes;
+        uint32_t fragPct = info.total_free_bytes ? 100 - (100U * info.largest_free_block) / info.total_free_bytes : 0;
+        content += "<tr><td>" + String(pool.name) + "</td><td>" + String(pool.size / 1024) + " KB</td><td>" + String(used / 1024.0, 1) + " KB (" +
+                   String(100U * used / pool.size) + "%)</td><td>" + String(peak / 1024.0, 1) + " KB (" + String(100U * peak / pool.size) + "%)</td><td>" +
+                   String(info.largest_free_block / 1024.0, 1) + " KB</td><td>" + String(fragPct) + "%</td><td>" + String(info.allocated_blocks) +
+                   "</td><td>" + String(pool.allocs) + "</td><td>" + String(pool.failures) + "</td></tr>";
+    }
+    content += "</table><p>The hot pool holds scratch draw buffers (layers) up to " + String(LVGL_HOT_ALLOC_MAX) +
+               " bytes; a miss falls back to PSRAM. Everything else, caches included, is in PSRAM.</p>";
+}
+
+#else // Built-in LVGL allocator (host build)
+
+void lvglMemoryUseScratchPool() {}
+
+void lvglMemoryReport(String& content) {
+    content += "<p>LVGL is using its built-in allocator</p>";
+}
+
+#endif // LV_USE_STDLIB_MALLOC == LV_STDLIB_CUSTOM
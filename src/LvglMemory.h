@@ -0,0 +1,20 @@
+#ifndef LVGLMEMORY_H
+#define LVGLMEMORY_H
+
+#include <Arduino.h>
+
+// LVGL memory backend (LV_STDLIB_CUSTOM in lv_conf.h). Two heaps replace the
+// fixed LV_MEM_SIZE pool: a small internal-SRAM "hot" pool for scratch draw
+// buffers (the layers and intermediate buffers a draw unit renders into and
+// frees within the frame), and a large PSRAM pool for everything lv_malloc()
+// serves: objects, styles, draw tasks and the circle and glyph caches. Only
+// the draw-buffer handlers reach the hot pool, so nothing long-lived can pin
+// it; a scratch buffer that doesn't fit falls back to PSRAM. Both are ESP-IDF
+// multi_heap instances, so LVGL never touches the system heap.
+
+// Points LVGL's default draw-buffer handlers at the hot pool; call after lv_init()
+void lvglMemoryUseScratchPool();
+// Per-pool usage, peak and fragmentation for the /lvgl-memory page
+void lvglMemoryReport(String& content);
+
+#endif // LVGLMEMORY_H
@@ -1,5 +1,13 @@
 #include "OTA.h"
+#include "LvglMemory.h"
+#include "PixelKernels.h"
+#include "RenderProfiler.h"
+#include "RingHistory.h"
+#include "ScreenMirror.h"
+#include "ScreenUpdates.h"
 #include "SDCard.h"
+#include "SeqLock.h"
+#include "TopicTable.h"
 #include "html.h"
 #include "utils.h"
 
@@ -8,6 +16,9 @@ extern char macAddress[18];
 unsigned long lastOTAUpdateCheck = 0;
 extern HTTPClient http;
 extern char chipId[CHAR_LEN];
+void calibrateDrawBuffers(char* report, size_t reportLen);
+void runPsramBenchmark(char* report, size_t reportLen);
+void setTouchInterruptMode(bool enable);
 
 // Fetches the version file from the OTA server and compares it to FIRMWARE_VERSION.
 // If the server has a newer version, calls updateFirmware() immediately.
@@ -110,15 +121,65 @@ void updateFirmware() {
     http.end();
 }
 
+// Stack high-water marks of the firmware's tasks and the sizes of the shared
+// state structs and queue items, as HTML for the info page template.
+static void memoryFootprintReport(String& content) {
+    static const char* const TASKS[] = {"loopTask", "LVGL Render", "Receive Mqtt", "API Manager", "Connectivity", "Display Status", "SD Logger", "Web Server"};
+    content = "<p class='section-title'>Task Stacks</p><table class='data-table'><tr><th>Task</th><th>Least free (bytes)</th></tr>";
+    for (const char* name : TASKS) {
+        TaskHandle_t task = xTaskGetHandle(name);
+        content += "<tr><td>" + String(name) + "</td><td>" + (task ? String(uxTaskGetStackHighWaterMark(task)) : String("not running")) + "</td></tr>";
+    }
+    content += "</table><p class='section-title'>State Structs (bytes)</p><table class='data-table'>";
+    const struct {
+        const char* name;
+        size_t size;
+    } structs[] = {
+        {"Readings (each)", sizeof(Readings)},
+        {"Weather", sizeof(Weather)},
+        {"UV", sizeof(UV)},
+        {"AirQuality", sizeof(AirQuality)},
+        {"Solar", sizeof(Solar)},
+        {"StatusMessage (queue item)", sizeof(StatusMessage)},
+        {"SDLogMessage (queue item)", sizeof(SDLogMessage)},
+    };
+    for (const auto& entry : structs) {
+        content += "<tr><td>" + String(entry.name) + "</td><td>" + String((unsigned)entry.size) + "</td></tr>";
+    }
+    content += "</table>";
+}
+
 void getLogsJSON(const char* logFilename) {
     String jsonOutput;
     getLogsFromSDCard(logFilename, jsonOutput);
     webServer.send(200, "application/json", jsonOutput);
 }
 
+// Benchmarks run by POST /benchmark?name=<name>. Each writes a one-line report,
+// which is returned and logged.
+struct Benchmark {
+    const char* name;
+    void (*run)(char* report, size_t reportLen);
+    bool logsReport; // Already calls logAndPublish() itself
+};
+static const Benchmark benchmarks[] = {
+    {"psram", runPsramBenchmark, true},       // PSRAM throughput and VSYNC jitter, idle and under a download burst
+    {"theme", benchmark_theme_switch, true},  // Day/night switch: per-object local styles vs shared theme styles
+    {"layer", benchmark_static_layer, true},  // Arc redraw: static background drawn directly vs from the PSRAM layer
+    {"pixel", pixelKernelsBenchmark, false},  // RGB565 pixel kernels vs per-pixel loops
+    {"seqlock", seqLockBenchmark, true},      // Producer write latency: render-long mutex vs SeqLock snapshots
+    {"history", ringHistoryBenchmark, false}, // Trend history update: ring buffer vs array shift
+    {"topic", topicDispatchBenchmark, false}, // MQTT topic lookup: perfect hash vs strcmp scan
+};
+
 // Registers all HTTP endpoints and starts the web server.
 // Endpoints: / (board info), /logs (log viewer), /api/logs/normal|error (JSON),
-//            /reboot (POST), /update GET (OTA upload page), /update POST (firmware upload).
+//            /reboot (POST), /calibrate-display (POST),
+//            /benchmark (POST name=, see benchmarks[]), /render-profile GET (table) / POST enable=0|1,
+//            /lvgl-memory (LVGL pool usage), /memory-footprint (task stacks, state struct sizes),
+//            /touch-mode (POST mode=interrupt|poll),
+//            /screen (live mirror page), /screen/frame?since=N (changed rects, see ScreenMirror.h),
+//            /update GET (OTA upload page), /update POST (firmware upload).
 void setup_web_server() {
 
     webServer.on("/api/logs/normal", HTTP_GET, []() {
@@ -140,6 +201,78 @@ void setup_web_server() {
         ESP.restart();
     });
 
+    webServer.on("/calibrate-display", HTTP_POST, []() {
+        char report[CHAR_LEN];
+        calibrateDrawBuffers(report, CHAR_LEN);
+        webServer.send(200, "text/plain", report);
+    });
+
+    webServer.on("/benchmark", HTTP_POST, []() {
+        String name = webServer.arg("name");
+        for (const Benchmark& benchmark : benchmarks) {
+            if (name == benchmark.name) {
+                char report[CHAR_LEN];
+                benchmark.run(report, CHAR_LEN);
+                if (!benchmark.logsReport) {
+                    logAndPublish(report);
+                }
+                webServer.send(200, "text/plain", report);
+                return;
+            }
+        }
+        String names;
+        for (const Benchmark& benchmark : benchmarks) {
+            names += names.length() ? "|" : "";
+            names += benchmark.name;
+        }
+        webServer.send(400, "text/plain", "Unknown benchmark, name=" + names);
+    });
+
+    webServer.on("/touch-mode", HTTP_POST, []() {
+        bool interrupt = webServer.arg("mode") != "poll";
+        setTouchInterruptMode(interrupt);
+        webServer.send(200, "text/plain", touchStats.interruptMode ? "Touch: interrupt mode" : "Touch: polling mode");
+    });
+
+    webServer.on("/screen", HTTP_GET, []() {
+        webServer.send(200, "text/html", screen_html);
+    });
+
+    webServer.on("/screen/frame", HTTP_GET, []() {
+        screenMirrorServe(webServer);
+    });
+
+    webServer.on("/render-profile", HTTP_GET, []() {
+        String content;
+        renderProfilerReport(content);
+        String html = info_html;
+        html.replace("{{content}}", content);
+        webServer.send(200, "text/html", html);
+    });
+
+    webServer.on("/render-profile", HTTP_POST, []() {
+        bool enable = webServer.arg("enable") != "0";
+        renderProfilerSetEnabled(enable);
+        logAndPublish(enable ? "Render profiler started" : "Render profiler stopped");
+        webServer.send(200, "text/plain", enable ? "Render profiler started" : "Render profiler stopped");
+    });
+
+    webServer.on("/lvgl-memory", HTTP_GET, []() {
+        String content;
+        lvglMemoryReport(content);
+        String html = info_html;
+        html.replace("{{content}}", content);
+        webServer.send(200, "text/html", html);
+    });
+
+    webServer.on("/memory-footprint", HTTP_GET, []() {
+        String content;
+        memoryFootprintReport(content);
+        String html = info_html;
+        html.replace("{{content}}", content);
+        webServer.send(200, "text/html", html);
+    });
+
     webServer.on("/", HTTP_GET, []() {
         String content = "<p class='section-title'>Board Details</p>"
                          "<table class='data-table'>"
@@ -164,6 +297,20 @@ void setup_web_server() {
                          "<tr><td><b>Uptime:</b></td><td>" +
                          getUptime() +
                          "</td></tr>"
+                         "<tr><td><b>Frame Time:</b></td><td>" +
+                         String(displayStats.lastFrameUs / 1000.0, 1) + " ms last / " + String(displayStats.avgFrameUs / 1000.0, 1) + " ms avg / " +
+                         String(displayStats.maxFrameUs / 1000.0, 1) + " ms max" +
+                         "</td></tr>"
+                         "<tr><td><b>Frames:</b></td><td>" +
+                         String(displayStats.frames) + " rendered, " + String(displayStats.missedVsyncs) + " of " + String(displayStats.vsyncs) +
+                         " vsyncs missed, " + String(displayStats.vsyncJitter) + " jittered" +
+                         "</td></tr>"
+                         "<tr><td><b>Touch:</b></td><td>" +
+                         String(touchStats.interruptMode ? "interrupt" : "polling") + ", " +
+                         String(touchStats.i2cReads * 60000.0 / max(millis() - touchStats.sinceMs, 1UL), 0) + " I2C reads/min, " +
+                         String(touchStats.touches) + " touches, latency " + String(touchStats.lastLatencyUs / 1000.0, 1) + " ms last / " +
+                         String(touchStats.avgLatencyUs / 1000.0, 1) + " ms avg / " + String(touchStats.maxLatencyUs / 1000.0, 1) + " ms max" +
+                         "</td></tr>"
                          "</table>";
 
         String html = info_html;
@@ -208,6 +355,26 @@ void setup_web_server() {
     webServer.begin();
 }
 
+// FreeRTOS task: serves HTTP requests. WebServer has no event to wait on, so
+// it is polled here every WEB_POLL_INTERVAL_MS, which leaves loop() free to
+// sleep until it has display work.
+void web_server_t(void* pvParameters) {
+    esp_task_wdt_add(nullptr);
+
+    unsigned long lastHwmLog = 0;
+    while (true) {
+        esp_task_wdt_reset();
+
+        if (millis() - lastHwmLog > HWM_LOG_INTERVAL_MS) {
+            lastHwmLog = millis();
+            logStackHighWaterMark("Web Server");
+        }
+
+        webServer.handleClient();
+        vTaskDelay(pdMS_TO_TICKS(WEB_POLL_INTERVAL_MS));
+    }
+}
+
 // Returns a human-readable uptime string, e.g. "3 days, 04:22:15".
 // Based on millis() which rolls over after ~49 days, but that's fine for this device.
 String getUptime() {
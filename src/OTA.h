@@ -8,6 +8,7 @@
 #include <WiFi.h>
 
 void setup_web_server();
+void web_server_t(void* pvParameters);
 void updateFirmware();
 void checkForUpdates();
 String getUptime();
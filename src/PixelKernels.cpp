@@ -0,0 +1,295 @@
+#include "PixelKernels.h"
+#include <Arduino.h>
+#include <cassert>
+#include <cstring>
+#include <esp_timer.h>
+
+// The kernels run on LVGL's draw threads, the flush task and loop() at once.
+// IDF saves the PIE q registers across a context switch only from 5.3; before
+// that a task switched in mid-run could overwrite q0, so older IDFs use the
+// portable kernels.
+#if defined(CONFIG_IDF_TARGET_ESP32S3) && !defined(KLAUSSOMETER_HOST)
+#include <esp_idf_version.h>
+#if ESP_IDF_VERSION >= ESP_IDF_VERSION_VAL(5, 3, 0)
+#define PIXEL_KERNELS_PIE 1
+#endif
+#endif
+#ifndef PIXEL_KERNELS_PIE
+#define PIXEL_KERNELS_PIE 0
+#endif
+
+static const size_t PIE_BLOCK_PIXELS = 8; // One 128-bit q register
+
+static inline uint32_t pair(uint16_t color) {
+    return (uint32_t)color << 16 | color;
+}
+
+// Number of pixels before dst reaches an alignBytes boundary
+static inline size_t align_head(const uint16_t* dst, size_t count, size_t alignBytes) {
+    size_t head = ((alignBytes - ((uintptr_t)dst & (alignBytes - 1))) & (alignBytes - 1)) / sizeof(uint16_t);
+    return head < count ? head : count;
+}
+
+// --- Portable kernels (two pixels per 32-bit word) ---
+
+void pixelSwap565Portable(uint16_t* dst, const uint16_t* src, size_t count) {
+    if (((uintptr_t)dst | (uintptr_t)src) & 3) {
+        for (size_t i = 0; i < count; i++) {
+            dst[i] = (uint16_t)(src[i] << 8 | src[i] >> 8);
+        }
+        return;
+    }
+    uint32_t* d = (uint32_t*)dst;
+    const uint32_t* s = (const uint32_t*)src;
+    for (size_t i = 0; i < count / 2; i++) {
+        uint32_t v = s[i];
+        d[i] = (v & 0x00FF00FF) << 8 | (v >> 8 & 0x00FF00FF);
+    }
+    if (count & 1) {
+        dst[count - 1] = (uint16_t)(src[count - 1] << 8 | src[count - 1] >> 8);
+    }
+}
+
+void pixelFill565Portable(uint16_t* dst, uint16_t color, size_t count) {
+    if ((uintptr_t)dst & 3 && count) {
+        *dst++ = color;
+        count--;
+    }
+    uint32_t* d = (uint32_t*)dst;
+    uint32_t word = pair(color);
+    size_t words = count / 2;
+    size_t i = 0;
+    for (; i + 4 <= words; i += 4) {
+        d[i] = word;
+        d[i + 1] = word;
+        d[i + 2] = word;
+        d[i + 3] = word;
+    }
+    for (; i < words; i++) {
+        d[i] = word;
+    }
+    if (count & 1) {
+        dst[count - 1] = color;
+    }
+}
+
+void pixelCopy565Portable(uint16_t* dst, const uint16_t* src, size_t count) {
+    memcpy(dst, src, count * sizeof(uint16_t));
+}
+
+// lv_color_16_16_mix() for a run of pixels: R, G and B are spread into one
+// word (0x07E0F81F) so all three mix with a single multiply.
+void pixelBlend565(uint16_t* dst, uint16_t color, uint8_t opa, size_t count) {
+    if (opa == 255) {
+        pixelFill565(dst, color, count);
+        return;
+    }
+    if (opa == 0) {
+        return;
+    }
+    uint32_t mix = ((uint32_t)opa + 4) >> 3;
+    uint32_t fg = pair(color) & 0x07E0F81F;
+    for (size_t i = 0; i < count; i++) {
+        uint16_t bgColor = dst[i];
+        if (bgColor == color) {
+            continue;
+        }
+        uint32_t bg = pair(bgColor) & 0x07E0F81F;
+        uint32_t result = ((((fg - bg) * mix) >> 5) + bg) & 0x07E0F81F;
+        dst[i] = (uint16_t)(result >> 16 | result);
+    }
+}
+
+// --- Target kernels ---
+
+void pixelSwap565(uint16_t* dst, const uint16_t* src, size_t count) {
+    pixelSwap565Portable(dst, src, count);
+}
+
+#if PIXEL_KERNELS_PIE
+
+// dst must be 16-byte aligned; blocks > 0
+static void block_fill(uint16_t* dst, uint16_t color, size_t blocks) {
+    uint32_t pattern[4] __attribute__((aligned(16))) = {pair(color), pair(color), pair(color), pair(color)};
+    uint32_t* patternPtr = pattern;
+    asm volatile("ee.vld.128.ip q0, %[pat], 0\n"
+                 "1:\n"
+                 "ee.vst.128.ip q0, %[dst], 16\n"
+                 "addi %[n], %[n], -1\n"
+                 "bnez %[n], 1b\n"
+                 : [dst] "+r"(dst), [n] "+r"(blocks), [pat] "+r"(patternPtr)
+                 :
+                 : "memory");
+}
+
+// dst and src must be 16-byte aligned; blocks > 0
+static void block_copy(uint16_t* dst, const uint16_t* src, size_t blocks) {
+    asm volatile("1:\n"
+                 "ee.vld.128.ip q0, %[src], 16\n"
+                 "ee.vst.128.ip q0, %[dst], 16\n"
+                 "addi %[n], %[n], -1\n"
+                 "bnez %[n], 1b\n"
+                 : [dst] "+r"(dst), [src] "+r"(src), [n] "+r"(blocks)
+                 :
+                 : "memory");
+}
+
+#else
+
+// Stand-ins with the PIE loops' contract, so the head / block / tail split
+// around them is built and tested on every target
+static void block_fill(uint16_t* dst, uint16_t color, size_t blocks) {
+    assert(((uintptr_t)dst & 15) == 0 && blocks > 0);
+    pixelFill565Portable(dst, color, blocks * PIE_BLOCK_PIXELS);
+}
+
+static void block_copy(uint16_t* dst, const uint16_t* src, size_t blocks) {
+    assert(((uintptr_t)dst & 15) == 0 && ((uintptr_t)src & 15) == 0 && blocks > 0);
+    pixelCopy565Portable(dst, src, blocks * PIE_BLOCK_PIXELS);
+}
+
+#endif // PIXEL_KERNELS_PIE
+
+void pixelFill565Vector(uint16_t* dst, uint16_t color, size_t count) {
+    size_t head = align_head(dst, count, 16);
+    pixelFill565Portable(dst, color, head);
+    dst += head;
+    count -= head;
+    size_t blocks = count / PIE_BLOCK_PIXELS;
+    if (blocks) {
+        block_fill(dst, color, blocks);
+        dst += blocks * PIE_BLOCK_PIXELS;
+        count -= blocks * PIE_BLOCK_PIXELS;
+    }
+    pixelFill565Portable(dst, color, count);
+}
+
+void pixelCopy565Vector(uint16_t* dst, const uint16_t* src, size_t count) {
+    // The vector loads need src and dst equally misaligned; otherwise memcpy does better
+    if (((uintptr_t)dst ^ (uintptr_t)src) & 15) {
+        pixelCopy565Portable(dst, src, count);
+        return;
+    }
+    size_t head = align_head(dst, count, 16);
+    pixelCopy565Portable(dst, src, head);
+    dst += head;
+    src += head;
+    count -= head;
+    size_t blocks = count / PIE_BLOCK_PIXELS;
+    if (blocks) {
+        block_copy(dst, src, blocks);
+        dst += blocks * PIE_BLOCK_PIXELS;
+        src += blocks * PIE_BLOCK_PIXELS;
+        count -= blocks * PIE_BLOCK_PIXELS;
+    }
+    pixelCopy565Portable(dst, src, count);
+}
+
+void pixelFill565(uint16_t* dst, uint16_t color, size_t count) {
+#if PIXEL_KERNELS_PIE
+    pixelFill565Vector(dst, color, count);
+#else
+    pixelFill565Portable(dst, color, count);
+#endif
+}
+
+void pixelCopy565(uint16_t* dst, const uint16_t* src, size_t count) {
+#if PIXEL_KERNELS_PIE
+    pixelCopy565Vector(dst, src, count);
+#else
+    pixelCopy565Portable(dst, src, count);
+#endif
+}
+
+// --- Rectangles ---
+
+void pixelFillRect565(void* dst, int32_t w, int32_t h, int32_t stride, uint16_t color) {
+    uint8_t* row = (uint8_t*)dst;
+    if (stride == w * (int32_t)sizeof(uint16_t)) {
+        pixelFill565((uint16_t*)row, color, (size_t)w * h);
+        return;
+    }
+    for (int32_t y = 0; y < h; y++, row += stride) {
+        pixelFill565((uint16_t*)row, color, w);
+    }
+}
+
+void pixelBlendRect565(void* dst, int32_t w, int32_t h, int32_t stride, uint16_t color, uint8_t opa) {
+    uint8_t* row = (uint8_t*)dst;
+    for (int32_t y = 0; y < h; y++, row += stride) {
+        pixelBlend565((uint16_t*)row, color, opa, w);
+    }
+}
+
+void pixelCopyRect565(void* dst, int32_t dstStride, const void* src, int32_t srcStride, int32_t w, int32_t h) {
+    uint8_t* d = (uint8_t*)dst;
+    const uint8_t* s = (const uint8_t*)src;
+    for (int32_t y = 0; y < h; y++, d += dstStride, s += srcStride) {
+        pixelCopy565((uint16_t*)d, (const uint16_t*)s, w);
+    }
+}
+
+// --- Benchmark ---
+
+// The per-pixel loops stand in for LVGL's own; keep GCC from turning them into memset/memcpy
+static __attribute__((optimize("no-tree-loop-distribute-patterns"))) void scalar_fill(uint16_t* dst, const uint16_t* src, size_t count) {
+    uint16_t color = src[0];
+    for (size_t i = 0; i < count; i++) {
+        dst[i] = color;
+    }
+}
+
+static __attribute__((optimize("no-tree-loop-distribute-patterns"))) void scalar_copy(uint16_t* dst, const uint16_t* src, size_t count) {
+    for (size_t i = 0; i < count; i++) {
+        dst[i] = src[i];
+    }
+}
+
+static __attribute__((optimize("no-tree-loop-distribute-patterns"))) void scalar_swap(uint16_t* dst, const uint16_t* src, size_t count) {
+    for (size_t i = 0; i < count; i++) {
+        dst[i] = (uint16_t)(src[i] << 8 | src[i] >> 8);
+    }
+}
+
+static void kernel_fill(uint16_t* dst, const uint16_t* src, size_t count) {
+    pixelFill565(dst, src[0], count);
+}
+
+static void kernel_blend(uint16_t* dst, const uint16_t* src, size_t count) {
+    pixelBlend565(dst, src[0], 128, count);
+}
+
+static uint32_t pixels_per_us(void (*kernel)(uint16_t*, const uint16_t*, size_t), uint16_t* dst, const uint16_t* src, size_t count) {
+    static const int PASSES = 50;
+    int64_t start = esp_timer_get_time();
+    for (int pass = 0; pass < PASSES; pass++) {
+        kernel(dst, src, count);
+    }
+    int64_t elapsed = esp_timer_get_time() - start;
+    return elapsed > 0 ? (uint32_t)(PASSES * (int64_t)count / elapsed) : 0;
+}
+
+// Buffers come from internal RAM so the figures reflect the kernels rather than PSRAM bandwidth
+void pixelKernelsBenchmark(char* report, size_t reportLen) {
+    static const size_t BENCH_PIXELS = 4096;
+    uint16_t* src = (uint16_t*)heap_caps_malloc(BENCH_PIXELS * sizeof(uint16_t), MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+    uint16_t* dst = (uint16_t*)heap_caps_malloc(BENCH_PIXELS * sizeof(uint16_t), MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+    if (!src || !dst) {
+        free(src);
+        free(dst);
+        snprintf(report, reportLen, "Pixel benchmark: out of memory");
+        return;
+    }
+    for (size_t i = 0; i < BENCH_PIXELS; i++) {
+        src[i] = (uint16_t)(i * 2654435761u >> 16);
+    }
+
+    snprintf(report, reportLen,
+             "Mpixel/s (per-pixel loop / kernel%s): fill %lu / %lu, copy %lu / %lu, swap %lu / %lu, blend - / %lu",
+             PIXEL_KERNELS_PIE ? ", PIE" : "", (unsigned long)pixels_per_us(scalar_fill, dst, src, BENCH_PIXELS),
+             (unsigned long)pixels_per_us(kernel_fill, dst, src, BENCH_PIXELS), (unsigned long)pixels_per_us(scalar_copy, dst, src, BENCH_PIXELS),
+             (unsigned long)pixels_per_us(pixelCopy565, dst, src, BENCH_PIXELS), (unsigned long)pixels_per_us(scalar_swap, dst, src, BENCH_PIXELS),
+             (unsigned long)pixels_per_us(pixelSwap565, dst, src, BENCH_PIXELS), (unsigned long)pixels_per_us(kernel_blend, dst, src, BENCH_PIXELS));
+    free(src);
+    free(dst);
+}
@@ -0,0 +1,60 @@
+#ifndef PIXELKERNELS_H
+#define PIXELKERNELS_H
+
+// RGB565 pixel kernels for the flush path and LVGL's software renderer.
+// On the ESP32-S3 with IDF 5.3 or later, fill and copy use the PIE 128-bit
+// vector unit for the 16-byte aligned middle of each run (the *Vector forms);
+// elsewhere, and for swap and blend, a portable version works on two pixels
+// per 32-bit word. The *Portable and *Vector functions are always built so
+// tests and /benchmark?name=pixel can compare them; off the S3 the *Vector forms
+// split runs the same way around portable stand-ins for the PIE loops.
+//
+// This header is also LVGL's LV_DRAW_SW_ASM_CUSTOM_INCLUDE (see lv_conf.h), so
+// it is included from C and must stay C-compatible.
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Byte-swaps each pixel from src into dst (LV_COLOR_16_SWAP panels)
+void pixelSwap565(uint16_t* dst, const uint16_t* src, size_t count);
+void pixelFill565(uint16_t* dst, uint16_t color, size_t count);
+void pixelCopy565(uint16_t* dst, const uint16_t* src, size_t count);
+// Mixes color over dst with opacity opa (0-255), rounding as lv_color_16_16_mix() does
+void pixelBlend565(uint16_t* dst, uint16_t color, uint8_t opa, size_t count);
+
+void pixelSwap565Portable(uint16_t* dst, const uint16_t* src, size_t count);
+void pixelFill565Portable(uint16_t* dst, uint16_t color, size_t count);
+void pixelCopy565Portable(uint16_t* dst, const uint16_t* src, size_t count);
+void pixelFill565Vector(uint16_t* dst, uint16_t color, size_t count);
+void pixelCopy565Vector(uint16_t* dst, const uint16_t* src, size_t count);
+
+// Rectangle forms; strides are in bytes
+void pixelFillRect565(void* dst, int32_t w, int32_t h, int32_t stride, uint16_t color);
+void pixelBlendRect565(void* dst, int32_t w, int32_t h, int32_t stride, uint16_t color, uint8_t opa);
+void pixelCopyRect565(void* dst, int32_t dstStride, const void* src, int32_t srcStride, int32_t w, int32_t h);
+
+// Times every kernel against a per-pixel loop and reports Mpixel/s
+void pixelKernelsBenchmark(char* report, size_t reportLen);
+
+#ifdef __cplusplus
+}
+#endif
+
+// LVGL software renderer hooks. LVGL checks the mask and opacity before using
+// each hook; one that returns LV_RESULT_INVALID falls back to LVGL's own loop.
+#define LV_DRAW_SW_COLOR_BLEND_TO_RGB565(dsc)                                                                             \
+    (pixelFillRect565((dsc)->dest_buf, (dsc)->dest_w, (dsc)->dest_h, (dsc)->dest_stride, lv_color_to_u16((dsc)->color)), \
+     LV_RESULT_OK)
+#define LV_DRAW_SW_COLOR_BLEND_TO_RGB565_WITH_OPA(dsc)                                                                   \
+    (pixelBlendRect565((dsc)->dest_buf, (dsc)->dest_w, (dsc)->dest_h, (dsc)->dest_stride, lv_color_to_u16((dsc)->color), \
+                       (dsc)->opa),                                                                                     \
+     LV_RESULT_OK)
+#define LV_DRAW_SW_RGB565_BLEND_NORMAL_TO_RGB565(dsc)                                                                    \
+    (pixelCopyRect565((dsc)->dest_buf, (dsc)->dest_stride, (dsc)->src_buf, (dsc)->src_stride, (dsc)->dest_w, (dsc)->dest_h), \
+     LV_RESULT_OK)
+
+#endif // PIXELKERNELS_H
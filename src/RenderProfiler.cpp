@@ -0,0 +1,251 @@
+#include "RenderProfiler.h"
+#include "UI/ui.h"
+#include "types.h"
+#include <esp_timer.h>
+
+// Named ui_* objects from the SquareLine export, used to attribute invalidated
+// areas. Objects missing here (after a UI re-export) are counted against the
+// smallest listed object that contains them, usually their container.
+struct NamedObject {
+    const char* name;
+    lv_obj_t** obj;
+};
+
+static const NamedObject namedObjects[] = {
+    {"ui_Screen1", &ui_Screen1},
+    {"ui_Container1", &ui_Container1},
+    {"ui_Container2", &ui_Container2},
+    {"ui_TempArc1", &ui_TempArc1},
+    {"ui_TempArc2", &ui_TempArc2},
+    {"ui_TempArc3", &ui_TempArc3},
+    {"ui_TempArc4", &ui_TempArc4},
+    {"ui_TempLabel1", &ui_TempLabel1},
+    {"ui_TempLabel2", &ui_TempLabel2},
+    {"ui_TempLabel3", &ui_TempLabel3},
+    {"ui_TempLabel4", &ui_TempLabel4},
+    {"ui_RoomName1", &ui_RoomName1},
+    {"ui_RoomName2", &ui_RoomName2},
+    {"ui_RoomName3", &ui_RoomName3},
+    {"ui_RoomName4", &ui_RoomName4},
+    {"ui_StatusMessage", &ui_StatusMessage},
+    {"ui_HumidLabel1", &ui_HumidLabel1},
+    {"ui_HumidLabel3", &ui_HumidLabel3},
+    {"ui_HumidLabel4", &ui_HumidLabel4},
+    {"ui_HumidLabel2", &ui_HumidLabel2},
+    {"ui_Time", &ui_Time},
+    {"ui_TextRooms", &ui_TextRooms},
+    {"ui_TempArcFC", &ui_TempArcFC},
+    {"ui_TempLabelFC", &ui_TempLabelFC},
+    {"ui_TextForecastName", &ui_TextForecastName},
+    {"ui_FCConditions", &ui_FCConditions},
+    {"ui_FCWindSpeed", &ui_FCWindSpeed},
+    {"ui_FCUpdateTime", &ui_FCUpdateTime},
+    {"ui_BatteryArc", &ui_BatteryArc},
+    {"ui_BatteryLabel", &ui_BatteryLabel},
+    {"ui_TextBattery", &ui_TextBattery},
+    {"ui_SolarArc", &ui_SolarArc},
+    {"ui_SolarLabel", &ui_SolarLabel},
+    {"ui_TextSolar", &ui_TextSolar},
+    {"ui_UsingArc", &ui_UsingArc},
+    {"ui_TextUsing", &ui_TextUsing},
+    {"ui_UsingLabel", &ui_UsingLabel},
+    {"ui_ChargingLabel", &ui_ChargingLabel},
+    {"ui_AsofTimeLabel", &ui_AsofTimeLabel},
+    {"ui_ChargingTime", &ui_ChargingTime},
+    {"ui_TextKlaussometer", &ui_TextKlaussometer},
+    {"ui_WiFiStatus", &ui_WiFiStatus},
+    {"ui_ServerStatus", &ui_ServerStatus},
+    {"ui_WeatherStatus", &ui_WeatherStatus},
+    {"ui_SolarStatus", &ui_SolarStatus},
+    {"ui_SolarMinMax", &ui_SolarMinMax},
+    {"ui_GridBought", &ui_GridBought},
+    {"ui_TempArc5", &ui_TempArc5},
+    {"ui_TempLabel5", &ui_TempLabel5},
+    {"ui_RoomName5", &ui_RoomName5},
+    {"ui_FCMin", &ui_FCMin},
+    {"ui_FCMax", &ui_FCMax},
+    {"ui_HumidLabel5", &ui_HumidLabel5},
+    {"ui_Direction1", &ui_Direction1},
+    {"ui_Direction2", &ui_Direction2},
+    {"ui_Direction3", &ui_Direction3},
+    {"ui_Direction4", &ui_Direction4},
+    {"ui_Direction5", &ui_Direction5},
+    {"ui_UVArc", &ui_UVArc},
+    {"ui_UVLabel", &ui_UVLabel},
+    {"ui_TextUV", &ui_TextUV},
+    {"ui_BatteryLabel5", &ui_BatteryLabel5},
+    {"ui_UVUpdateTime", &ui_UVUpdateTime},
+    {"ui_BatteryLabel1", &ui_BatteryLabel1},
+    {"ui_BatteryLabel2", &ui_BatteryLabel2},
+    {"ui_BatteryLabel4", &ui_BatteryLabel4},
+    {"ui_BatteryLabel3", &ui_BatteryLabel3},
+    {"ui_Version", &ui_Version},
+    {"ui_WiFiIcon", &ui_WiFiIcon},
+    {"ui_GridTodayEnergy", &ui_GridTodayEnergy},
+    {"ui_GridTodayCost", &ui_GridTodayCost},
+    {"ui_GridTodayPercentage", &ui_GridTodayPercentage},
+    {"ui_GridMonthEnergy", &ui_GridMonthEnergy},
+    {"ui_GridMonthCost", &ui_GridMonthCost},
+    {"ui_GridMonthPercentage", &ui_GridMonthPercentage},
+    {"ui_GridTitlekWh", &ui_GridTitlekWh},
+    {"ui_GridTitleCost", &ui_GridTitleCost},
+    {"ui_GridTitlePercentage", &ui_GridTitlePercentage},
+    {"ui_FCAQI", &ui_FCAQI},
+    {"ui_FCAQIUpdateTime", &ui_FCAQIUpdateTime},
+    {"ui_GridTitleSolar", &ui_GridTitleSolar},
+    {"ui_SolarTodayEnergy", &ui_SolarTodayEnergy},
+    {"ui_SolarMonthEnergy", &ui_SolarMonthEnergy},
+    {"ui_InsideAirQualityCO2", &ui_InsideAirQualityCO2},
+    {"ui_InsideAirQualityPM25", &ui_InsideAirQualityPM25},
+};
+static const int NAMED_OBJECT_COUNT = sizeof(namedObjects) / sizeof(namedObjects[0]);
+
+struct ObjectInvalidations {
+    uint32_t count;  // Invalidation calls attributed to the object
+    uint64_t pixels; // Sum of the invalidated area sizes
+};
+
+struct FrameTotals {
+    uint32_t frames;
+    uint64_t renderUs;
+    uint32_t maxRenderUs;
+    uint64_t flushedPixels;
+    uint32_t maxFlushedPixels;
+};
+
+// Counters are only touched from LVGL callbacks and dispFlush, so the LVGL lock
+// serialises every update; renderProfilerReport() takes it to read them.
+static bool enabled = false;
+static int64_t profileStartUs = 0;
+static ObjectInvalidations invalidations[NAMED_OBJECT_COUNT];
+static FrameTotals totals;
+static int64_t frameStartUs = 0;
+static uint32_t frameFlushedPixels = 0;
+
+// Returns the index of the smallest listed object whose drawn extent
+// (coords plus shadow/outline margin) contains the whole area, or -1.
+static int attributeArea(const lv_area_t* area) {
+    int best = -1;
+    uint32_t bestSize = UINT32_MAX;
+    for (int i = 0; i < NAMED_OBJECT_COUNT; i++) {
+        lv_obj_t* obj = *namedObjects[i].obj;
+        if (!obj || lv_obj_has_flag(obj, LV_OBJ_FLAG_HIDDEN)) {
+            continue;
+        }
+        lv_area_t extent;
+        lv_obj_get_coords(obj, &extent);
+        lv_area_increase(&extent, lv_obj_get_ext_draw_size(obj), lv_obj_get_ext_draw_size(obj));
+        if (!lv_area_is_in(area, &extent, 0)) {
+            continue;
+        }
+        uint32_t size = lv_area_get_size(&extent);
+        if (size < bestSize) {
+            bestSize = size;
+            best = i;
+        }
+    }
+    return best;
+}
+
+static void onDisplayEvent(lv_event_t* e) {
+    if (!enabled) {
+        return;
+    }
+    switch (lv_event_get_code(e)) {
+    case LV_EVENT_INVALIDATE_AREA: {
+        const lv_area_t* area = (const lv_area_t*)lv_event_get_param(e);
+        int index = attributeArea(area);
+        if (index >= 0) {
+            invalidations[index].count++;
+            invalidations[index].pixels += lv_area_get_size(area);
+        }
+        break;
+    }
+    case LV_EVENT_RENDER_START:
+        frameStartUs = esp_timer_get_time();
+        frameFlushedPixels = 0;
+        break;
+    case LV_EVENT_RENDER_READY: {
+        uint32_t renderUs = (uint32_t)(esp_timer_get_time() - frameStartUs);
+        totals.frames++;
+        totals.renderUs += renderUs;
+        totals.maxRenderUs = max(totals.maxRenderUs, renderUs);
+        totals.flushedPixels += frameFlushedPixels;
+        totals.maxFlushedPixels = max(totals.maxFlushedPixels, frameFlushedPixels);
+        break;
+    }
+    default:
+        break;
+    }
+}
+
+void renderProfilerInit(lv_display_t* disp) {
+    lv_display_add_event_cb(disp, onDisplayEvent, LV_EVENT_INVALIDATE_AREA, nullptr);
+    lv_display_add_event_cb(disp, onDisplayEvent, LV_EVENT_RENDER_START, nullptr);
+    lv_display_add_event_cb(disp, onDisplayEvent, LV_EVENT_RENDER_READY, nullptr);
+}
+
+// Starts (clearing previous results) or stops profiling.
+void renderProfilerSetEnabled(bool enable) {
+    lv_lock();
+    if (enable && !enabled) {
+        memset(invalidations, 0, sizeof(invalidations));
+        memset(&totals, 0, sizeof(totals));
+        profileStartUs = esp_timer_get_time();
+    }
+    enabled = enable;
+    lv_unlock();
+}
+
+bool renderProfilerEnabled() {
+    return enabled;
+}
+
+// Called from dispFlush with each area handed to the panel.
+void renderProfilerOnFlush(const lv_area_t* area) {
+    if (enabled) {
+        frameFlushedPixels += lv_area_get_size(area);
+    }
+}
+
+// Appends the frame summary and the per-object invalidation table, busiest
+// object first, as HTML for the web server's info page template.
+void renderProfilerReport(String& content) {
+    ObjectInvalidations snapshot[NAMED_OBJECT_COUNT];
+    FrameTotals frameTotals;
+    lv_lock();
+    memcpy(snapshot, invalidations, sizeof(snapshot));
+    frameTotals = totals;
+    uint32_t elapsedSec = enabled ? (uint32_t)((esp_timer_get_time() - profileStartUs) / 1000000) : 0;
+    lv_unlock();
+
+    uint32_t frames = frameTotals.frames ? frameTotals.frames : 1;
+    content += "<p class='section-title'>Render Profile (" + String(enabled ? "running " + String(elapsedSec) + " s" : "stopped") + ")</p>"
+               "<table class='data-table'>"
+               "<tr><td><b>Frames:</b></td><td>" + String(frameTotals.frames) + "</td></tr>"
+               "<tr><td><b>Render Time:</b></td><td>" + String(frameTotals.renderUs / frames / 1000.0, 2) + " ms avg / " +
+               String(frameTotals.maxRenderUs / 1000.0, 2) + " ms max</td></tr>"
+               "<tr><td><b>Flushed Pixels:</b></td><td>" + String((uint32_t)(frameTotals.flushedPixels / frames)) + " avg / " +
+               String(frameTotals.maxFlushedPixels) + " max per frame</td></tr>"
+               "</table>"
+               "<p class='section-title'>Invalidations by Object</p>"
+               "<table class='data-table'><tr><th>Object</th><th>Invalidations</th><th>Pixels</th><th>Pixels / frame</th></tr>";
+
+    // Selection sort by pixels; the table is small and this runs only on request
+    bool listed[NAMED_OBJECT_COUNT] = {};
+    for (int row = 0; row < NAMED_OBJECT_COUNT; row++) {
+        int best = -1;
+        for (int i = 0; i < NAMED_OBJECT_COUNT; i++) {
+            if (!listed[i] && snapshot[i].count && (best < 0 || snapshot[i].pixels > snapshot[best].pixels)) {
+                best = i;
+            }
+        }
+        if (best < 0) {
+            break;
+        }
+        listed[best] = true;
+        content += "<tr><td>" + String(namedObjects[best].name) + "</td><td>" + String(snapshot[best].count) + "</td><td>" +
+                   String((uint32_t)snapshot[best].pixels) + "</td><td>" + String((uint32_t)(snapshot[best].pixels / frames)) + "</td></tr>";
+    }
+    content += "</table>";
+}
@@ -0,0 +1,16 @@
+#ifndef RENDERPROFILER_H
+#define RENDERPROFILER_H
+
+#include <Arduino.h>
+#include <lvgl.h>
+
+// Optional instrumentation of what the UI redraws. While enabled, every
+// invalidated area is attributed to the ui_* object that covers it and every
+// frame's render time and flushed pixel count are recorded.
+void renderProfilerInit(lv_display_t* disp);
+void renderProfilerSetEnabled(bool enabled);
+bool renderProfilerEnabled();
+void renderProfilerOnFlush(const lv_area_t* area);
+void renderProfilerReport(String& content);
+
+#endif // RENDERPROFILER_H
@@ -0,0 +1,66 @@
+#include "RingHistory.h"
+#include "constants.h"
+#include <cstdio>
+#include <esp_timer.h>
+
+// The history updateReadings kept before RingHistory: sum the stored values
+// for the mean, then shift the array left once it is full
+template <size_t N> struct ShiftHistory {
+    float values[N];
+    size_t count;
+};
+
+template <size_t N> static float shift_update(ShiftHistory<N>& history, float value) {
+    float mean = value;
+    if (history.count > 0) {
+        float total = 0.0f;
+        for (size_t i = 0; i < history.count; i++) {
+            total += history.values[i];
+        }
+        mean = total / history.count;
+    }
+    if (history.count == N) {
+        history.count--;
+        for (size_t i = 0; i < N - 1; i++) {
+            history.values[i] = history.values[i + 1];
+        }
+    }
+    history.values[history.count++] = value;
+    return mean;
+}
+
+template <size_t N> static float ring_update(RingHistory<float, N>& history, float value) {
+    float mean = history.empty() ? value : history.mean();
+    history.push(value);
+    return mean;
+}
+
+static volatile float benchSink; // Keeps the compiler from dropping the timed work
+
+// Nanoseconds per update over a synthetic temperature series
+template <size_t N> static uint32_t ns_per_update(bool ring, size_t samples) {
+    static ShiftHistory<N> shift;
+    static RingHistory<float, N> rolling;
+    shift.count = 0;
+    rolling.clear();
+    float acc = 0.0f;
+    int64_t start = esp_timer_get_time();
+    for (size_t i = 0; i < samples; i++) {
+        float value = 20.0f + (float)(i % 97) * 0.1f;
+        acc += ring ? ring_update(rolling, value) : shift_update(shift, value);
+    }
+    int64_t elapsed = esp_timer_get_time() - start;
+    benchSink = acc;
+    return (uint32_t)(elapsed * 1000 / (int64_t)samples);
+}
+
+void ringHistoryBenchmark(char* report, size_t reportLen) {
+    static const size_t BENCH_SAMPLES = 20000;
+    static const size_t LONG_WINDOW = 720; // Hours of sensor messages rather than the last few
+    uint32_t shiftLive = ns_per_update<STORED_READING>(false, BENCH_SAMPLES);
+    uint32_t ringLive = ns_per_update<STORED_READING>(true, BENCH_SAMPLES);
+    uint32_t shiftLong = ns_per_update<LONG_WINDOW>(false, BENCH_SAMPLES);
+    uint32_t ringLong = ns_per_update<LONG_WINDOW>(true, BENCH_SAMPLES);
+    snprintf(report, reportLen, "Trend history ns/update (shift / ring): %d samples %lu / %lu, %d samples %lu / %lu", STORED_READING,
+             (unsigned long)shiftLive, (unsigned long)ringLive, (int)LONG_WINDOW, (unsigned long)shiftLong, (unsigned long)ringLong);
+}
@@ -0,0 +1,110 @@
+#ifndef RINGHISTORY_H
+#define RINGHISTORY_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+// The last N samples of a value, oldest overwritten first. push() is O(1) and
+// keeps a running sum, so mean() costs the same whatever the window length.
+// The sum is recomputed from the samples each time the write position wraps,
+// which bounds float rounding drift at amortised O(1). min()/max() scan the
+// window; they're for reports, not the per-message path. Trivially copyable
+// with no pointers, so it can sit in structs saved to SD and SeqLock groups.
+template <typename T, size_t N> class RingHistory {
+    static_assert(N > 0 && N <= UINT16_MAX, "RingHistory positions are stored in 16 bits");
+
+public:
+    RingHistory() {
+        clear();
+    }
+
+    void clear() {
+        sum = 0;
+        head = 0;
+        count = 0;
+    }
+
+    void push(T value) {
+        if (count == N) {
+            sum -= values[head];
+        } else {
+            count++;
+        }
+        values[head] = value;
+        sum += value;
+        if (++head == N) {
+            head = 0;
+            resum();
+        }
+    }
+
+    size_t size() const {
+        return count;
+    }
+    bool empty() const {
+        return count == 0;
+    }
+    bool full() const {
+        return count == N;
+    }
+    static constexpr size_t capacity() {
+        return N;
+    }
+
+    // i-th oldest sample, i < size()
+    T at(size_t i) const {
+        return values[(start() + i) % N];
+    }
+
+    T total() const {
+        return sum;
+    }
+    // Caller checks empty() first
+    T mean() const {
+        return sum / (T)count;
+    }
+    T min() const {
+        T lowest = values[start()];
+        for (size_t i = 1; i < count; i++) {
+            T value = values[(start() + i) % N];
+            if (value < lowest) {
+                lowest = value;
+            }
+        }
+        return lowest;
+    }
+    T max() const {
+        T highest = values[start()];
+        for (size_t i = 1; i < count; i++) {
+            T value = values[(start() + i) % N];
+            if (value > highest) {
+                highest = value;
+            }
+        }
+        return highest;
+    }
+
+private:
+    T values[N];
+    T sum;
+    uint16_t head;  // Next slot to write
+    uint16_t count; // Valid samples, up to N
+
+    size_t start() const {
+        return (head + N - count) % N;
+    }
+
+    void resum() {
+        T fresh = 0;
+        for (size_t i = 0; i < count; i++) {
+            fresh += values[i];
+        }
+        sum = fresh;
+    }
+};
+
+// Times per-message trend updates (push, then mean) through RingHistory vs
+// the shift-and-resum history it replaced, at the live window and a long one
+void ringHistoryBenchmark(char* report, size_t reportLen);
+
+#endif // RINGHISTORY_H
@@ -152,6 +152,24 @@ bool loadDataBlock(const char* filename, void* dataPtr, size_t expected_size) {
     return true;
 }
 
+// Data size recorded in a saveDataBlock file's header, or 0 if the file is
+// missing or unreadable. Lets callers recognise an older layout before loading.
+size_t dataBlockSize(const char* filename) {
+    if (xSemaphoreTake(sdMutex, pdMS_TO_TICKS(MUTEX_TIMEOUT_SD_MS)) != pdTRUE) {
+        return 0;
+    }
+    DataHeader header = {};
+    File dataFile = SD_MMC.exists(filename) ? SD_MMC.open(filename, FILE_READ) : File();
+    if (dataFile) {
+        if (dataFile.readBytes((char*)&header, sizeof(DataHeader)) != sizeof(DataHeader)) {
+            header.size = 0;
+        }
+        dataFile.close();
+    }
+    xSemaphoreGive(sdMutex);
+    return header.size;
+}
+
 void addLogToSDCard(const char* message, const char* logFilename) {
     if (message == nullptr || strlen(message) == 0) {
         return;
@@ -441,13 +459,11 @@ void sdcard_logger_t(void* pvParameters) {
     unsigned long lastHwmLog = 0;
     while (true) {
         if (xQueueReceive(sdLogQueue, &logMsg, pdMS_TO_TICKS(60000)) == pdTRUE) {
-            addLogToSDCard(logMsg.message, logMsg.filename);
+            addLogToSDCard(logMsg.message.c_str(), logMsg.filename.c_str());
         }
         if (millis() - lastHwmLog > HWM_LOG_INTERVAL_MS) {
             lastHwmLog = millis();
-            char hwmMsg[CHAR_LEN];
-            snprintf(hwmMsg, CHAR_LEN, "Stack HWM: SD Logger %u words", uxTaskGetStackHighWaterMark(nullptr));
-            logAndPublish(hwmMsg);
+            logStackHighWaterMark("SD Logger");
         }
     }
 }
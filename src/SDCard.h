@@ -7,6 +7,7 @@
 
 bool saveDataBlock(const char* filename, const void* dataPtr, size_t size);
 bool loadDataBlock(const char* filename, void* dataPtr, size_t expected_size);
+size_t dataBlockSize(const char* filename);
 void addLogToSDCard(const char* message, const char* logFilename);
 void getLogsFromSDCard(const char* logFilename, String& jsonOutput);
 void sdcard_logger_t(void* pvParameters);
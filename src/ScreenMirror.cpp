@@ -0,0 +1,208 @@
+#include "ScreenMirror.h"
+#include "types.h"
+
+// Pending rectangles are written from the flush path (render task, or the flush
+// copy task in PARTIAL_ASYNC) and drained by web_server_t, so the list is
+// guarded by a spinlock held only for a few comparisons.
+static portMUX_TYPE mirrorMux = portMUX_INITIALIZER_UNLOCKED;
+static const uint16_t* mirrorFb = nullptr;
+static int mirrorWidth = 0;
+static int mirrorHeight = 0;
+static lv_area_t pending[SCREEN_MIRROR_MAX_RECTS];
+static int pendingCount = 0;
+static volatile bool clientActive = false; // Someone polled within SCREEN_MIRROR_CLIENT_TIMEOUT_MS
+static uint32_t lastPollMs = 0;
+
+// Each drain that finds changes becomes a generation with the next sequence
+// number. The last SCREEN_MIRROR_HISTORY are kept, so every client, however
+// many are polling, gets the union of the generations after its own since.
+// Only web_server_t touches these, one request at a time.
+struct MirrorGeneration {
+    lv_area_t rects[SCREEN_MIRROR_MAX_RECTS];
+    int count;
+};
+static MirrorGeneration generations[SCREEN_MIRROR_HISTORY]; // Indexed by seq % SCREEN_MIRROR_HISTORY
+static uint32_t currentSeq = 1; // Never 0, the since of a client that has nothing yet
+static uint32_t generationCount = 0; // Generations up to currentSeq still held
+
+// Output buffer for sendContent(); flushed whenever it fills
+static uint8_t chunk[SCREEN_MIRROR_CHUNK_BYTES];
+static size_t chunkLen = 0;
+
+void screenMirrorInit(const uint16_t* framebuffer, int width, int height) {
+    mirrorFb = framebuffer;
+    mirrorWidth = width;
+    mirrorHeight = height;
+}
+
+static uint32_t areaSize(const lv_area_t& a) {
+    return (uint32_t)(a.x2 - a.x1 + 1) * (a.y2 - a.y1 + 1);
+}
+
+// True if the areas overlap or share an edge
+static bool touches(const lv_area_t& a, const lv_area_t& b) {
+    return a.x1 <= b.x2 + 1 && b.x1 <= a.x2 + 1 && a.y1 <= b.y2 + 1 && b.y1 <= a.y2 + 1;
+}
+
+static void joinArea(lv_area_t& into, const lv_area_t& other) {
+    into.x1 = min(into.x1, other.x1);
+    into.y1 = min(into.y1, other.y1);
+    into.x2 = max(into.x2, other.x2);
+    into.y2 = max(into.y2, other.y2);
+}
+
+// Adds area to a list of up to SCREEN_MIRROR_MAX_RECTS. Overlapping or touching
+// rectangles are joined; when the list is full the area is merged into
+// whichever rectangle grows least.
+static void addRect(lv_area_t* rects, int& count, const lv_area_t& area) {
+    int target = -1;
+    uint32_t bestGrowth = UINT32_MAX;
+    for (int i = 0; i < count; i++) {
+        if (touches(rects[i], area)) {
+            target = i;
+            break;
+        }
+        lv_area_t joined = rects[i];
+        joinArea(joined, area);
+        uint32_t growth = areaSize(joined) - areaSize(rects[i]);
+        if (growth < bestGrowth) {
+            bestGrowth = growth;
+            if (count == SCREEN_MIRROR_MAX_RECTS) {
+                target = i;
+            }
+        }
+    }
+    if (target >= 0) {
+        joinArea(rects[target], area);
+    } else {
+        rects[count++] = area;
+    }
+}
+
+// Records a flushed area while a client is polling.
+void screenMirrorOnFlush(const lv_area_t* area) {
+    if (!clientActive || !mirrorFb || millis() - lastPollMs > SCREEN_MIRROR_CLIENT_TIMEOUT_MS) {
+        return;
+    }
+    portENTER_CRITICAL(&mirrorMux);
+    addRect(pending, pendingCount, *area);
+    portEXIT_CRITICAL(&mirrorMux);
+}
+
+static void flushChunk(WebServer& server) {
+    if (chunkLen) {
+        server.sendContent((const char*)chunk, chunkLen);
+        chunkLen = 0;
+    }
+}
+
+static void put(WebServer& server, const void* data, size_t len) {
+    const uint8_t* bytes = (const uint8_t*)data;
+    while (len) {
+        size_t n = min(len, sizeof(chunk) - chunkLen);
+        memcpy(chunk + chunkLen, bytes, n);
+        chunkLen += n;
+        bytes += n;
+        len -= n;
+        if (chunkLen == sizeof(chunk)) {
+            flushChunk(server);
+        }
+    }
+}
+
+static void put16(WebServer& server, uint16_t v) {
+    put(server, &v, sizeof(v)); // ESP32 is little-endian, as is the wire format
+}
+
+// Encodes one rectangle straight from the framebuffer. Runs of three or more
+// equal pixels become a repeat token; everything else goes out as literals.
+static void sendRect(WebServer& server, const lv_area_t& a) {
+    put16(server, a.x1);
+    put16(server, a.y1);
+    put16(server, a.x2 - a.x1 + 1);
+    put16(server, a.y2 - a.y1 + 1);
+    for (int y = a.y1; y <= a.y2; y++) {
+        const uint16_t* row = mirrorFb + y * mirrorWidth;
+        int x = a.x1;
+        while (x <= a.x2) {
+            int run = 1;
+            while (x + run <= a.x2 && row[x + run] == row[x] && run < 0x7FFF) {
+                run++;
+            }
+            if (run >= 3) {
+                put16(server, 0x8000 | run);
+                put16(server, row[x]);
+                x += run;
+                continue;
+            }
+            // Literal span up to the next run of three
+            int lit = 0;
+            while (x + lit <= a.x2 && lit < 0x7FFF &&
+                   !(x + lit + 2 <= a.x2 && row[x + lit] == row[x + lit + 1] && row[x + lit] == row[x + lit + 2])) {
+                lit++;
+            }
+            put16(server, lit);
+            put(server, row + x, lit * sizeof(uint16_t));
+            x += lit;
+        }
+    }
+}
+
+// Handler for /screen/frame. Takes the pending list under the spinlock, then
+// encodes outside it so the flush path is never held up by the network. A
+// client already at currentSeq gets no rects; one whose since is still in the
+// history gets what changed after it; anyone else gets the full screen.
+void screenMirrorServe(WebServer& server) {
+    if (!mirrorFb) {
+        server.send(503, "text/plain", "Framebuffer unavailable");
+        return;
+    }
+    uint32_t since = strtoul(server.arg("since").c_str(), nullptr, 10);
+    MirrorGeneration drained;
+
+    portENTER_CRITICAL(&mirrorMux);
+    bool tracking = clientActive && millis() - lastPollMs <= SCREEN_MIRROR_CLIENT_TIMEOUT_MS;
+    drained.count = pendingCount;
+    memcpy(drained.rects, pending, sizeof(lv_area_t) * pendingCount);
+    pendingCount = 0;
+    clientActive = true;
+    lastPollMs = millis();
+    portEXIT_CRITICAL(&mirrorMux);
+
+    if (!tracking) {
+        currentSeq++; // Changes went unrecorded; every since is now too old
+        generationCount = 0;
+    } else if (drained.count > 0) {
+        currentSeq++;
+        generations[currentSeq % SCREEN_MIRROR_HISTORY] = drained;
+        generationCount = min(generationCount + 1, (uint32_t)SCREEN_MIRROR_HISTORY);
+    }
+
+    lv_area_t rects[SCREEN_MIRROR_MAX_RECTS];
+    int rectCount = 0;
+    uint32_t behind = currentSeq - since;
+    if (since != 0 && since <= currentSeq && behind <= generationCount) {
+        for (uint32_t seq = since + 1; seq <= currentSeq; seq++) {
+            const MirrorGeneration& generation = generations[seq % SCREEN_MIRROR_HISTORY];
+            for (int i = 0; i < generation.count; i++) {
+                addRect(rects, rectCount, generation.rects[i]);
+            }
+        }
+    } else {
+        rects[0] = {0, 0, (int32_t)mirrorWidth - 1, (int32_t)mirrorHeight - 1};
+        rectCount = 1;
+    }
+    uint32_t seq = currentSeq;
+
+    server.setContentLength(CONTENT_LENGTH_UNKNOWN);
+    server.sendHeader("Cache-Control", "no-store");
+    server.send(200, "application/octet-stream", "");
+    chunkLen = 0;
+    put(server, &seq, sizeof(seq));
+    put16(server, rectCount);
+    for (int i = 0; i < rectCount; i++) {
+        sendRect(server, rects[i]);
+    }
+    flushChunk(server);
+    server.sendContent("");
+}
@@ -0,0 +1,25 @@
+#ifndef SCREENMIRROR_H
+#define SCREENMIRROR_H
+
+#include <Arduino.h>
+#include <WebServer.h>
+#include <lvgl.h>
+
+// Remote view of the panel for the /screen page. The flush path only records
+// which rectangles changed; pixels are read from the panel framebuffer when a
+// client polls, so the mirror costs rendering no copies and never blocks it.
+// A slow client just finds its pending rectangles merged into fewer, larger ones.
+//
+// /screen/frame?since=<seq> wire format (little-endian):
+//   uint32 seq, uint16 rectCount, then per rect uint16 x, y, w, h followed by
+//   RGB565 pixels in row order as PackBits-style tokens until w*h are decoded:
+//   uint16 n with bit 15 set = one pixel repeated (n & 0x7FFF) times,
+//   otherwise n literal pixels follow.
+// seq only advances when the screen changed, so a client already at it gets no
+// rects. One whose since is older than the SCREEN_MIRROR_HISTORY generations
+// kept (or unknown, such as 0) gets one full-screen rect.
+void screenMirrorInit(const uint16_t* framebuffer, int width, int height);
+void screenMirrorOnFlush(const lv_area_t* area);
+void screenMirrorServe(WebServer& server);
+
+#endif // SCREENMIRROR_H
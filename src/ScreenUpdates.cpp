@@ -1,27 +1,186 @@
 
 #include "ScreenUpdates.h"
+#include "UIBindings.h"
 #include <Arduino.h>
 #include <cstdio>
+#include <esp_timer.h>
 
 extern Readings readings[];
 
-// Sets both the indicator and knob color of an arc widget in one call.
-static void setArcColor(lv_obj_t* arc, lv_color_t color) {
-    lv_obj_set_style_arc_color(arc, color, LV_PART_INDICATOR | LV_STATE_DEFAULT);
-    lv_obj_set_style_bg_color(arc, color, LV_PART_KNOB | LV_STATE_DEFAULT);
-}
 extern Weather weather;
+extern UV uv;
+extern AirQuality airQuality;
+extern InsideAirQuality insideAirQuality;
 extern Solar solar;
 extern QueueHandle_t statusMessageQueue;
-extern char statusMessageValue[];
+extern FixedString<STATUS_TEXT_LEN> statusMessageValue;
+
+// Maps a sensor battery voltage to its icon glyph and colour.
+void getBatteryStatus(float batteryValue, int readingIndex, char* iconChar, lv_color_t* colorPtr) {
+    if (batteryValue > BATTERY_OK) {
+        // Battery is ok
+        *iconChar = CHAR_BATTERY_GOOD;
+        *colorPtr = lv_color_hex(COLOR_GREEN);
+    } else if (batteryValue > BATTERY_BAD) {
+        // Battery is ok
+        *iconChar = CHAR_BATTERY_OK;
+        *colorPtr = lv_color_hex(COLOR_GREEN);
+    } else if (batteryValue > BATTERY_CRITICAL) {
+        // Battery is low, but not critical
+        *iconChar = CHAR_BATTERY_BAD;
+        *colorPtr = lv_color_hex(COLOR_YELLOW);
+    } else if (batteryValue > 0.0) {
+        // Battery is critical
+        *iconChar = CHAR_BATTERY_CRITICAL;
+        *colorPtr = lv_color_hex(COLOR_RED);
+    } else {
+        *iconChar = CHAR_BLANK;
+        *colorPtr = lv_color_hex(COLOR_GREEN);
+    }
+}
+
+// Updates room temperature, humidity, trend arrows and sensor battery icons.
+void updateRoomDisplay() {
+    if (!dirtyRooms)
+        return;
+    dirtyRooms = false;
+    BoundText tempString;
+    char batteryIcon;
+    lv_color_t batteryColor;
+    static Readings rooms[READING_COUNT]; // Loop task only; too large for its stack
+    roomsLock.read(rooms);
+    for (unsigned char i = 0; i < ROOM_COUNT; ++i) {
+        RoomBinding& room = roomBindings[i];
+        setBoundInt(room.tempValue, rooms[i].currentValue);
+        setBoundText(room.temp, rooms[i].output);
+        setBoundInt(room.tempState, (int32_t)rooms[i].readingState); // STALE selects the theme's stale colour
+        setBoundInt(room.tempVisible, rooms[i].readingState != ReadingState::NO_DATA);
+        tempString.format("%c", readingStateGlyph(rooms[i].readingState));
+        setBoundText(room.direction, tempString);
+        setBoundText(room.humidity, rooms[i + ROOM_COUNT].output);
+    }
+    for (unsigned char i = 0; i < ROOM_COUNT; ++i) {
+        getBatteryStatus(rooms[i + 2 * ROOM_COUNT].currentValue, (int)rooms[i + 2 * ROOM_COUNT].history.size(), &batteryIcon, &batteryColor);
+        tempString.format("%c", batteryIcon);
+        setBoundText(roomBindings[i].battery, tempString);
+        setBoundColor(roomBindings[i].batteryColor, batteryColor);
+    }
+}
+
+// Day/night flag from a weatherLock snapshot
+bool weatherIsDay() {
+    Weather current;
+    weatherLock.read(current);
+    return current.isDay;
+}
+
+// Updates the UV arc, label and update-time label.
+void updateUVDisplay() {
+    if (!dirtyUv)
+        return;
+    dirtyUv = false;
+    BoundText tempString;
+    UV current;
+    uvLock.read(current);
+    if (current.updateTime > 0) {
+        setBoundInt(uvBinding.visible, 1);
+        if (weatherIsDay()) {
+            tempString.format("Updated %s", current.timeString.c_str());
+        } else {
+            tempString.clear();
+        }
+        setBoundText(uvBinding.updateTime, tempString);
+        tempString.format("%i", current.index);
+        setBoundText(uvBinding.label, tempString);
+        setBoundInt(uvBinding.value, current.index * 10);
+        setBoundColor(uvBinding.color, lv_color_hex(uvColor(current.index)));
+    } else {
+        setBoundInt(uvBinding.visible, 0);
+        setBoundText(uvBinding.label, "--");
+        setBoundText(uvBinding.updateTime, "");
+    }
+}
+
+// Updates weather forecast labels, the temperature arc and the AQI display.
+void updateWeatherDisplay() {
+    if (!dirtyWeather)
+        return;
+    dirtyWeather = false;
+    BoundText tempString;
+    Weather current;
+    AirQuality aq;
+    weatherLock.read(current);
+    airQualityLock.read(aq);
+    if (current.updateTime > 0) {
+        setBoundText(weatherBinding.conditions, current.description);
+        tempString.format("Updated %s", current.timeString.c_str());
+        setBoundText(weatherBinding.updateTime, tempString);
+        tempString.format("Wind %2.0f km/h %s", current.windSpeed, current.windDir.c_str());
+        setBoundText(weatherBinding.wind, tempString);
+        if (aq.updateTime > 0) {
+            const char* aqiRating = getAQIRating(aq.europeanAqi);
+            tempString.format("AQI %d - %s", aq.europeanAqi, aqiRating);
+            setBoundText(weatherBinding.aqi, tempString);
+            tempString.format("AQI Updated %s", aq.timeString.c_str());
+            setBoundText(weatherBinding.aqiUpdateTime, tempString);
+        } else {
+            setBoundText(weatherBinding.aqi, "AQI --");
+            setBoundText(weatherBinding.aqiUpdateTime, "");
+        }
+        // The forecast range widened to include the current temperature
+        float minTemp = fminf(current.minTemp, current.temperature);
+        float maxTemp = fmaxf(current.maxTemp, current.temperature);
+        setBoundInt(weatherBinding.tempMin, minTemp);
+        setBoundInt(weatherBinding.tempMax, maxTemp);
+        setBoundInt(weatherBinding.tempValue, current.temperature);
+        tempString.format("%2.0f", current.temperature);
+        setBoundText(weatherBinding.temp, tempString);
+        tempString.format("%2.0f°C", minTemp);
+        setBoundText(weatherBinding.min, tempString);
+        tempString.format("%2.0f°C", maxTemp);
+        setBoundText(weatherBinding.max, tempString);
+        setBoundInt(weatherBinding.visible, 1);
+    }
+}
+
+// Updates CO2 and PM2.5 labels; the theme colours them red when stale.
+void updateInsideAQDisplay() {
+    if (!dirtyInsideAQ)
+        return;
+    dirtyInsideAQ = false;
+
+    BoundText tempString;
+    InsideAirQuality current;
+    insideAirQualityLock.read(current);
+
+    // CO2 label
+    if (current.co2State == ReadingState::NO_DATA) {
+        setBoundText(insideAQBinding.co2, "CO2: --");
+    } else {
+        char co2Buf[32];
+        formatIntegerWithCommas((long long)current.co2, co2Buf, sizeof(co2Buf));
+        tempString.format("CO2: %s", co2Buf);
+        setBoundText(insideAQBinding.co2, tempString);
+    }
+    setBoundInt(insideAQBinding.co2State, (int32_t)current.co2State);
+
+    // PM2.5 label
+    if (current.pm25State == ReadingState::NO_DATA) {
+        setBoundText(insideAQBinding.pm25, "PM2.5: --");
+    } else {
+        tempString.format("PM2.5: %.1f", current.pm25);
+        setBoundText(insideAQBinding.pm25, tempString);
+    }
+    setBoundInt(insideAQBinding.pm25State, (int32_t)current.pm25State);
+}
 
 // Updates battery arc color and the charge/discharge status labels.
 // Shows remaining time to empty (discharging) or full (charging).
-static void updateChargingStatus() {
-    char tempString[CHAR_LEN];
+static void updateChargingStatus(const Solar& solar) {
+    BoundText tempString;
     if (solar.batteryPower > BATTERY_POWER_DISCHARGE_THRESHOLD) {
-        snprintf(tempString, CHAR_LEN, "Discharging %2.1fkW", solar.batteryPower);
-        lv_label_set_text(ui_ChargingLabel, tempString);
+        tempString.format("Discharging %2.1fkW", solar.batteryPower);
+        setBoundText(solarBinding.chargingLabel, tempString);
 
         // Time remaining = usable capacity left / current draw rate
         // Usable capacity = (SoC% - min%) * total kWh; power is in kW
@@ -34,23 +193,23 @@ static void updateChargingStatus() {
         int wholeMins = remainMinutesRound % 60;
 
         time_t endTime = solar.currentUpdateTime + remainMinutesRound * 60;
-        char timeBufEnd[CHAR_LEN];
+        char timeBufEnd[TIME_STRING_LEN + 1];
         formatTimeHMS(endTime, timeBufEnd, sizeof(timeBufEnd));
 
         if (remainMinutesRound > 0 && remainHours < MAX_SOLAR_TIME_STATUS_HOURS) {
             if (wholeHours > 0) {
-                snprintf(tempString, CHAR_LEN, "%d %s %d mins\n remaining\n Until %s", wholeHours, (wholeHours == 1) ? "hour" : "hours", wholeMins, timeBufEnd);
+                tempString.format("%d %s %d mins\n remaining\n Until %s", wholeHours, (wholeHours == 1) ? "hour" : "hours", wholeMins, timeBufEnd);
             } else {
-                snprintf(tempString, CHAR_LEN, "%d mins\n remaining\n Until %s", wholeMins, timeBufEnd);
+                tempString.format("%d mins\n remaining\n Until %s", wholeMins, timeBufEnd);
             }
         } else {
-            tempString[0] = '\0'; // Don't print for too long time
+            tempString.clear(); // Don't print for too long time
         }
-        lv_label_set_text(ui_ChargingTime, tempString);
-        setArcColor(ui_BatteryArc, lv_color_hex(COLOR_RED));
+        setBoundText(solarBinding.chargingTime, tempString);
+        setBoundColor(solarBinding.batteryArcColor, lv_color_hex(COLOR_RED));
     } else if (solar.batteryPower < BATTERY_POWER_CHARGE_THRESHOLD) {
-        snprintf(tempString, CHAR_LEN, "Charging %2.1fkW", -solar.batteryPower);
-        lv_label_set_text(ui_ChargingLabel, tempString);
+        tempString.format("Charging %2.1fkW", -solar.batteryPower);
+        setBoundText(solarBinding.chargingLabel, tempString);
 
         // Time to full = remaining capacity to fill / charge rate (batteryPower is negative when charging)
         float remainHours = -(BATTERY_CHARGE_FULL_THRESHOLD - solar.batteryCharge / 100) * BATTERY_CAPACITY / solar.batteryPower;
@@ -61,28 +220,28 @@ static void updateChargingStatus() {
 
         if (remainMinutesRound > 0 && remainHours < MAX_SOLAR_TIME_STATUS_HOURS) {
             if (wholeHours > 0) {
-                snprintf(tempString, CHAR_LEN, "%d %s %d mins to\n fully charged", wholeHours, (wholeHours == 1) ? "hour" : "hours", wholeMins);
+                tempString.format("%d %s %d mins to\n fully charged", wholeHours, (wholeHours == 1) ? "hour" : "hours", wholeMins);
             } else {
-                snprintf(tempString, CHAR_LEN, "%d mins to\n fully charged", wholeMins);
+                tempString.format("%d mins to\n fully charged", wholeMins);
             }
         } else {
-            tempString[0] = '\0'; // Don't print for too long time
+            tempString.clear(); // Don't print for too long time
         }
-        lv_label_set_text(ui_ChargingTime, tempString);
-        setArcColor(ui_BatteryArc, lv_color_hex(COLOR_GREEN));
+        setBoundText(solarBinding.chargingTime, tempString);
+        setBoundColor(solarBinding.batteryArcColor, lv_color_hex(COLOR_GREEN));
     } else {
-        lv_label_set_text(ui_ChargingLabel, "");
-        lv_label_set_text(ui_ChargingTime, "");
-        setArcColor(ui_BatteryArc, lv_color_hex(COLOR_BATTERY_IDLE));
+        setBoundText(solarBinding.chargingLabel, "");
+        setBoundText(solarBinding.chargingTime, "");
+        setBoundColor(solarBinding.batteryArcColor, lv_color_hex(COLOR_BATTERY_IDLE));
     }
-    setArcColor(ui_SolarArc, lv_color_hex(COLOR_GREEN));
+    setBoundColor(solarBinding.solarArcColor, lv_color_hex(COLOR_GREEN));
 }
 
 // Updates grid energy totals, Rand cost and self-sufficiency percentage labels.
-static void updateGridMetrics() {
+static void updateGridMetrics(const Solar& solar) {
     if (solar.todayUse <= 0.0 && solar.monthUse <= 0.0)
         return;
-    char tempString[CHAR_LEN];
+    BoundText tempString;
     char boughtTodayBuf[32];
     char boughtMonthBuf[32];
 
@@ -97,102 +256,387 @@ static void updateGridMetrics() {
     todayGridPercentage = todayGridPercentage > 100 ? 100 : (todayGridPercentage < 0 ? 0 : todayGridPercentage);
     monthGridPercentage = monthGridPercentage > 100 ? 100 : (monthGridPercentage < 0 ? 0 : monthGridPercentage);
 
-    snprintf(tempString, CHAR_LEN, "%.0f", solar.todayBuy);
-    lv_label_set_text(ui_GridTodayEnergy, tempString);
-    snprintf(tempString, CHAR_LEN, "%.0f", solar.monthBuy);
-    lv_label_set_text(ui_GridMonthEnergy, tempString);
-    snprintf(tempString, CHAR_LEN, "R%s", boughtTodayBuf);
-    lv_label_set_text(ui_GridTodayCost, tempString);
-    snprintf(tempString, CHAR_LEN, "R%s", boughtMonthBuf);
-    lv_label_set_text(ui_GridMonthCost, tempString);
-    snprintf(tempString, CHAR_LEN, "%d%%", todayGridPercentage);
-    lv_label_set_text(ui_GridTodayPercentage, tempString);
-    snprintf(tempString, CHAR_LEN, "%d%%", monthGridPercentage);
-    lv_label_set_text(ui_GridMonthPercentage, tempString);
-
-    snprintf(tempString, CHAR_LEN, "%.0f", solar.todayGeneration);
-    lv_label_set_text(ui_SolarTodayEnergy, tempString);
-    snprintf(tempString, CHAR_LEN, "%.0f", solar.monthGeneration);
-    lv_label_set_text(ui_SolarMonthEnergy, tempString);
-}
-
-// Updates all solar-related LVGL widgets: battery/solar/usage arcs and labels,
+    tempString.format("%.0f", solar.todayBuy);
+    setBoundText(solarBinding.gridTodayEnergy, tempString);
+    tempString.format("%.0f", solar.monthBuy);
+    setBoundText(solarBinding.gridMonthEnergy, tempString);
+    tempString.format("R%s", boughtTodayBuf);
+    setBoundText(solarBinding.gridTodayCost, tempString);
+    tempString.format("R%s", boughtMonthBuf);
+    setBoundText(solarBinding.gridMonthCost, tempString);
+    tempString.format("%d%%", todayGridPercentage);
+    setBoundText(solarBinding.gridTodayPercentage, tempString);
+    tempString.format("%d%%", monthGridPercentage);
+    setBoundText(solarBinding.gridMonthPercentage, tempString);
+
+    tempString.format("%.0f", solar.todayGeneration);
+    setBoundText(solarBinding.solarTodayEnergy, tempString);
+    tempString.format("%.0f", solar.monthGeneration);
+    setBoundText(solarBinding.solarMonthEnergy, tempString);
+}
+
+// Publishes all solar-related values to their bound widgets: battery/solar/usage arcs and labels,
 // charge/discharge status and estimated time remaining, daily min/max battery,
 // grid energy totals, cost (in Rand), and self-sufficiency percentages.
 // Does nothing if solar data has never been received (currentUpdateTime == 0).
 void set_solar_values() {
-    if (solar.currentUpdateTime == 0)
+    Solar current;
+    solarLock.read(current);
+    if (current.currentUpdateTime == 0)
         return;
-    char tempString[CHAR_LEN];
-    xSemaphoreTake(dataMutex, portMAX_DELAY);
+    BoundText tempString;
 
-    lv_obj_clear_flag(ui_BatteryArc, LV_OBJ_FLAG_HIDDEN);
-    lv_obj_clear_flag(ui_SolarArc, LV_OBJ_FLAG_HIDDEN);
-    lv_obj_clear_flag(ui_UsingArc, LV_OBJ_FLAG_HIDDEN);
+    setBoundInt(solarBinding.visible, 1);
 
-    lv_arc_set_value(ui_BatteryArc, solar.batteryCharge);
-    snprintf(tempString, CHAR_LEN, "%2.0f%%", solar.batteryCharge);
-    lv_label_set_text(ui_BatteryLabel, tempString);
+    setBoundInt(solarBinding.batteryValue, current.batteryCharge);
+    tempString.format("%2.0f%%", current.batteryCharge);
+    setBoundText(solarBinding.batteryLabel, tempString);
 
-    lv_arc_set_value(ui_SolarArc, solar.solarPower * POWER_ARC_SCALE);
-    snprintf(tempString, CHAR_LEN, "%2.1fkW", solar.solarPower);
-    lv_label_set_text(ui_SolarLabel, tempString);
+    setBoundInt(solarBinding.solarValue, current.solarPower * POWER_ARC_SCALE);
+    tempString.format("%2.1fkW", current.solarPower);
+    setBoundText(solarBinding.solarLabel, tempString);
 
-    lv_arc_set_value(ui_UsingArc, solar.usingPower * POWER_ARC_SCALE);
-    snprintf(tempString, CHAR_LEN, "%2.1fkW", solar.usingPower);
-    lv_label_set_text(ui_UsingLabel, tempString);
+    setBoundInt(solarBinding.usingValue, current.usingPower * POWER_ARC_SCALE);
+    tempString.format("%2.1fkW", current.usingPower);
+    setBoundText(solarBinding.usingLabel, tempString);
 
-    updateChargingStatus();
+    updateChargingStatus(current);
 
-    snprintf(tempString, CHAR_LEN, "Min %2.0f\nMax %2.0f", solar.todayBatteryMin, solar.todayBatteryMax);
-    lv_label_set_text(ui_SolarMinMax, tempString);
+    tempString.format("Min %2.0f\nMax %2.0f", current.todayBatteryMin, current.todayBatteryMax);
+    setBoundText(solarBinding.minMax, tempString);
 
-    char timeBuf[CHAR_LEN];
-    formatTimeHMS(solar.currentUpdateTime, timeBuf, sizeof(timeBuf));
-    snprintf(tempString, CHAR_LEN, "Values as of %s\nReceived at %s", solar.time, timeBuf);
-    lv_label_set_text(ui_AsofTimeLabel, tempString);
+    char timeBuf[TIME_STRING_LEN + 1];
+    formatTimeHMS(current.currentUpdateTime, timeBuf, sizeof(timeBuf));
+    tempString.format("Values as of %s\nReceived at %s", current.time.c_str(), timeBuf);
+    setBoundText(solarBinding.asOf, tempString);
 
-    updateGridMetrics();
-    xSemaphoreGive(dataMutex);
+    updateGridMetrics(current);
 }
 
-// Sets all text fields to the given color for day/night mode.
-void set_basic_text_color(lv_color_t color) {
+// Day/night theme. theme_init() attaches these shared styles once; apply_theme()
+// changes their properties and reports the change, so a switch restyles every
+// themed object in one pass instead of one local style write per object.
+static lv_style_t textStyle;         // TEXT_COLOR_LABELS default text colour
+static lv_style_t staleTextStyle;    // STATE_STALE: reading is stale
+static lv_style_t alertTextStyle;    // STATE_ALERT: value needs attention
+static lv_style_t arcTrackStyle;     // Arc background track
+static lv_style_t arcIndicatorStyle; // Arc indicator opacity
+static lv_style_t screenStyle;       // Screen background
+static lv_style_t containerStyle;    // Container borders
+static bool themeIsNight = false;
+
+// Every arc that follows the day/night theme
+static lv_obj_t** const themedArcs[] = {&ui_TempArc1, &ui_TempArc2, &ui_TempArc3, &ui_TempArc4, &ui_TempArc5, &ui_TempArcFC,
+                                        &ui_BatteryArc, &ui_SolarArc, &ui_UsingArc, &ui_UVArc};
+static const size_t THEMED_ARC_COUNT = sizeof(themedArcs) / sizeof(themedArcs[0]);
+
+// Creates the theme styles and attaches them. The SquareLine export sets some of
+// the same properties as local styles, which would override the shared ones, so
+// those are removed here. Call once after ui_init(), then apply_theme().
+void theme_init() {
+    lv_style_init(&textStyle);
+    lv_style_init(&staleTextStyle);
+    lv_style_init(&alertTextStyle);
+    lv_style_init(&arcTrackStyle);
+    lv_style_init(&arcIndicatorStyle);
+    lv_style_init(&screenStyle);
+    lv_style_init(&containerStyle);
+    lv_style_set_text_color(&staleTextStyle, lv_color_hex(COLOR_STALE));
+    lv_style_set_text_color(&alertTextStyle, lv_color_hex(COLOR_RED));
+
     lv_obj_t** elements[] = TEXT_COLOR_LABELS;
     for (size_t i = 0; i < sizeof(elements) / sizeof(elements[0]); i++) {
-        lv_obj_set_style_text_color(*elements[i], color, LV_PART_MAIN);
+        lv_obj_remove_local_style_prop(*elements[i], LV_STYLE_TEXT_COLOR, LV_PART_MAIN);
+        lv_obj_add_style(*elements[i], &textStyle, LV_PART_MAIN);
+    }
+    lv_obj_add_style(ui_WiFiIcon, &textStyle, LV_PART_MAIN);
+
+    // Labels whose binding can flag them stale or alert (see UIBindings.cpp)
+    lv_obj_t** tempLabels[ROOM_COUNT] = TEMP_LABELS;
+    for (int i = 0; i < ROOM_COUNT; i++) {
+        lv_obj_add_style(*tempLabels[i], &staleTextStyle, LV_PART_MAIN | STATE_STALE);
+    }
+    lv_obj_add_style(ui_InsideAirQualityCO2, &alertTextStyle, LV_PART_MAIN | STATE_ALERT);
+    lv_obj_add_style(ui_InsideAirQualityPM25, &alertTextStyle, LV_PART_MAIN | STATE_ALERT);
+    lv_obj_add_style(ui_WiFiIcon, &alertTextStyle, LV_PART_MAIN | STATE_ALERT);
+
+    for (size_t i = 0; i < THEMED_ARC_COUNT; i++) {
+        lv_obj_remove_local_style_prop(*themedArcs[i], LV_STYLE_ARC_COLOR, LV_PART_MAIN);
+        lv_obj_remove_local_style_prop(*themedArcs[i], LV_STYLE_ARC_OPA, LV_PART_INDICATOR);
+        lv_obj_add_style(*themedArcs[i], &arcTrackStyle, LV_PART_MAIN);
+        lv_obj_add_style(*themedArcs[i], &arcIndicatorStyle, LV_PART_INDICATOR);
     }
+
+    lv_obj_remove_local_style_prop(lv_scr_act(), LV_STYLE_BG_COLOR, LV_PART_MAIN);
+    lv_obj_add_style(lv_scr_act(), &screenStyle, LV_PART_MAIN);
+    lv_obj_remove_local_style_prop(ui_Container1, LV_STYLE_BORDER_COLOR, LV_PART_MAIN);
+    lv_obj_remove_local_style_prop(ui_Container2, LV_STYLE_BORDER_COLOR, LV_PART_MAIN);
+    lv_obj_add_style(ui_Container1, &containerStyle, LV_PART_MAIN);
+    lv_obj_add_style(ui_Container2, &containerStyle, LV_PART_MAIN);
 }
 
-// Sets arc colors for day/night mode
-void set_arc_night_mode(bool isNight) {
-    uint32_t trackColor = isNight ? COLOR_ARC_TRACK_NIGHT : COLOR_ARC_TRACK_DAY;
-    lv_opa_t indicatorOpa = isNight ? ARC_OPACITY_NIGHT : ARC_OPACITY_DAY;
+// Switches the shared styles to the night or day palette and has LVGL restyle
+// the objects using them.
+void apply_theme(bool isNight) {
+    themeIsNight = isNight;
+    lv_color_t foreground = lv_color_hex(isNight ? COLOR_WHITE : COLOR_BLACK);
+    lv_style_set_text_color(&textStyle, foreground);
+    lv_style_set_arc_color(&arcTrackStyle, lv_color_hex(isNight ? COLOR_ARC_TRACK_NIGHT : COLOR_ARC_TRACK_DAY));
+    lv_style_set_arc_opa(&arcIndicatorStyle, isNight ? ARC_OPACITY_NIGHT : ARC_OPACITY_DAY);
+    lv_style_set_bg_color(&screenStyle, lv_color_hex(isNight ? COLOR_BLACK : COLOR_WHITE));
+    lv_style_set_border_color(&containerStyle, foreground);
+    lv_obj_report_style_change(nullptr);
+    static_layer_sync();
+}
 
-    // Temperature arcs (rooms) - use the same macro as main.cpp
-    lv_obj_t** tempArcs[ROOM_COUNT] = TEMP_ARC_LABELS;
-    for (int i = 0; i < ROOM_COUNT; i++) {
-        lv_obj_set_style_arc_color(*tempArcs[i], lv_color_hex(trackColor), LV_PART_MAIN | LV_STATE_DEFAULT);
-        lv_obj_set_style_arc_opa(*tempArcs[i], indicatorOpa, LV_PART_INDICATOR | LV_STATE_DEFAULT);
+// Static background layer: a pre-rendered full-screen RGB565 image in PSRAM
+// holding the screen background, container borders, title labels and the arc
+// tracks. While it is shown those objects are hidden and the track style is
+// transparent, so redrawing an arc after a value change blits the background
+// from the image and anti-aliases only the indicator and knob. There is one
+// buffer, baked for the current theme; it is re-baked when the theme changes
+// (from apply_theme) or an arc is shown or hidden (from its visibility subject).
+struct StaticLayer {
+    lv_draw_buf_t buf;
+    uint8_t* data;
+    bool baked;
+    bool night;       // Theme it was baked for
+    uint32_t arcMask; // themedArcs that were visible when baked
+};
+static StaticLayer staticLayer;
+static lv_obj_t* staticLayerImage = nullptr;
+static bool staticLayerShown = false;
+
+// Children of ui_Screen1 whose look never changes after setup()
+static lv_obj_t** const staticObjects[] = {&ui_Container1,       &ui_Container2,  &ui_RoomName1,  &ui_RoomName2,   &ui_RoomName3,    &ui_RoomName4,
+                                           &ui_RoomName5,        &ui_TextRooms,   &ui_TextUV,     &ui_TextBattery, &ui_TextSolar,    &ui_TextUsing,
+                                           &ui_TextKlaussometer, &ui_GridBought,  &ui_GridTitlekWh, &ui_GridTitleCost, &ui_GridTitleSolar, &ui_GridTitlePercentage,
+                                           &ui_TextForecastName};
+static const size_t STATIC_OBJECT_COUNT = sizeof(staticObjects) / sizeof(staticObjects[0]);
+
+static bool is_static_object(lv_obj_t* obj) {
+    for (size_t i = 0; i < STATIC_OBJECT_COUNT; i++) {
+        if (*staticObjects[i] == obj) {
+            return true;
+        }
     }
+    return false;
+}
 
-    // Forecast temp arc
-    lv_obj_set_style_arc_color(ui_TempArcFC, lv_color_hex(trackColor), LV_PART_MAIN | LV_STATE_DEFAULT);
-    lv_obj_set_style_arc_opa(ui_TempArcFC, indicatorOpa, LV_PART_INDICATOR | LV_STATE_DEFAULT);
+static uint32_t visible_arc_mask() {
+    uint32_t mask = 0;
+    for (size_t i = 0; i < THEMED_ARC_COUNT; i++) {
+        if (!lv_obj_has_flag(*themedArcs[i], LV_OBJ_FLAG_HIDDEN)) {
+            mask |= 1u << i;
+        }
+    }
+    return mask;
+}
+
+// Switches between drawing the static parts from the cached image and drawing
+// them object by object.
+static void show_static_layer(bool show) {
+    staticLayerShown = show;
+    for (size_t i = 0; i < STATIC_OBJECT_COUNT; i++) {
+        lv_obj_update_flag(*staticObjects[i], LV_OBJ_FLAG_HIDDEN, show);
+    }
+    if (show) {
+        lv_image_set_src(staticLayerImage, &staticLayer.buf);
+        lv_obj_invalidate(staticLayerImage); // Same buffer, possibly re-baked
+    }
+    lv_obj_update_flag(staticLayerImage, LV_OBJ_FLAG_HIDDEN, !show);
+    lv_style_set_arc_opa(&arcTrackStyle, show ? LV_OPA_TRANSP : LV_OPA_COVER);
+    lv_style_set_bg_opa(&screenStyle, show ? LV_OPA_TRANSP : LV_OPA_COVER);
+    lv_obj_report_style_change(&arcTrackStyle);
+    lv_obj_report_style_change(&screenStyle);
+}
+
+// Renders the current theme's static parts into the layer: everything that
+// changes at runtime is hidden for the snapshot, arc indicators and knobs are
+// made transparent, then it is all put back as it was, local styles included.
+static void bake_static_layer(StaticLayer& layer) {
+    show_static_layer(false);
+
+    static const uint32_t MAX_CHILDREN = 128;
+    bool hidden[MAX_CHILDREN];
+    uint32_t childCount = min(lv_obj_get_child_count(ui_Screen1), MAX_CHILDREN);
+    for (uint32_t i = 0; i < childCount; i++) {
+        lv_obj_t* child = lv_obj_get_child(ui_Screen1, i);
+        hidden[i] = lv_obj_has_flag(child, LV_OBJ_FLAG_HIDDEN);
+        if (!is_static_object(child) && !lv_obj_check_type(child, &lv_arc_class)) {
+            lv_obj_add_flag(child, LV_OBJ_FLAG_HIDDEN);
+        }
+    }
+    lv_style_value_t knobOpa[THEMED_ARC_COUNT];
+    bool knobOpaLocal[THEMED_ARC_COUNT];
+    for (size_t i = 0; i < THEMED_ARC_COUNT; i++) {
+        knobOpaLocal[i] = lv_obj_get_local_style_prop(*themedArcs[i], LV_STYLE_BG_OPA, &knobOpa[i], LV_PART_KNOB) == LV_STYLE_RES_FOUND;
+        lv_obj_set_style_bg_opa(*themedArcs[i], LV_OPA_TRANSP, LV_PART_KNOB | LV_STATE_DEFAULT);
+    }
+    lv_style_set_arc_opa(&arcIndicatorStyle, LV_OPA_TRANSP);
+    lv_obj_report_style_change(&arcIndicatorStyle);
+
+    layer.baked = lv_snapshot_take_to_draw_buf(ui_Screen1, LV_COLOR_FORMAT_RGB565, &layer.buf) == LV_RESULT_OK;
+    layer.night = themeIsNight;
+    layer.arcMask = visible_arc_mask();
+
+    lv_style_set_arc_opa(&arcIndicatorStyle, themeIsNight ? ARC_OPACITY_NIGHT : ARC_OPACITY_DAY);
+    lv_obj_report_style_change(&arcIndicatorStyle);
+    for (size_t i = 0; i < THEMED_ARC_COUNT; i++) {
+        if (knobOpaLocal[i]) {
+            lv_obj_set_local_style_prop(*themedArcs[i], LV_STYLE_BG_OPA, knobOpa[i], LV_PART_KNOB);
+        } else {
+            lv_obj_remove_local_style_prop(*themedArcs[i], LV_STYLE_BG_OPA, LV_PART_KNOB);
+        }
+    }
+    for (uint32_t i = 0; i < childCount; i++) {
+        lv_obj_update_flag(lv_obj_get_child(ui_Screen1, i), LV_OBJ_FLAG_HIDDEN, hidden[i]);
+    }
+}
+
+// Runs after the flag bindings on the same subject (static_layer_init() is
+// called after uiBindingsInit()), so the arc has already been shown or hidden
+static void arc_visibility_observer(lv_observer_t* observer, lv_subject_t* subject) {
+    (void)observer;
+    (void)subject;
+    static_layer_sync();
+}
+
+// Allocates the layer in PSRAM, adds the image that shows it behind every other
+// object and watches the arcs' visibility subjects. Call once at the end of
+// setup(), after the static labels have their text and uiBindingsInit().
+// Without the memory the UI keeps drawing everything directly.
+void static_layer_init() {
+    size_t stride = LCD_WIDTH * sizeof(uint16_t);
+    staticLayer.data = (uint8_t*)heap_caps_malloc(stride * LCD_HEIGHT, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+    if (!staticLayer.data) {
+        logAndPublish("Static layer: PSRAM allocation failed, drawing directly");
+        return;
+    }
+    lv_draw_buf_init(&staticLayer.buf, LCD_WIDTH, LCD_HEIGHT, LV_COLOR_FORMAT_RGB565, stride, staticLayer.data, stride * LCD_HEIGHT);
+    staticLayer.baked = false;
+    staticLayerImage = lv_image_create(ui_Screen1);
+    lv_obj_move_to_index(staticLayerImage, 0);
+    lv_obj_set_pos(staticLayerImage, 0, 0);
+    lv_obj_add_flag(staticLayerImage, LV_OBJ_FLAG_HIDDEN);
+    static_layer_sync();
+
+    for (RoomBinding& room : roomBindings) {
+        lv_subject_add_observer(&room.tempVisible, arc_visibility_observer, nullptr);
+    }
+    lv_subject_add_observer(&weatherBinding.visible, arc_visibility_observer, nullptr);
+    lv_subject_add_observer(&uvBinding.visible, arc_visibility_observer, nullptr);
+    lv_subject_add_observer(&solarBinding.visible, arc_visibility_observer, nullptr);
+}
+
+// Shows the layer, baking it first if it hasn't been rendered for the current
+// theme or an arc has appeared or disappeared since. Cheap when nothing
+// changed. Called from apply_theme() and on arc visibility changes.
+void static_layer_sync() {
+    if (!staticLayerImage) {
+        return;
+    }
+    if (!staticLayer.baked || staticLayer.night != themeIsNight || staticLayer.arcMask != visible_arc_mask()) {
+        bake_static_layer(staticLayer);
+        if (!staticLayer.baked) {
+            return; // show_static_layer(false) already left it drawing directly
+        }
+    } else if (staticLayerShown) {
+        return;
+    }
+    show_static_layer(true);
+}
 
-    // Battery, Solar, Using arcs
-    lv_obj_set_style_arc_color(ui_BatteryArc, lv_color_hex(trackColor), LV_PART_MAIN | LV_STATE_DEFAULT);
-    lv_obj_set_style_arc_opa(ui_BatteryArc, indicatorOpa, LV_PART_INDICATOR | LV_STATE_DEFAULT);
+// Times redrawing every arc with the static parts drawn directly and from the
+// layer, over STATIC_LAYER_BENCH_PASSES passes each. Run from /benchmark?name=layer.
+void benchmark_static_layer(char* report, size_t reportLen) {
+    lv_lock();
+    if (!staticLayerImage || !staticLayer.baked) {
+        lv_unlock();
+        snprintf(report, reportLen, "Static layer unavailable");
+        return;
+    }
+    uint32_t passUs[2];
+    for (int cached = 0; cached < 2; cached++) {
+        show_static_layer(cached);
+        lv_refr_now(nullptr);
+        int64_t start = esp_timer_get_time();
+        for (int pass = 0; pass < STATIC_LAYER_BENCH_PASSES; pass++) {
+            for (size_t i = 0; i < THEMED_ARC_COUNT; i++) {
+                lv_obj_invalidate(*themedArcs[i]);
+            }
+            lv_refr_now(nullptr);
+        }
+        passUs[cached] = (uint32_t)((esp_timer_get_time() - start) / STATIC_LAYER_BENCH_PASSES);
+    }
+    lv_unlock();
 
-    lv_obj_set_style_arc_color(ui_SolarArc, lv_color_hex(trackColor), LV_PART_MAIN | LV_STATE_DEFAULT);
-    lv_obj_set_style_arc_opa(ui_SolarArc, indicatorOpa, LV_PART_INDICATOR | LV_STATE_DEFAULT);
+    snprintf(report, reportLen, "Arc redraw (%u arcs): direct %lu us, static layer %lu us per pass", (unsigned)THEMED_ARC_COUNT,
+             (unsigned long)passUs[0], (unsigned long)passUs[1]);
+    logAndPublish(report);
+}
 
-    lv_obj_set_style_arc_color(ui_UsingArc, lv_color_hex(trackColor), LV_PART_MAIN | LV_STATE_DEFAULT);
-    lv_obj_set_style_arc_opa(ui_UsingArc, indicatorOpa, LV_PART_INDICATOR | LV_STATE_DEFAULT);
+// The pre-theme switch path: per-object local style writes. Kept only so
+// benchmark_theme_switch() can compare it against apply_theme().
+static void legacy_local_styles(bool isNight) {
+    lv_color_t foreground = lv_color_hex(isNight ? COLOR_WHITE : COLOR_BLACK);
+    lv_obj_t** elements[] = TEXT_COLOR_LABELS;
+    for (size_t i = 0; i < sizeof(elements) / sizeof(elements[0]); i++) {
+        lv_obj_set_style_text_color(*elements[i], foreground, LV_PART_MAIN);
+    }
+    for (size_t i = 0; i < THEMED_ARC_COUNT; i++) {
+        lv_obj_set_style_arc_color(*themedArcs[i], lv_color_hex(isNight ? COLOR_ARC_TRACK_NIGHT : COLOR_ARC_TRACK_DAY), LV_PART_MAIN | LV_STATE_DEFAULT);
+        lv_obj_set_style_arc_opa(*themedArcs[i], isNight ? ARC_OPACITY_NIGHT : ARC_OPACITY_DAY, LV_PART_INDICATOR | LV_STATE_DEFAULT);
+    }
+    lv_obj_set_style_bg_color(lv_scr_act(), lv_color_hex(isNight ? COLOR_BLACK : COLOR_WHITE), LV_STATE_DEFAULT);
+    lv_obj_set_style_border_color(ui_Container1, foreground, LV_STATE_DEFAULT);
+    lv_obj_set_style_border_color(ui_Container2, foreground, LV_STATE_DEFAULT);
+}
+
+// Drops the local styles legacy_local_styles() added so the theme applies again.
+static void remove_legacy_local_styles() {
+    lv_obj_t** elements[] = TEXT_COLOR_LABELS;
+    for (size_t i = 0; i < sizeof(elements) / sizeof(elements[0]); i++) {
+        lv_obj_remove_local_style_prop(*elements[i], LV_STYLE_TEXT_COLOR, LV_PART_MAIN);
+    }
+    for (size_t i = 0; i < THEMED_ARC_COUNT; i++) {
+        lv_obj_remove_local_style_prop(*themedArcs[i], LV_STYLE_ARC_COLOR, LV_PART_MAIN);
+        lv_obj_remove_local_style_prop(*themedArcs[i], LV_STYLE_ARC_OPA, LV_PART_INDICATOR);
+    }
+    lv_obj_remove_local_style_prop(lv_scr_act(), LV_STYLE_BG_COLOR, LV_PART_MAIN);
+    lv_obj_remove_local_style_prop(ui_Container1, LV_STYLE_BORDER_COLOR, LV_PART_MAIN);
+    lv_obj_remove_local_style_prop(ui_Container2, LV_STYLE_BORDER_COLOR, LV_PART_MAIN);
+}
 
-    // UV arc
-    lv_obj_set_style_arc_color(ui_UVArc, lv_color_hex(trackColor), LV_PART_MAIN | LV_STATE_DEFAULT);
-    lv_obj_set_style_arc_opa(ui_UVArc, indicatorOpa, LV_PART_INDICATOR | LV_STATE_DEFAULT);
+// Times a switch to the opposite theme and the full redraw that follows, first
+// through per-object local styles and then through the shared styles, and
+// restores the current theme afterwards. Run from the /benchmark?name=theme endpoint.
+void benchmark_theme_switch(char* report, size_t reportLen) {
+    lv_lock();
+    bool isNight = themeIsNight;
+
+    int64_t start = esp_timer_get_time();
+    legacy_local_styles(!isNight);
+    uint32_t legacyStyleUs = (uint32_t)(esp_timer_get_time() - start);
+    lv_refr_now(nullptr);
+    uint32_t legacyTotalUs = (uint32_t)(esp_timer_get_time() - start);
+    remove_legacy_local_styles();
+    refreshBoundColors(); // Status colours on themed labels were overwritten too
+    lv_refr_now(nullptr);
+
+    start = esp_timer_get_time();
+    apply_theme(!isNight);
+    uint32_t themeStyleUs = (uint32_t)(esp_timer_get_time() - start);
+    lv_refr_now(nullptr);
+    uint32_t themeTotalUs = (uint32_t)(esp_timer_get_time() - start);
+
+    apply_theme(isNight);
+    lv_refr_now(nullptr);
+    lv_unlock();
+
+    snprintf(report, reportLen, "Theme switch: local styles %lu us + redraw = %lu ms; shared styles %lu us + redraw = %lu ms",
+             (unsigned long)legacyStyleUs, (unsigned long)(legacyTotalUs / 1000), (unsigned long)themeStyleUs, (unsigned long)(themeTotalUs / 1000));
+    logAndPublish(report);
 }
 
 // FreeRTOS task: dequeues status messages and displays each one for its requested
@@ -203,19 +647,19 @@ void displayStatusMessages_t(void* pvParameters) {
     unsigned long lastHwmLog = 0;
     while (true) {
         if (xQueueReceive(statusMessageQueue, &receivedMsg, pdMS_TO_TICKS(STATUS_MESSAGE_QUEUE_TIMEOUT_MS)) == pdTRUE) {
-            xSemaphoreTake(dataMutex, portMAX_DELAY);
-            snprintf(statusMessageValue, CHAR_LEN, "%s", receivedMsg.text);
-            xSemaphoreGive(dataMutex);
+            statusLock.beginWrite();
+            statusMessageValue = receivedMsg.text.c_str();
+            statusLock.endWrite();
+            markDirty(dirtyStatusMessage);
             vTaskDelay(pdMS_TO_TICKS(receivedMsg.durationSec * 1000));
-            xSemaphoreTake(dataMutex, portMAX_DELAY);
-            statusMessageValue[0] = '\0';
-            xSemaphoreGive(dataMutex);
+            statusLock.beginWrite();
+            statusMessageValue.clear();
+            statusLock.endWrite();
+            markDirty(dirtyStatusMessage);
         }
         if (millis() - lastHwmLog > HWM_LOG_INTERVAL_MS) {
             lastHwmLog = millis();
-            char hwmMsg[CHAR_LEN];
-            snprintf(hwmMsg, CHAR_LEN, "Stack HWM: Display Status %u words", uxTaskGetStackHighWaterMark(nullptr));
-            logAndPublish(hwmMsg);
+            logStackHighWaterMark("Display Status");
         }
     }
 }
\ No newline at end of file
@@ -6,9 +6,24 @@
 #include "utils.h"
 #include <lvgl.h>
 
+// Object states that select the theme's stale and alert text styles
+static const lv_state_t STATE_STALE = LV_STATE_USER_1;
+static const lv_state_t STATE_ALERT = LV_STATE_USER_2;
+
+// Dirty-flag driven widget updates, called from loop() with the LVGL lock held
+void updateRoomDisplay();
+void updateUVDisplay();
+void updateWeatherDisplay();
+void updateInsideAQDisplay();
+void getBatteryStatus(float batteryValue, int readingIndex, char* iconChar, lv_color_t* colorPtr);
 void set_solar_values();
-void set_basic_text_color(lv_color_t color);
-void set_arc_night_mode(bool isNight);
+bool weatherIsDay();
+void theme_init();
+void apply_theme(bool isNight);
+void benchmark_theme_switch(char* report, size_t reportLen);
+void static_layer_init();
+void static_layer_sync();
+void benchmark_static_layer(char* report, size_t reportLen);
 void displayStatusMessages_t(void* pvParameters);
 
 #endif // SCREENUPDATES_H
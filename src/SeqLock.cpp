@@ -0,0 +1,119 @@
+#include "SeqLock.h"
+#include "types.h"
+#include <Arduino.h>
+#include <esp_timer.h>
+
+// One producer and one display reader sharing a Solar-sized group, guarded
+// either by a mutex the reader holds across its render (the old shared data
+// mutex) or by a SeqLock the reader only touches to copy a snapshot.
+struct SeqLockBench {
+    Solar data;
+    SeqLock<Solar> lock;
+    SemaphoreHandle_t mutex;
+    SemaphoreHandle_t writerDone;
+    volatile bool running;
+    bool useSeqLock;
+    uint32_t writes;
+    uint64_t totalWaitUs;
+    uint32_t maxWaitUs;
+
+    SeqLockBench() : data(), lock(data), mutex(nullptr), writerDone(nullptr), running(false), useSeqLock(false), writes(0), totalWaitUs(0), maxWaitUs(0) {}
+};
+
+static void busyWaitUs(uint32_t us) {
+    int64_t end = esp_timer_get_time() + us;
+    while (esp_timer_get_time() < end) {
+    }
+}
+
+// FreeRTOS task (other core, MQTT priority): one small update per tick, timing
+// how long each write waited to get in.
+static void seqLockBenchWriter_t(void* pvParameters) {
+    SeqLockBench* bench = (SeqLockBench*)pvParameters;
+    while (bench->running) {
+        int64_t start = esp_timer_get_time();
+        if (bench->useSeqLock) {
+            bench->lock.beginWrite();
+        } else {
+            xSemaphoreTake(bench->mutex, portMAX_DELAY);
+        }
+        bench->data.batteryCharge += 1.0f;
+        bench->data.currentUpdateTime = time(nullptr);
+        if (bench->useSeqLock) {
+            bench->lock.endWrite();
+        } else {
+            xSemaphoreGive(bench->mutex);
+        }
+        uint32_t waitUs = (uint32_t)(esp_timer_get_time() - start);
+        bench->writes++;
+        bench->totalWaitUs += waitUs;
+        bench->maxWaitUs = max(bench->maxWaitUs, waitUs);
+        vTaskDelay(1);
+    }
+    xSemaphoreGive(bench->writerDone);
+    vTaskDelete(nullptr);
+}
+
+// Runs the reader on the calling task for SEQLOCK_BENCH_DURATION_MS; false if the writer couldn't start
+static bool runPhase(SeqLockBench& bench, bool useSeqLock) {
+    bench.useSeqLock = useSeqLock;
+    bench.writes = 0;
+    bench.totalWaitUs = 0;
+    bench.maxWaitUs = 0;
+    bench.running = true;
+    if (xTaskCreatePinnedToCore(seqLockBenchWriter_t, "SeqLock Writer", TASK_STACK_SMALL, &bench, 2, nullptr, xPortGetCoreID() ^ 1) != pdPASS) {
+        bench.running = false;
+        return false;
+    }
+    Solar snapshot;
+    int64_t end = esp_timer_get_time() + SEQLOCK_BENCH_DURATION_MS * 1000;
+    while (esp_timer_get_time() < end) {
+        if (useSeqLock) {
+            bench.lock.read(snapshot);
+            busyWaitUs(SEQLOCK_BENCH_RENDER_US);
+        } else {
+            xSemaphoreTake(bench.mutex, portMAX_DELAY);
+            snapshot = bench.data;
+            busyWaitUs(SEQLOCK_BENCH_RENDER_US);
+            xSemaphoreGive(bench.mutex);
+        }
+        vTaskDelay(1);
+    }
+    bench.running = false;
+    xSemaphoreTake(bench.writerDone, portMAX_DELAY);
+    esp_task_wdt_reset();
+    return true;
+}
+
+void seqLockBenchmark(char* report, size_t reportLen) {
+    static SeqLockBench bench;
+    bench.mutex = xSemaphoreCreateMutex();
+    bench.writerDone = xSemaphoreCreateBinary();
+    if (!bench.mutex || !bench.writerDone || !runPhase(bench, false)) {
+        snprintf(report, reportLen, "SeqLock benchmark: could not start the writer task");
+    } else {
+        uint32_t mutexWrites = bench.writes;
+        uint32_t mutexAvgUs = mutexWrites ? (uint32_t)(bench.totalWaitUs / mutexWrites) : 0;
+        uint32_t mutexMaxUs = bench.maxWaitUs;
+        uint32_t retriesBefore = bench.lock.readRetries();
+        if (!runPhase(bench, true)) {
+            snprintf(report, reportLen, "SeqLock benchmark: could not start the writer task");
+        } else {
+            snprintf(report, reportLen,
+                     "Writer wait with a %lu us render per read: mutex avg %lu us / max %lu us over %lu writes; "
+                     "seqlock avg %lu us / max %lu us over %lu writes, %lu reader retries",
+                     (unsigned long)SEQLOCK_BENCH_RENDER_US, (unsigned long)mutexAvgUs, (unsigned long)mutexMaxUs, (unsigned long)mutexWrites,
+                     (unsigned long)(bench.writes ? bench.totalWaitUs / bench.writes : 0), (unsigned long)bench.maxWaitUs, (unsigned long)bench.writes,
+                     (unsigned long)(bench.lock.readRetries() - retriesBefore));
+        }
+    }
+    if (bench.mutex) {
+        vSemaphoreDelete(bench.mutex);
+    }
+    if (bench.writerDone) {
+        vSemaphoreDelete(bench.writerDone);
+    }
+    bench.mutex = nullptr;
+    bench.writerDone = nullptr;
+    logAndPublish(report);
+}
@@ -0,0 +1,79 @@
+#ifndef SEQLOCK_H
+#define SEQLOCK_H
+
+#include <atomic>
+#include <cassert>
+#include <cstring>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// Sequence lock over one shared data group (a struct, or the readings array).
+// The sequence is odd while the writer is inside beginWrite()/endWrite() and
+// advances by two per write. Readers copy the whole group and retry if the
+// sequence moved, so they never hold anything while they render and never
+// make the writer wait. Each group has exactly one writer task (the MQTT task
+// for readings and inside air quality, the API task for weather, UV, outdoor
+// air quality and solar, the status task for the status line), so a write
+// never waits for anything either; a second writer trips the assert. The
+// writer may not block or log inside a write section.
+//
+// The data stays where it was (SD load/save and the host bench use it by
+// name); only writes between beginWrite()/endWrite() and copies from read()
+// are safe while other tasks are running.
+template <typename T> class SeqLock {
+public:
+    explicit constexpr SeqLock(T& data) : data(data), sequence(0), retries(0) {}
+
+    void beginWrite() {
+        uint32_t seq = sequence.load(std::memory_order_relaxed);
+        assert(!(seq & 1) && "SeqLock written from two tasks");
+        sequence.store(seq + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+    }
+
+    void endWrite() {
+        sequence.fetch_add(1, std::memory_order_release);
+    }
+
+    // Copies a consistent snapshot of the group into out
+    void read(T& out) const {
+        for (uint32_t attempt = 0;; attempt++) {
+            uint32_t before = sequence.load(std::memory_order_acquire);
+            if (!(before & 1)) {
+                memcpy((void*)&out, (const void*)&data, sizeof(T));
+                std::atomic_thread_fence(std::memory_order_acquire);
+                if (sequence.load(std::memory_order_relaxed) == before) {
+                    return;
+                }
+            }
+            retries.fetch_add(1, std::memory_order_relaxed);
+            if (attempt >= SPIN_ATTEMPTS) {
+                vTaskDelay(1); // The writer was preempted mid-write, possibly by this task
+            }
+        }
+    }
+
+    // Completed writes so far; changes whenever the group does
+    uint32_t version() const {
+        return sequence.load(std::memory_order_acquire) >> 1;
+    }
+
+    // Reads that had to be repeated because a write overlapped them
+    uint32_t readRetries() const {
+        return retries.load(std::memory_order_relaxed);
+    }
+
+private:
+    static const uint32_t SPIN_ATTEMPTS = 4;
+    T& data;
+    std::atomic<uint32_t> sequence;
+    mutable std::atomic<uint32_t> retries;
+};
+
+// Times writer latency with a reader holding a mutex across a simulated render
+// vs reading SeqLock snapshots, from the /benchmark?name=seqlock endpoint
+void seqLockBenchmark(char* report, size_t reportLen);
+
+#endif // SEQLOCK_H
@@ -0,0 +1,127 @@
+#include "TopicTable.h"
+#include <esp_timer.h>
+
+// Same order as readingInfo[] in main.cpp, so a READING entry's index is the
+// reading's index there
+static constexpr ReadingInfo readingTopics[]{READING_INFO_ARRAY};
+static constexpr TopicEntry insideTopics[]{
+    {MQTT_INSIDE_CO2_TOPIC, TopicRoute::INSIDE_CO2, 0},
+    {MQTT_INSIDE_PM1_TOPIC, TopicRoute::INSIDE_PM1, 0},
+    {MQTT_INSIDE_PM25_TOPIC, TopicRoute::INSIDE_PM25, 0},
+    {MQTT_INSIDE_PM10_TOPIC, TopicRoute::INSIDE_PM10, 0},
+};
+static_assert(sizeof(readingTopics) / sizeof(readingTopics[0]) == READING_COUNT, "READING_COUNT doesn't match READING_INFO_ARRAY");
+
+static constexpr auto topicTable = makeTopicTable(readingTopics, insideTopics);
+static_assert(topicTable.valid(), "Subscribed MQTT topics don't hash apart; rename one");
+
+const TopicEntry* findTopic(const char* topic) {
+    return topicTable.find(topic);
+}
+
+// --- Benchmark ---
+
+// The dispatch receive_mqtt_messages_t did before the table: strcmp down the
+// readings, then the four inside air quality topics
+static int scan_live(const char* topic) {
+    for (size_t i = 0; i < sizeof(readingTopics) / sizeof(readingTopics[0]); i++) {
+        if (strcmp(topic, readingTopics[i].topic) == 0) {
+            return (int)i;
+        }
+    }
+    for (const TopicEntry& entry : insideTopics) {
+        if (strcmp(topic, entry.topic) == 0) {
+            return READING_COUNT + (int)entry.route;
+        }
+    }
+    return -1;
+}
+
+// A few hundred sensors: "sensors/000/set" .. "sensors/299/set"
+static const size_t SYNTHETIC_TOPICS = 300;
+static const size_t SYNTHETIC_TOPIC_LEN = 16;
+
+struct SyntheticNames {
+    char names[SYNTHETIC_TOPICS][SYNTHETIC_TOPIC_LEN];
+};
+
+static constexpr SyntheticNames makeSyntheticNames() {
+    SyntheticNames s{};
+    for (size_t i = 0; i < SYNTHETIC_TOPICS; i++) {
+        const char prefix[] = "sensors/";
+        size_t n = 0;
+        for (; prefix[n]; n++) {
+            s.names[i][n] = prefix[n];
+        }
+        s.names[i][n++] = (char)('0' + i / 100);
+        s.names[i][n++] = (char)('0' + i / 10 % 10);
+        s.names[i][n++] = (char)('0' + i % 10);
+        s.names[i][n++] = '/';
+        s.names[i][n++] = 's';
+        s.names[i][n++] = 'e';
+        s.names[i][n++] = 't';
+    }
+    return s;
+}
+
+static constexpr SyntheticNames syntheticNames = makeSyntheticNames();
+
+static constexpr TopicTable<SYNTHETIC_TOPICS> makeSyntheticTable() {
+    TopicEntry entries[SYNTHETIC_TOPICS]{};
+    for (size_t i = 0; i < SYNTHETIC_TOPICS; i++) {
+        entries[i] = {syntheticNames.names[i], TopicRoute::READING, (uint16_t)i};
+    }
+    return TopicTable<SYNTHETIC_TOPICS>(entries);
+}
+
+static constexpr auto syntheticTable = makeSyntheticTable();
+static_assert(syntheticTable.valid(), "Synthetic benchmark topics don't hash apart");
+
+static int scan_synthetic(const char* topic) {
+    for (size_t i = 0; i < SYNTHETIC_TOPICS; i++) {
+        if (strcmp(topic, syntheticNames.names[i]) == 0) {
+            return (int)i;
+        }
+    }
+    return -1;
+}
+
+static volatile int benchSink; // Keeps the compiler from dropping the timed lookups
+
+// Nanoseconds per lookup, cycling through topics (each received message is one lookup)
+template <typename Lookup> static uint32_t ns_per_lookup(Lookup lookup, const char* const* topics, size_t count) {
+    static const size_t LOOKUPS = 100000;
+    int acc = 0;
+    int64_t start = esp_timer_get_time();
+    for (size_t i = 0; i < LOOKUPS; i++) {
+        acc += lookup(topics[i % count]);
+    }
+    int64_t elapsed = esp_timer_get_time() - start;
+    benchSink = acc;
+    return (uint32_t)(elapsed * 1000 / (int64_t)LOOKUPS);
+}
+
+void topicDispatchBenchmark(char* report, size_t reportLen) {
+    // Every live topic plus one the device doesn't subscribe to
+    static const char* liveMessages[READING_COUNT + 5];
+    size_t liveCount = 0;
+    for (const ReadingInfo& info : readingTopics) {
+        liveMessages[liveCount++] = info.topic;
+    }
+    for (const TopicEntry& entry : insideTopics) {
+        liveMessages[liveCount++] = entry.topic;
+    }
+    liveMessages[liveCount++] = "klaussometer/unknown";
+
+    static const char* syntheticMessages[SYNTHETIC_TOPICS];
+    for (size_t i = 0; i < SYNTHETIC_TOPICS; i++) {
+        syntheticMessages[i] = syntheticNames.names[i];
+    }
+
+    uint32_t scanLive = ns_per_lookup(scan_live, liveMessages, liveCount);
+    uint32_t hashLive = ns_per_lookup([](const char* topic) { return findTopic(topic) ? 1 : 0; }, liveMessages, liveCount);
+    uint32_t scanMany = ns_per_lookup(scan_synthetic, syntheticMessages, SYNTHETIC_TOPICS);
+    uint32_t hashMany = ns_per_lookup([](const char* topic) { return syntheticTable.find(topic) ? 1 : 0; }, syntheticMessages, SYNTHETIC_TOPICS);
+    snprintf(report, reportLen, "MQTT topic lookup ns (scan / perfect hash): %d topics %lu / %lu, %d topics %lu / %lu", READING_COUNT + 4,
+             (unsigned long)scanLive, (unsigned long)hashLive, (int)SYNTHETIC_TOPICS, (unsigned long)scanMany, (unsigned long)hashMany);
+}
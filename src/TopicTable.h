@@ -0,0 +1,150 @@
+#ifndef TOPICTABLE_H
+#define TOPICTABLE_H
+
+#include "types.h"
+#include "utils.h"
+#include <cstring>
+
+// Where an incoming MQTT message goes
+enum class TopicRoute : uint8_t {
+    READING,     // updateReadings() for readingInfo[index]
+    INSIDE_CO2,  // updateInsideAirQuality() for the kitchen sensors
+    INSIDE_PM1,
+    INSIDE_PM25,
+    INSIDE_PM10,
+};
+
+struct TopicEntry {
+    const char* topic; // nullptr marks an empty slot
+    TopicRoute route;
+    uint16_t index;
+};
+
+// Perfect hash over a fixed set of topics, built at compile time (hash and
+// displace). The topic's FNV-1a hash picks a bucket from its top bits; the
+// bucket's displacement remixes the same hash into a slot no other topic
+// uses. A lookup is one pass over the string to hash it, two array reads and
+// one strcmp, however many topics there are. Slots are kept at most half full
+// so the build finds displacements quickly; valid() is false only if two
+// topics share a 32-bit hash or no displacement fits, and callers static_assert it.
+template <size_t N> class TopicTable {
+    static_assert(N > 0 && N <= UINT16_MAX, "TopicTable indexes are 16 bits");
+
+    static constexpr unsigned bitsFor(size_t count) {
+        unsigned bits = 0;
+        while (((size_t)1 << bits) < count) {
+            bits++;
+        }
+        return bits;
+    }
+
+public:
+    static constexpr unsigned SLOT_BITS = bitsFor(2 * N);
+    static constexpr unsigned BUCKET_BITS = bitsFor(N) > 0 ? bitsFor(N) - 1 : 0;
+    static constexpr size_t SLOTS = (size_t)1 << SLOT_BITS;
+    static constexpr size_t BUCKETS = (size_t)1 << BUCKET_BITS;
+
+    constexpr explicit TopicTable(const TopicEntry (&entries)[N]) {
+        uint32_t hashes[N]{};
+        size_t bucketSize[BUCKETS]{};
+        size_t largest = 0;
+        for (size_t i = 0; i < N; i++) {
+            hashes[i] = topicHash(entries[i].topic);
+            size_t size = ++bucketSize[bucketOf(hashes[i])];
+            largest = size > largest ? size : largest;
+        }
+
+        // Fullest buckets first, while most slots are still free
+        bool taken[SLOTS]{};
+        for (size_t size = largest; size > 0; size--) {
+            for (size_t bucket = 0; bucket < BUCKETS; bucket++) {
+                if (bucketSize[bucket] == size && !place(entries, hashes, bucket, taken)) {
+                    ok = false;
+                    return;
+                }
+            }
+        }
+        ok = true;
+    }
+
+    constexpr bool valid() const {
+        return ok;
+    }
+
+    // The entry for topic, or nullptr if it isn't one of the table's topics
+    const TopicEntry* find(const char* topic) const {
+        uint32_t hash = topicHash(topic);
+        const TopicEntry& entry = slots[slotOf(hash, displacement[bucketOf(hash)])];
+        return entry.topic && strcmp(entry.topic, topic) == 0 ? &entry : nullptr;
+    }
+
+private:
+    static const uint32_t MAX_DISPLACEMENT = UINT16_MAX;
+
+    TopicEntry slots[SLOTS]{};
+    uint16_t displacement[BUCKETS]{};
+    bool ok = false;
+
+    static constexpr size_t bucketOf(uint32_t hash) {
+        return BUCKET_BITS ? hash >> (32 - BUCKET_BITS) : 0;
+    }
+
+    static constexpr size_t slotOf(uint32_t hash, uint32_t d) {
+        uint32_t x = hash + d * 0x9E3779B9u;
+        x ^= x >> 16;
+        x *= 0x85EBCA6Bu;
+        x ^= x >> 13;
+        return x & (SLOTS - 1);
+    }
+
+    // Finds a displacement that puts every topic of bucket in a free slot
+    constexpr bool place(const TopicEntry (&entries)[N], const uint32_t (&hashes)[N], size_t bucket, bool (&taken)[SLOTS]) {
+        for (uint32_t d = 0; d <= MAX_DISPLACEMENT; d++) {
+            bool fits = true;
+            for (size_t i = 0; i < N && fits; i++) {
+                if (bucketOf(hashes[i]) != bucket) {
+                    continue;
+                }
+                size_t s = slotOf(hashes[i], d);
+                fits = !taken[s];
+                for (size_t j = 0; j < i && fits; j++) {
+                    fits = bucketOf(hashes[j]) != bucket || slotOf(hashes[j], d) != s;
+                }
+            }
+            if (fits) {
+                for (size_t i = 0; i < N; i++) {
+                    if (bucketOf(hashes[i]) == bucket) {
+                        size_t s = slotOf(hashes[i], d);
+                        taken[s] = true;
+                        slots[s] = entries[i];
+                    }
+                }
+                displacement[bucket] = (uint16_t)d;
+                return true;
+            }
+        }
+        return false;
+    }
+};
+
+// Builds the dispatch table for readings (route READING, index = position in
+// the array) followed by the other subscribed topics
+template <size_t R, size_t X> constexpr TopicTable<R + X> makeTopicTable(const ReadingInfo (&readings)[R], const TopicEntry (&others)[X]) {
+    TopicEntry all[R + X]{};
+    for (size_t i = 0; i < R; i++) {
+        all[i] = {readings[i].topic, TopicRoute::READING, (uint16_t)i};
+    }
+    for (size_t i = 0; i < X; i++) {
+        all[R + i] = others[i];
+    }
+    return TopicTable<R + X>(all);
+}
+
+// Dispatch entry for a subscribed topic, or nullptr (see TopicTable.cpp)
+const TopicEntry* findTopic(const char* topic);
+
+// Times topic lookups through the perfect hash vs the strcmp scan it replaced,
+// for the live topics and a synthetic table of a few hundred sensors
+void topicDispatchBenchmark(char* report, size_t reportLen);
+
+#endif // TOPICTABLE_H
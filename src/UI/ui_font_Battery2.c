@@ -2,6 +2,7 @@
  * Size: 40 px
  * Bpp: 1
  * Opts: --bpp 1 --size 40 --font /Users/gjonesblackcyton/Documents/PlatformIO/Projects/klaussometerV4.1/SL/assets/icon-works-webfont.ttf -o /Users/gjonesblackcyton/Documents/PlatformIO/Projects/klaussometerV4.1/SL/assets/ui_font_Battery2.c --format lvgl -r 0x20-0x7f --no-compress --no-prefilter
+ * Subset: U+0020, U+002C, U+002E, U+003B, U+003E (scripts/font_subset.py)
  ******************************************************************************/
 
 #include "ui.h"
@@ -21,214 +22,6 @@ static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] = {
     /* U+0020 " " */
     0x0,
 
-    /* U+0021 "!" */
-    0x1, 0xf8, 0x0, 0xfc, 0x0, 0x3f, 0xf8, 0x3f,
-    0xf8, 0x7, 0x81, 0xe3, 0xc0, 0xf0, 0x70, 0x3,
-    0xb8, 0x1, 0xc3, 0x0, 0xf, 0x80, 0x6, 0x30,
-    0x0, 0x38, 0x0, 0x19, 0x80, 0x1, 0xc0, 0x0,
-    0xd8, 0x0, 0x0, 0x0, 0x3, 0xc0, 0x0, 0x0,
-    0x0, 0x1e, 0x0, 0x0, 0x0, 0x0, 0xf0, 0x0,
-    0x0, 0x0, 0x7, 0x80, 0x0, 0x0, 0x0, 0x3c,
-    0x0, 0x0, 0x0, 0x1, 0xf0, 0x0, 0x0, 0x0,
-    0x1d, 0x80, 0x0, 0x0, 0x0, 0xcc, 0x0, 0x0,
-    0x0, 0xe, 0x30, 0x0, 0x0, 0x0, 0x61, 0xc0,
-    0x0, 0x0, 0x7, 0x7, 0x0, 0x0, 0x0, 0x70,
-    0x1c, 0x0, 0x0, 0x7, 0x0, 0xf0, 0x0, 0x0,
-    0x70, 0x3, 0xc0, 0x0, 0x7, 0x0, 0x7, 0x0,
-    0x0, 0x70, 0x0, 0x1c, 0x0, 0x7, 0x0, 0x0,
-    0x70, 0x0, 0x70, 0x0, 0x1, 0xc0, 0x7, 0x0,
-    0x0, 0x7, 0x0, 0x70, 0x0, 0x0, 0x1c, 0x7,
-    0x0, 0x0, 0x0, 0x70, 0x70, 0x0, 0x0, 0x1,
-    0xc7, 0x0, 0x0, 0x0, 0x7, 0x70, 0x0, 0x0,
-    0x0, 0x1f, 0x0, 0x0, 0x0, 0x0, 0x70, 0x0,
-    0x0, 0x0, 0x1, 0x0, 0x0, 0x0,
-
-    /* U+0022 "\"" */
-    0x0, 0x0, 0x20, 0x0, 0x0, 0x0, 0x3, 0x80,
-    0x0, 0x0, 0x0, 0x1c, 0x0, 0x0, 0x0, 0x0,
-    0xe0, 0x0, 0x0, 0x0, 0xf, 0x80, 0x0, 0x0,
-    0x0, 0x6c, 0x0, 0x0, 0x0, 0x3, 0x60, 0x0,
-    0x0, 0x0, 0x3b, 0x80, 0x0, 0x0, 0x1, 0x8c,
-    0x0, 0x0, 0x0, 0xc, 0x60, 0x0, 0x0, 0x0,
-    0xe3, 0x80, 0x0, 0x0, 0x6, 0xc, 0x0, 0x0,
-    0x0, 0x30, 0x60, 0x0, 0x3f, 0xff, 0x83, 0xff,
-    0xf9, 0xff, 0xf8, 0xf, 0xff, 0xc7, 0x0, 0x0,
-    0x0, 0x1c, 0x1e, 0x0, 0x0, 0x3, 0xc0, 0x78,
-    0x0, 0x0, 0x3c, 0x0, 0xe0, 0x0, 0x3, 0x80,
-    0x3, 0xc0, 0x0, 0x78, 0x0, 0xf, 0x0, 0x7,
-    0x80, 0x0, 0x1c, 0x0, 0x70, 0x0, 0x0, 0xe0,
-    0x3, 0x80, 0x0, 0x6, 0x0, 0xc, 0x0, 0x0,
-    0x30, 0x0, 0x60, 0x0, 0x3, 0x80, 0x3, 0x0,
-    0x0, 0x18, 0x1c, 0xc, 0x0, 0x0, 0xc3, 0xf8,
-    0x60, 0x0, 0x6, 0x3d, 0xe3, 0x0, 0x0, 0x73,
-    0x83, 0x9c, 0x0, 0x3, 0x78, 0xf, 0x60, 0x0,
-    0x1f, 0x80, 0x3f, 0x0, 0x1, 0xf0, 0x0, 0x7c,
-    0x0, 0xf, 0x0, 0x1, 0xe0, 0x0, 0x60, 0x0,
-    0x3, 0x0,
-
-    /* U+0023 "#" */
-    0x0, 0x0, 0x0, 0x3, 0xc0, 0x0, 0x0, 0x0,
-    0xfe, 0xf, 0xc0, 0x0, 0x1e, 0x61, 0xff, 0x80,
-    0x3, 0x87, 0x3c, 0x7f, 0x80, 0x70, 0x63, 0xc0,
-    0x7f, 0xe, 0xe, 0x1f, 0x0, 0xff, 0xc0, 0xe0,
-    0x7c, 0x0, 0xf8, 0x1c, 0x1, 0xe0, 0x1, 0x3,
-    0x80, 0xf, 0x80, 0x0, 0x70, 0x0, 0x3e, 0x0,
-    0xe, 0x0, 0x0, 0xf8, 0x1, 0xc0, 0x0, 0x3,
-    0xe0, 0x18, 0x0, 0x0, 0xe, 0x1, 0x80, 0x0,
-    0x1, 0xc0, 0xc, 0x0, 0x0, 0x38, 0x0, 0xc0,
-    0x0, 0x7, 0x80, 0xc, 0x0, 0x0, 0xf0, 0x60,
-    0xe0, 0x0, 0xe, 0xf, 0x6, 0x0, 0x1, 0xc1,
-    0xf0, 0x60, 0x0, 0x38, 0x3b, 0x86, 0x1, 0xff,
-    0x7, 0x18, 0x30, 0x3f, 0xe0, 0xe1, 0xc3, 0x7,
-    0x0, 0x1c, 0xe, 0x30, 0xe0, 0x3, 0x80, 0x63,
-    0x8f, 0xc0, 0x70, 0x7, 0x18, 0x3f, 0x6, 0x0,
-    0x31, 0x80, 0x78, 0x60, 0x3, 0x98, 0x1, 0xc6,
-    0x0, 0x19, 0xc0, 0xc, 0x60, 0x1, 0xcc, 0x0,
-    0xc6, 0x0, 0xd, 0xc0, 0x6, 0x60, 0x0, 0xf8,
-    0x0, 0x6e, 0x0, 0x7, 0x0, 0x7, 0xc0, 0x0,
-    0x60, 0x0, 0x38, 0x0, 0x0, 0x0, 0x3, 0x0,
-    0x0, 0x0,
-
-    /* U+0024 "$" */
-    0x1, 0xfc, 0x0, 0x3f, 0xf8, 0x3, 0xc1, 0xe0,
-    0x38, 0x3, 0x83, 0x0, 0xe, 0x38, 0x0, 0x39,
-    0x80, 0x0, 0xdc, 0xe, 0x7, 0xc0, 0xf8, 0x1e,
-    0xe, 0xe0, 0xf0, 0x63, 0x7, 0x83, 0x18, 0x3c,
-    0x1d, 0xc1, 0xe0, 0x7c, 0xf, 0x81, 0xc0, 0xcc,
-    0x0, 0x6, 0x60, 0x0, 0x33, 0x80, 0x3, 0x8c,
-    0x0, 0x18, 0x60, 0x0, 0xc3, 0x80, 0xc, 0xc,
-    0x0, 0x60, 0x70, 0x7, 0x1, 0x80, 0x30, 0xe,
-    0x3, 0x80, 0x30, 0x18, 0x1, 0xc1, 0xc0, 0x6,
-    0xc, 0x0, 0x38, 0xe0, 0x0, 0xc6, 0x0, 0x7,
-    0x70, 0x0, 0x1b, 0x0, 0x0, 0xf8, 0x0, 0x3,
-    0x80, 0x0,
-
-    /* U+0026 "&" */
-    0x0, 0x30, 0x0, 0x0, 0x30, 0x1f, 0xc0, 0x0,
-    0xf, 0xf, 0xff, 0x0, 0x7, 0xf7, 0xf3, 0x7c,
-    0x1, 0xfb, 0xf8, 0x31, 0xf0, 0x7c, 0x3c, 0x3,
-    0x7, 0xdf, 0x3, 0xc0, 0x30, 0x1f, 0xc0, 0x3c,
-    0x3, 0x0, 0x60, 0x3, 0xc0, 0x30, 0x6, 0x0,
-    0x3c, 0x3, 0x0, 0x60, 0x3, 0xc0, 0x30, 0x6,
-    0x0, 0x3c, 0x3, 0x0, 0x60, 0x3, 0xc0, 0x30,
-    0x6, 0x0, 0x3c, 0x3, 0x0, 0x60, 0x3, 0xc0,
-    0x30, 0x6, 0x0, 0x3c, 0x3, 0x0, 0x60, 0x3,
-    0xc0, 0x30, 0x6, 0x0, 0x3c, 0x3, 0x0, 0x60,
-    0x3, 0xc0, 0x30, 0x6, 0x0, 0x3c, 0x3, 0x0,
-    0x60, 0x3, 0xc0, 0x30, 0x6, 0x0, 0x3c, 0x3,
-    0x0, 0x60, 0x3, 0xc0, 0x30, 0x6, 0x0, 0x3c,
-    0x1f, 0xc0, 0x60, 0x7, 0xcf, 0xff, 0x6, 0x3,
-    0xff, 0xf0, 0x7c, 0x61, 0xf8, 0xf8, 0x1, 0xf6,
-    0x7e, 0xc, 0x0, 0x7, 0xff, 0x0, 0x0, 0x0,
-    0x1f, 0xc0, 0x0, 0x0, 0x0, 0x60, 0x0,
-
-    /* U+0027 "'" */
-    0x3, 0x80, 0x0, 0xf, 0x80, 0x0, 0x6, 0x0,
-    0x0, 0x1c, 0x0, 0x0, 0x30, 0x0, 0x0, 0xc0,
-    0x0, 0x3, 0x0, 0x0, 0x7f, 0x80, 0x7, 0xff,
-    0x80, 0x3c, 0xf, 0x1, 0xc0, 0xe, 0xe, 0x0,
-    0x1c, 0x70, 0x78, 0x39, 0x83, 0xf0, 0x66, 0xc,
-    0xc1, 0xb0, 0x33, 0x3, 0xc0, 0xcc, 0xf, 0x3,
-    0x30, 0x3c, 0xc, 0xc0, 0xf0, 0x33, 0x3, 0xc0,
-    0xfc, 0xf, 0x1, 0xe0, 0x3c, 0x0, 0x0, 0xf0,
-    0x0, 0x3, 0xc0, 0x0, 0xf, 0x0, 0x0, 0x3c,
-    0x0, 0x0, 0xf0, 0x0, 0x3, 0xc0, 0x0, 0xf,
-    0x0, 0x0, 0x3c, 0x0, 0x0, 0xf0, 0x0, 0x3,
-    0x60, 0x0, 0x19, 0x80, 0x0, 0x67, 0x0, 0x3,
-    0xe, 0x0, 0x1c, 0x1c, 0x0, 0xe0, 0x3c, 0xf,
-    0x0, 0x7f, 0xf8, 0x0, 0x3f, 0x0,
-
-    /* U+0028 "(" */
-    0xc0, 0x0, 0x0, 0x0, 0x3, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0x0, 0x0, 0x0, 0x0, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0xc0, 0x0, 0x0, 0x0, 0x3,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0x0, 0x0, 0x0,
-    0xfe, 0x30, 0x0, 0x0, 0x7, 0xfc, 0xc0, 0x0,
-    0x0, 0x18, 0x33, 0x0, 0x0, 0x0, 0x60, 0xcc,
-    0x0, 0x0, 0x1, 0x83, 0x30, 0x0, 0x3f, 0xc6,
-    0xc, 0xc0, 0x1, 0xff, 0x98, 0x33, 0x0, 0x6,
-    0x6, 0x60, 0xcc, 0x0, 0x18, 0x19, 0x83, 0x30,
-    0x0, 0x60, 0x66, 0xc, 0xc0, 0x1, 0x81, 0x98,
-    0x33, 0x0, 0x6, 0x6, 0x60, 0xcc, 0x0, 0x18,
-    0x19, 0x83, 0x30, 0x0, 0x60, 0x66, 0xc, 0xc0,
-    0x1, 0x81, 0x98, 0x33, 0x0, 0x6, 0x6, 0x60,
-    0xcc, 0x7f, 0x18, 0x19, 0x83, 0x33, 0xfe, 0x60,
-    0x66, 0xc, 0xcc, 0x19, 0x81, 0x98, 0x33, 0x30,
-    0x66, 0x6, 0x60, 0xcc, 0xc1, 0x98, 0x19, 0x83,
-    0x33, 0x6, 0x60, 0x66, 0xc, 0xcc, 0x19, 0x81,
-    0x98, 0x33, 0x30, 0x66, 0x6, 0x60, 0xcc, 0xc1,
-    0x98, 0x19, 0x83, 0x33, 0x6, 0x60, 0x66, 0xc,
-    0xcf, 0xf9, 0xff, 0x9f, 0xf3, 0x1f, 0xc3, 0xfc,
-    0x3f, 0x8c, 0x0, 0x0, 0x0, 0x0, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf0,
-
-    /* U+0029 ")" */
-    0x0, 0x0, 0xf, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0x80, 0x0, 0x0, 0xc, 0xff, 0x80, 0x0, 0x3,
-    0xf3, 0xff, 0x80, 0x0, 0x7f, 0xcf, 0xff, 0x0,
-    0x3, 0xe3, 0x3f, 0xfe, 0x0, 0x3c, 0xc, 0xff,
-    0xfc, 0x1, 0xe0, 0x33, 0xff, 0xf8, 0xe, 0x0,
-    0xcf, 0xff, 0xe0, 0x30, 0x3, 0x3f, 0xff, 0xc1,
-    0x80, 0xc, 0xff, 0xff, 0xe, 0x0, 0x33, 0xff,
-    0xfe, 0x30, 0x0, 0xcf, 0xff, 0xf9, 0xc0, 0x3,
-    0x3f, 0xff, 0xe6, 0x0, 0xc, 0xff, 0xff, 0xd8,
-    0x0, 0x33, 0xff, 0xff, 0xc0, 0x0, 0xcf, 0xff,
-    0xff, 0x0, 0x3, 0x3f, 0xff, 0xfc, 0x0, 0xc,
-    0x0, 0x0, 0x30, 0x0, 0x30, 0x0, 0x0, 0xc0,
-    0x0, 0xff, 0xff, 0xf3, 0x0, 0x3, 0xff, 0xff,
-    0x8c, 0x0, 0x0, 0x0, 0x6, 0x30, 0x0, 0x0,
-    0x0, 0x18, 0x60, 0x0, 0x0, 0x0, 0x61, 0x80,
-    0x0, 0x0, 0x3, 0x86, 0x0, 0x0, 0x0, 0xc,
-    0xc, 0x0, 0x0, 0x0, 0x70, 0x30, 0x0, 0x0,
-    0x1, 0x80, 0x60, 0x0, 0x0, 0xe, 0x1, 0xc0,
-    0x0, 0x0, 0x70, 0x3, 0x80, 0x0, 0x1, 0x80,
-    0x7, 0x0, 0x0, 0x1e, 0x0, 0xe, 0x0, 0x0,
-    0xf0, 0x0, 0x1e, 0x0, 0xf, 0x0, 0x0, 0x1f,
-    0x0, 0xf8, 0x0, 0x0, 0x1f, 0xff, 0x80, 0x0,
-    0x0, 0x1f, 0xf0, 0x0, 0x0,
-
-    /* U+002A "*" */
-    0x0, 0x0, 0x80, 0x0, 0x0, 0x1, 0xf0, 0x0,
-    0x0, 0x3, 0xfe, 0x0, 0x0, 0xf, 0xc7, 0xe0,
-    0x0, 0x1f, 0x0, 0xfc, 0x0, 0xfe, 0x0, 0xf,
-    0xe3, 0xf8, 0x0, 0x0, 0xff, 0xe0, 0x0, 0x0,
-    0xf, 0xc0, 0x0, 0x0, 0x1, 0xe0, 0x0, 0x0,
-    0x0, 0xf0, 0x0, 0x0, 0x0, 0x78, 0x0, 0x0,
-    0x0, 0x3c, 0x0, 0x0, 0x0, 0x1e, 0x0, 0x0,
-    0x0, 0xf, 0x0, 0x0, 0x0, 0x6, 0xc0, 0x0,
-    0x0, 0x6, 0x60, 0x0, 0x0, 0x3, 0x30, 0x0,
-    0x0, 0x1, 0x98, 0x0, 0x0, 0x0, 0xcc, 0x0,
-    0x0, 0x0, 0x63, 0x0, 0x0, 0x0, 0x61, 0x80,
-    0x0, 0x0, 0x30, 0xc0, 0x0, 0x0, 0x18, 0x30,
-    0x0, 0x0, 0x18, 0x18, 0x0, 0x0, 0xc, 0xe,
-    0x0, 0x0, 0xe, 0x3, 0x0, 0x0, 0x6, 0x1,
-    0xc0, 0x0, 0x7, 0x0, 0x60, 0x0, 0x3, 0x0,
-    0x38, 0x0, 0x3, 0x0, 0xe, 0x0, 0x3, 0x80,
-    0x3, 0x0, 0x1, 0x80, 0x0, 0xc0, 0x1, 0x80,
-    0x0, 0x70, 0x1, 0xc0, 0x0, 0x1c, 0x1, 0xc0,
-    0x0, 0x7, 0x1, 0xc0, 0x0, 0x1, 0xe3, 0xc0,
-    0x0, 0x0, 0x7b, 0xc0, 0x0, 0x0, 0xf, 0x80,
-    0x0, 0x0, 0x3, 0x80, 0x0,
-
-    /* U+002B "+" */
-    0x0, 0x1f, 0xff, 0x80, 0x0, 0x3, 0xff, 0xfc,
-    0x0, 0x0, 0x30, 0x0, 0xc0, 0x0, 0x3, 0x0,
-    0xc, 0x0, 0x0, 0x30, 0x0, 0x60, 0x7, 0xfe,
-    0x0, 0x7, 0xfe, 0xff, 0xe0, 0x0, 0x7f, 0xfc,
-    0x0, 0x1f, 0x80, 0x3, 0xc0, 0x7, 0xfe, 0x0,
-    0x3c, 0x0, 0xf0, 0xf0, 0x73, 0xc0, 0x1c, 0x3,
-    0x87, 0x3c, 0x1, 0x80, 0x18, 0x73, 0xc0, 0x38,
-    0x1, 0xc0, 0x3c, 0x3, 0x0, 0xc, 0x3, 0xc0,
-    0x30, 0x0, 0xc0, 0x3c, 0x3, 0x0, 0xc, 0x3,
-    0xc0, 0x30, 0x0, 0xc0, 0x3c, 0x3, 0x80, 0x1c,
-    0x3, 0xc0, 0x18, 0x1, 0x80, 0x3c, 0x1, 0xc0,
-    0x38, 0x3, 0xc0, 0xf, 0xf, 0x0, 0x3c, 0x0,
-    0x7f, 0xe0, 0x3, 0xc0, 0x1, 0xf8, 0x0, 0x3c,
-    0x0, 0x0, 0x0, 0x3, 0xc0, 0x0, 0x0, 0x0,
-    0x3c, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xff,
-    0xff, 0xf7, 0xff, 0xff, 0xff, 0xfe,
-
     /* U+002C "," */
     0xf, 0xff, 0xff, 0xff, 0xe1, 0xff, 0xff, 0xff,
     0xff, 0x18, 0x0, 0x0, 0x0, 0x31, 0x80, 0x0,
@@ -242,21 +35,6 @@ static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] = {
     0x1f, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff,
     0xfe,
 
-    /* U+002D "-" */
-    0x0, 0x3f, 0x0, 0x0, 0x3f, 0xf0, 0x0, 0x1c,
-    0xe, 0x0, 0xe, 0x1, 0xc0, 0x3, 0x0, 0x30,
-    0x1, 0x80, 0x6, 0x0, 0x60, 0x1, 0x80, 0x18,
-    0x0, 0x60, 0x6, 0x0, 0x18, 0x1, 0x80, 0x6,
-    0x0, 0x0, 0x1, 0x80, 0x0, 0x0, 0x60, 0x0,
-    0x0, 0x18, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x0, 0x0, 0x3, 0xc0, 0x0, 0x0, 0xf0,
-    0x0, 0x0, 0x3c, 0x1, 0xc0, 0xf, 0x0, 0xf8,
-    0x3, 0xc0, 0x3e, 0x0, 0xf0, 0xf, 0x80, 0x3c,
-    0x0, 0xc0, 0xf, 0x0, 0x30, 0x3, 0xc0, 0xc,
-    0x0, 0xf0, 0x3, 0x0, 0x3c, 0x0, 0xc0, 0xf,
-    0x0, 0x30, 0x3, 0xc0, 0x0, 0x0, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfc,
-
     /* U+002E "." */
     0xf, 0xff, 0xff, 0xff, 0xe1, 0xff, 0xff, 0xff,
     0xff, 0x18, 0x0, 0x0, 0x0, 0x31, 0x80, 0x0,
@@ -270,257 +48,6 @@ static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] = {
     0x1f, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff,
     0xfe,
 
-    /* U+002F "/" */
-    0x1, 0xff, 0xff, 0xff, 0xc0, 0x3, 0xff, 0xff,
-    0xff, 0xc0, 0xf, 0x0, 0x0, 0x0, 0xc0, 0x1e,
-    0x0, 0x0, 0x0, 0xc0, 0x38, 0x0, 0x0, 0x0,
-    0xc0, 0x70, 0x0, 0x0, 0x0, 0xc0, 0xe0, 0x0,
-    0x0, 0x0, 0xc0, 0x70, 0x0, 0x0, 0x0, 0xc0,
-    0x38, 0x0, 0x0, 0x0, 0xc0, 0x1e, 0x0, 0x0,
-    0x0, 0xc0, 0xf, 0x0, 0x0, 0x0, 0xc0, 0x3,
-    0xff, 0xff, 0xff, 0xc0, 0x1, 0xff, 0xff, 0xff,
-    0xc0, 0x0, 0x0, 0x18, 0x0, 0x0, 0x0, 0x0,
-    0x18, 0x0, 0x0, 0x0, 0x0, 0x18, 0x0, 0x0,
-    0x3, 0xff, 0xff, 0xff, 0x80, 0x3, 0xff, 0xff,
-    0xff, 0xc0, 0x3, 0x0, 0x0, 0x0, 0xe0, 0x3,
-    0x0, 0x0, 0x0, 0x78, 0x3, 0x0, 0x0, 0x0,
-    0x1c, 0x3, 0x0, 0x0, 0x0, 0xe, 0x3, 0x0,
-    0x0, 0x0, 0x7, 0x3, 0x0, 0x0, 0x0, 0xe,
-    0x3, 0x0, 0x0, 0x0, 0x1c, 0x3, 0x0, 0x0,
-    0x0, 0x78, 0x3, 0x0, 0x0, 0x0, 0xe0, 0x3,
-    0xff, 0xff, 0xff, 0xc0, 0x3, 0xff, 0xff, 0xff,
-    0x80, 0x0, 0x0, 0x18, 0x0, 0x0, 0x0, 0x0,
-    0x18, 0x0, 0x0, 0x0, 0x0, 0x18, 0x0, 0x0,
-    0x0, 0x0, 0x18, 0x0, 0x0, 0x0, 0x0, 0x18,
-    0x0, 0x0, 0x0, 0x0, 0x18, 0x0, 0x0, 0x0,
-    0x0, 0x18, 0x0, 0x0, 0x0, 0x0, 0x18, 0x0,
-    0x0, 0x0, 0x0, 0x18, 0x0, 0x0, 0x0, 0x0,
-    0x18, 0x0, 0x0, 0x0, 0x0, 0x18, 0x0, 0x0,
-
-    /* U+0030 "0" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0x80, 0x0, 0x0, 0x0, 0x3, 0xc0, 0x0,
-    0x0, 0x0, 0x3, 0xe0, 0x7f, 0xff, 0xff, 0x3,
-    0xf0, 0xff, 0xff, 0xff, 0x7, 0x78, 0xc0, 0x0,
-    0x0, 0x3f, 0x3c, 0xc0, 0x0, 0x0, 0xff, 0x1e,
-    0xc0, 0x0, 0x3, 0xf0, 0xf, 0xc0, 0x0, 0x7,
-    0x80, 0x7, 0xc0, 0x0, 0x1f, 0x0, 0xe, 0xc0,
-    0x0, 0x3c, 0x7f, 0x1c, 0xc0, 0x0, 0x3f, 0xff,
-    0x38, 0xc0, 0x0, 0x7f, 0x83, 0x70, 0xc0, 0x0,
-    0xf8, 0x3, 0xe0, 0xc0, 0x0, 0xe0, 0x3, 0xc0,
-    0xc0, 0x0, 0x0, 0x3, 0x80, 0xc0, 0x0, 0x0,
-    0x3, 0x0, 0xc0, 0x0, 0x0, 0x0, 0x0, 0xc0,
-    0x0, 0x0, 0x6, 0x0, 0xc0, 0x0, 0x0, 0x6,
-    0x0, 0xc0, 0x0, 0x0, 0x6, 0x0, 0xc0, 0x0,
-    0x0, 0x6, 0x0, 0xc0, 0x0, 0x0, 0x6, 0x0,
-    0xc0, 0x0, 0x0, 0x6, 0x0, 0xc0, 0x0, 0x0,
-    0x6, 0x0, 0xff, 0xff, 0xff, 0xfe, 0x0, 0x7f,
-    0xff, 0xff, 0xfc, 0x0,
-
-    /* U+0031 "1" */
-    0x0, 0x0, 0x1e, 0x0, 0x0, 0x0, 0x0, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x7c, 0x0, 0x3f, 0x80,
-    0x0, 0xf0, 0x0, 0xfc, 0x0, 0x1, 0xc0, 0x3,
-    0xe0, 0x0, 0x3, 0x0, 0x1f, 0x0, 0x0, 0xc,
-    0x1, 0xf8, 0x0, 0x0, 0x30, 0xc, 0xc0, 0x0,
-    0x1, 0xc0, 0xe2, 0x0, 0x0, 0x6, 0x6, 0x0,
-    0x0, 0x0, 0x18, 0x60, 0x0, 0x0, 0x0, 0xc3,
-    0x0, 0x0, 0x0, 0x7, 0x38, 0x0, 0x0, 0x0,
-    0x19, 0x80, 0x0, 0x0, 0x0, 0xcc, 0x0, 0x0,
-    0x0, 0x6, 0x60, 0x0, 0x0, 0x0, 0x33, 0x0,
-    0x0, 0x0, 0x1, 0xd8, 0x0, 0x0, 0x0, 0xe,
-    0xc0, 0x0, 0x0, 0x0, 0x66, 0x0, 0x0, 0x0,
-    0x3, 0x38, 0x0, 0x0, 0x0, 0x18, 0xc0, 0x0,
-    0x0, 0x0, 0xc6, 0x0, 0x0, 0x0, 0xe, 0x30,
-    0x0, 0x0, 0x0, 0x60, 0xc0, 0x0, 0x0, 0x83,
-    0x6, 0x0, 0x0, 0x6, 0x30, 0x18, 0x0, 0x0,
-    0x3b, 0x80, 0xe0, 0x0, 0x1, 0xf8, 0x3, 0x80,
-    0x0, 0xf, 0x80, 0xe, 0x0, 0x0, 0x7e, 0x0,
-    0x38, 0x0, 0x3, 0xf8, 0x0, 0xf0, 0x0, 0x1f,
-    0xe0, 0x1, 0xf0, 0x0, 0x0, 0x0, 0x3, 0xf8,
-    0x0, 0x0, 0x0, 0x3, 0xc0, 0x0, 0x0,
-
-    /* U+0032 "2" */
-    0x0, 0x3, 0xfc, 0x0, 0x0, 0x1, 0xff, 0xf8,
-    0x0, 0x0, 0x7c, 0x3, 0xe0, 0x0, 0x1f, 0x0,
-    0x7, 0x80, 0x3, 0xc0, 0x0, 0x1c, 0x0, 0x70,
-    0x0, 0x0, 0xe0, 0xf, 0x0, 0x0, 0x7, 0x1,
-    0xf8, 0x0, 0x0, 0x38, 0x19, 0xc0, 0x0, 0x1,
-    0x83, 0xe, 0x0, 0x0, 0xc, 0x30, 0x70, 0x0,
-    0x0, 0xc6, 0x3, 0x80, 0x0, 0x6, 0x60, 0x1c,
-    0x0, 0x0, 0x66, 0x0, 0xe0, 0x0, 0x6, 0xc0,
-    0x7, 0x0, 0x0, 0x3c, 0x0, 0x38, 0x0, 0x3,
-    0xc0, 0x1, 0xc0, 0x0, 0x3c, 0x0, 0xe, 0x0,
-    0x3, 0xc0, 0x0, 0x70, 0x0, 0x3c, 0x0, 0x3,
-    0x80, 0x3, 0xc0, 0x0, 0x1c, 0x0, 0x3c, 0x0,
-    0x0, 0xe0, 0x3, 0x60, 0x0, 0x7, 0x0, 0x66,
-    0x0, 0x0, 0x38, 0x6, 0x60, 0x0, 0x1, 0xc0,
-    0x63, 0x0, 0x0, 0xe, 0xc, 0x30, 0x0, 0x0,
-    0x70, 0xc1, 0x80, 0x0, 0x3, 0x98, 0x1c, 0x0,
-    0x0, 0x1f, 0x80, 0xe0, 0x0, 0x0, 0xf0, 0x7,
-    0x0, 0x0, 0xe, 0x0, 0x38, 0x0, 0x1, 0xc0,
-    0x1, 0xe0, 0x0, 0x78, 0x0, 0x7, 0xc0, 0x3e,
-    0x0, 0x0, 0x1f, 0xff, 0x80, 0x0, 0x0, 0x3f,
-    0xc0, 0x0,
-
-    /* U+0033 "3" */
-    0x0, 0x3, 0xfc, 0x0, 0x0, 0x1, 0xff, 0xf8,
-    0x0, 0x0, 0x78, 0x61, 0xe0, 0x0, 0x1e, 0x6,
-    0x7, 0x80, 0x3, 0x80, 0x60, 0x1c, 0x0, 0x70,
-    0x6, 0x0, 0xe0, 0xe, 0x0, 0x60, 0x7, 0x1,
-    0xc0, 0x6, 0x0, 0x38, 0x18, 0x0, 0x0, 0x1,
-    0x83, 0x0, 0x0, 0x0, 0xc, 0x30, 0x0, 0x0,
-    0x0, 0xc6, 0x0, 0x0, 0x0, 0x6, 0x60, 0x0,
-    0x0, 0x0, 0x64, 0x0, 0x0, 0x0, 0x2, 0xc0,
-    0x0, 0x0, 0x0, 0x3c, 0x0, 0x0, 0x0, 0x3,
-    0xc0, 0x0, 0x0, 0x0, 0x3f, 0xf0, 0x0, 0x0,
-    0xff, 0xff, 0x0, 0x0, 0xf, 0xfc, 0x0, 0x0,
-    0x0, 0x3, 0xc0, 0x0, 0x0, 0x0, 0x3c, 0x0,
-    0x0, 0x0, 0x3, 0x40, 0x0, 0x0, 0x0, 0x26,
-    0x0, 0x0, 0x0, 0x6, 0x60, 0x0, 0x0, 0x0,
-    0x63, 0x0, 0x0, 0x0, 0xc, 0x30, 0x0, 0x0,
-    0x0, 0xc1, 0x80, 0x0, 0x0, 0x18, 0x1c, 0x0,
-    0x60, 0x3, 0x80, 0xe0, 0x6, 0x0, 0x70, 0x7,
-    0x0, 0x60, 0xe, 0x0, 0x38, 0x6, 0x1, 0xc0,
-    0x1, 0xe0, 0x60, 0x78, 0x0, 0x7, 0x86, 0x1e,
-    0x0, 0x0, 0x1f, 0xff, 0x80, 0x0, 0x0, 0x3f,
-    0xc0, 0x0,
-
-    /* U+0034 "4" */
-    0x0, 0x0, 0x60, 0x0, 0x0, 0x0, 0xf, 0x0,
-    0x0, 0x0, 0x1, 0xf8, 0x0, 0x0, 0x0, 0x3f,
-    0xc0, 0x0, 0x0, 0x7, 0xfe, 0x0, 0x0, 0x0,
-    0x6, 0x0, 0x0, 0x0, 0x0, 0x60, 0x0, 0x0,
-    0x0, 0x6, 0x0, 0x0, 0x0, 0x0, 0x60, 0x0,
-    0x0, 0x0, 0x6, 0x0, 0x0, 0x0, 0x0, 0x60,
-    0x0, 0x0, 0x0, 0x6, 0x0, 0x0, 0x0, 0x0,
-    0x60, 0x0, 0x0, 0x80, 0x6, 0x0, 0x10, 0x18,
-    0x0, 0x60, 0x1, 0x83, 0x80, 0x6, 0x0, 0x1c,
-    0x78, 0x0, 0x60, 0x1, 0xef, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x80, 0x6,
-    0x0, 0x1e, 0x38, 0x0, 0x60, 0x1, 0xc1, 0x80,
-    0x6, 0x0, 0x18, 0x8, 0x0, 0x60, 0x1, 0x0,
-    0x0, 0x6, 0x0, 0x0, 0x0, 0x0, 0x60, 0x0,
-    0x0, 0x0, 0x6, 0x0, 0x0, 0x0, 0x0, 0x60,
-    0x0, 0x0, 0x0, 0x6, 0x0, 0x0, 0x0, 0x0,
-    0x60, 0x0, 0x0, 0x0, 0x6, 0x0, 0x0, 0x0,
-    0x7, 0xfe, 0x0, 0x0, 0x0, 0x3f, 0xc0, 0x0,
-    0x0, 0x1, 0xf8, 0x0, 0x0, 0x0, 0xf, 0x0,
-    0x0, 0x0, 0x0, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0,
-
-    /* U+0035 "5" */
-    0x0, 0x0, 0x0, 0x1f, 0xc0, 0x0, 0x0, 0x3,
-    0xf0, 0x0, 0x0, 0x0, 0x7c, 0x0, 0x0, 0x0,
-    0x1f, 0x0, 0x0, 0x0, 0xf, 0xc0, 0x0, 0x0,
-    0x7, 0x30, 0x0, 0x0, 0x3, 0x84, 0x0, 0x0,
-    0x1, 0xc0, 0x0, 0x0, 0x0, 0xe0, 0x0, 0x0,
-    0x0, 0x70, 0x0, 0x0, 0x0, 0x38, 0x0, 0x0,
-    0x0, 0x1c, 0x0, 0x0, 0x0, 0xe, 0x0, 0x0,
-    0x0, 0x7, 0x0, 0x0, 0x0, 0x3, 0x80, 0x0,
-    0x0, 0x1, 0xc0, 0x0, 0x0, 0x0, 0xe0, 0x0,
-    0x0, 0x0, 0x70, 0x0, 0x0, 0x0, 0x38, 0x0,
-    0x0, 0x0, 0x1c, 0x0, 0x0, 0x0, 0xe, 0x0,
-    0x0, 0x0, 0x7, 0x0, 0x0, 0x0, 0x3, 0x80,
-    0x0, 0x0, 0x1, 0xc0, 0x0, 0x0, 0x0, 0xe0,
-    0x0, 0x0, 0x0, 0x70, 0x0, 0x0, 0x0, 0x38,
-    0x0, 0x0, 0x2, 0x1c, 0x0, 0x0, 0x0, 0xce,
-    0x0, 0x0, 0x0, 0x3f, 0x0, 0x0, 0x0, 0xf,
-    0x80, 0x0, 0x0, 0x3, 0xe0, 0x0, 0x0, 0x0,
-    0xfc, 0x0, 0x0, 0x0, 0x3f, 0x80, 0x0, 0x0,
-    0x0,
-
-    /* U+0036 "6" */
-    0x0, 0x1, 0xff, 0x80, 0x0, 0x0, 0xf, 0xff,
-    0xf8, 0x0, 0x0, 0x3f, 0x0, 0x7e, 0x0, 0x0,
-    0xf8, 0x0, 0xf, 0x80, 0x1, 0xe0, 0x0, 0x3,
-    0xc0, 0x7, 0x80, 0x0, 0x0, 0xf0, 0xe, 0x0,
-    0xff, 0x0, 0x78, 0x1c, 0x7, 0xff, 0xe0, 0x1c,
-    0x38, 0x1f, 0x0, 0xf8, 0xe, 0x30, 0x3c, 0x0,
-    0x1e, 0x6, 0x60, 0xf0, 0x0, 0xf, 0x7, 0xe1,
-    0xe0, 0x0, 0x3, 0x83, 0x43, 0x80, 0x0, 0x1,
-    0xc0, 0x3, 0x0, 0x7e, 0x0, 0xc0, 0x7, 0x3,
-    0xff, 0xc0, 0xe0, 0x6, 0x7, 0x81, 0xe0, 0x0,
-    0x0, 0xe, 0x0, 0x70, 0x0, 0x0, 0x1c, 0x0,
-    0x38, 0x0, 0x0, 0x38, 0x0, 0x18, 0x0, 0x0,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3c, 0x0,
-    0x0, 0x0, 0x0, 0x7e, 0x0, 0x0, 0x0, 0x0,
-    0xe7, 0x0, 0x0, 0x0, 0x0, 0xc3, 0x0, 0x0,
-    0x0, 0x0, 0xc3, 0x0, 0x0, 0x0, 0x0, 0xe7,
-    0x0, 0x0, 0x0, 0x0, 0x7e, 0x0, 0x0, 0x0,
-    0x0, 0x3c, 0x0, 0x0,
-
-    /* U+0037 "7" */
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xc0, 0x0, 0xf,
-    0xff, 0xe0, 0x0, 0x0, 0x7, 0xe0, 0x0, 0x0,
-    0x3, 0xe0, 0x0, 0x0, 0x3, 0xc0, 0x0, 0x0,
-    0x3, 0x80, 0xf, 0xf0, 0x7, 0x0, 0x7f, 0xf8,
-    0xe, 0x0, 0x1, 0xf8, 0x1c, 0x0, 0x0, 0xf0,
-    0x38, 0x0, 0x0, 0xf0, 0x70, 0x0, 0x1, 0xe0,
-    0xc0, 0x38, 0x1, 0x83, 0x81, 0xfe, 0x7, 0x6,
-    0x6, 0xfc, 0xe, 0x1c, 0x0, 0x3c, 0x18, 0x30,
-    0x0, 0x70, 0x70, 0xc0, 0x0, 0xe0, 0xc3, 0x80,
-    0x1, 0xc3, 0x86, 0xe, 0x3, 0x6, 0x18, 0x7e,
-    0xc, 0x18, 0x63, 0xbc, 0x38, 0x61, 0x8c, 0x30,
-    0x61, 0x86, 0x70, 0xc1, 0x86, 0x18, 0xc3, 0x6,
-    0x18, 0x63, 0xb8, 0x38, 0x61, 0x87, 0xe0, 0x41,
-    0x86, 0xe, 0x0, 0x6, 0x18, 0x0, 0x0, 0x0,
-    0x60,
-
-    /* U+0038 "8" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xf0,
-    0x0, 0xf, 0xff, 0xc0, 0x0, 0xfc, 0x0, 0x0,
-    0xf, 0x80, 0x0, 0x0, 0x78, 0x0, 0x0, 0x7,
-    0x80, 0x0, 0x0, 0x3c, 0x3, 0xfe, 0x1, 0xc0,
-    0x7f, 0xf8, 0xe, 0x3, 0xe0, 0x0, 0x30, 0x3c,
-    0x0, 0x1, 0xc1, 0xc0, 0x0, 0xe, 0xe, 0x0,
-    0x0, 0x30, 0x70, 0x7, 0x81, 0xc3, 0x80, 0xff,
-    0x6, 0xc, 0xf, 0xf8, 0x38, 0x70, 0x78, 0x0,
-    0xc1, 0x83, 0x80, 0x3, 0xe, 0x1c, 0x0, 0xc,
-    0x30, 0x60, 0x0, 0x70, 0xc3, 0x81, 0xc1, 0x87,
-    0xc, 0xf, 0xc6, 0x18, 0x30, 0x77, 0x98, 0x60,
-    0xc1, 0x86, 0x61, 0x83, 0xe, 0x19, 0x86, 0xc,
-    0x18, 0x66, 0x1c, 0x30, 0x77, 0x9c, 0x70, 0x0,
-    0xfc, 0x70, 0x80, 0x0, 0xc0, 0xc0, 0x0, 0x0,
-    0x0,
-
-    /* U+0039 "9" */
-    0x0, 0x0, 0x3, 0xc0, 0x0, 0x0, 0x1f, 0xc0,
-    0x0, 0x0, 0x78, 0xc0, 0x0, 0x1, 0xc0, 0xc0,
-    0x0, 0x3, 0x0, 0xc0, 0x0, 0xc, 0x0, 0xc0,
-    0x0, 0x30, 0x1, 0x80, 0x0, 0xc0, 0x3, 0x0,
-    0x3, 0x0, 0xe, 0x0, 0xc, 0x0, 0x18, 0x0,
-    0x18, 0x0, 0x60, 0x0, 0x31, 0x81, 0x80, 0x0,
-    0x67, 0x6, 0x0, 0x0, 0x5c, 0x18, 0x0, 0x3c,
-    0x70, 0x60, 0x0, 0xfd, 0xd3, 0x80, 0x3, 0x87,
-    0x7e, 0x0, 0xe, 0x1c, 0x78, 0x0, 0x38, 0x74,
-    0x0, 0x0, 0xe1, 0xcc, 0x0, 0x3, 0x81, 0x18,
-    0x0, 0xe, 0x0, 0x30, 0x0, 0x38, 0x0, 0xe0,
-    0x0, 0x60, 0x3, 0x80, 0x0, 0xc0, 0xe, 0x0,
-    0x1, 0x80, 0x38, 0x0, 0x1, 0x80, 0xe0, 0x0,
-    0x3, 0x83, 0x80, 0x0, 0x3, 0x8e, 0x0, 0x0,
-    0x3, 0xf8, 0x0, 0x0, 0x1, 0xe0, 0x0, 0x0,
-    0x0,
-
-    /* U+003A ":" */
-    0x7f, 0xff, 0xff, 0xff, 0xef, 0xff, 0xff, 0xff,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x3c, 0x0, 0x0,
-    0x0, 0x3, 0xc0, 0x0, 0x0, 0x0, 0x3c, 0x0,
-    0x0, 0x0, 0x3, 0xc0, 0x0, 0x0, 0x0, 0x3c,
-    0x0, 0x0, 0x0, 0x3, 0xc0, 0x0, 0x0, 0x0,
-    0x3c, 0x0, 0x0, 0x0, 0x3, 0xc0, 0x8, 0x0,
-    0x60, 0x3c, 0x1, 0xc0, 0xf, 0x3, 0xc0, 0x1e,
-    0x0, 0x60, 0x3c, 0x3, 0xe0, 0x0, 0x3, 0xc0,
-    0x3f, 0x0, 0x0, 0x3c, 0x7, 0xf8, 0x0, 0x3,
-    0xc0, 0x7f, 0xc0, 0x80, 0x3c, 0xf, 0xfe, 0x18,
-    0x3, 0xc0, 0xff, 0xe3, 0xc0, 0x3c, 0x1f, 0xff,
-    0xfe, 0x3, 0xc1, 0xff, 0xff, 0xf0, 0x3c, 0x3f,
-    0xff, 0xff, 0x3, 0xc3, 0xff, 0xff, 0xf8, 0x3c,
-    0x7f, 0xff, 0xff, 0xc3, 0xc7, 0xff, 0xff, 0xfe,
-    0x3c, 0xff, 0xff, 0xff, 0xf3, 0xc0, 0x0, 0x0,
-    0x0, 0x3c, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff,
-    0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xfe,
-
     /* U+003B ";" */
     0xf, 0xff, 0xff, 0xff, 0xe1, 0xff, 0xff, 0xff,
     0xff, 0x18, 0x0, 0x0, 0x0, 0x31, 0x80, 0x0,
@@ -534,54 +61,6 @@ static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] = {
     0x1f, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff,
     0xfe,
 
-    /* U+003C "<" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xf0,
-    0x0, 0x0, 0x3f, 0xff, 0xc0, 0x0, 0xf, 0xe6,
-    0x7f, 0x0, 0x1, 0xdc, 0x63, 0xb8, 0x0, 0x79,
-    0x86, 0x19, 0xe0, 0xe, 0x38, 0x61, 0xc7, 0x0,
-    0xc3, 0x6, 0xc, 0x30, 0x18, 0x70, 0x60, 0xe3,
-    0x83, 0x86, 0x6, 0x6, 0x1c, 0x30, 0x60, 0x60,
-    0x60, 0xc7, 0xff, 0xff, 0xff, 0xfe, 0x7f, 0xff,
-    0xff, 0xff, 0xe6, 0xc, 0x6, 0x3, 0x6, 0xc0,
-    0xc0, 0x60, 0x30, 0x3c, 0xc, 0x6, 0x3, 0x3,
-    0xc0, 0xc0, 0x60, 0x30, 0x3c, 0xc, 0x6, 0x3,
-    0x3, 0xc0, 0xc0, 0x60, 0x30, 0x3c, 0xc, 0x6,
-    0x3, 0x3, 0xc0, 0xc0, 0x60, 0x30, 0x3c, 0xc,
-    0x6, 0x3, 0x3, 0xe0, 0xc0, 0x60, 0x30, 0x67,
-    0xff, 0xff, 0xff, 0xfe, 0x7f, 0xff, 0xff, 0xff,
-    0xe3, 0x6, 0x6, 0x6, 0xc, 0x38, 0x60, 0x60,
-    0x61, 0xc1, 0x87, 0x6, 0xe, 0x18, 0x1c, 0x30,
-    0x60, 0xc3, 0x80, 0xe3, 0x86, 0x1c, 0x70, 0x7,
-    0x18, 0x61, 0x9e, 0x0, 0x3d, 0xc6, 0x3b, 0xc0,
-    0x1, 0xfe, 0x67, 0xf8, 0x0, 0x7, 0xff, 0xfe,
-    0x0, 0x0, 0x1f, 0xff, 0x80, 0x0, 0x0, 0x3f,
-    0xc0, 0x0,
-
-    /* U+003D "=" */
-    0x0, 0x0, 0xf, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0x80, 0x0, 0x0, 0xc, 0xdf, 0x80, 0x0, 0x3,
-    0xf3, 0xf, 0x80, 0x0, 0x7f, 0xcc, 0xf, 0x0,
-    0x3, 0xff, 0x30, 0x1e, 0x0, 0x3f, 0xfc, 0xc0,
-    0x1c, 0x1, 0xff, 0xf3, 0x0, 0x38, 0xf, 0xff,
-    0xcc, 0x0, 0xe0, 0x3f, 0xff, 0x30, 0x1, 0xc1,
-    0xff, 0xfc, 0xc0, 0x3, 0xf, 0xff, 0xf3, 0x0,
-    0xe, 0x3f, 0xff, 0xcc, 0x0, 0x19, 0xff, 0xff,
-    0x30, 0x0, 0x67, 0xff, 0xfc, 0xc0, 0x1, 0xdf,
-    0xff, 0xf3, 0x0, 0x3, 0xff, 0xff, 0xcf, 0xff,
-    0xff, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xfc,
-    0x0, 0x0, 0x3f, 0xff, 0xf0, 0x0, 0x0, 0xff,
-    0xff, 0xff, 0xff, 0xe3, 0xff, 0xff, 0xff, 0xff,
-    0x8f, 0xff, 0xff, 0xff, 0xfe, 0x3f, 0xff, 0xff,
-    0xff, 0xf8, 0x7f, 0xff, 0xff, 0xff, 0xe1, 0xff,
-    0xff, 0xff, 0xff, 0x87, 0xff, 0xff, 0xff, 0xfc,
-    0xf, 0xff, 0xff, 0xff, 0xf0, 0x3f, 0xff, 0xff,
-    0xff, 0x80, 0x7f, 0xff, 0xff, 0xfe, 0x1, 0xff,
-    0xff, 0xff, 0xf0, 0x3, 0xff, 0xff, 0xff, 0x80,
-    0x7, 0xff, 0xff, 0xfe, 0x0, 0xf, 0xff, 0xff,
-    0xf0, 0x0, 0x1f, 0xff, 0xff, 0x0, 0x0, 0x1f,
-    0xff, 0xf8, 0x0, 0x0, 0x1f, 0xff, 0x80, 0x0,
-    0x0, 0xf, 0xf0, 0x0, 0x0,
-
     /* U+003E ">" */
     0xf, 0xff, 0xff, 0xff, 0xe1, 0xff, 0xff, 0xff,
     0xff, 0x18, 0x0, 0x0, 0x0, 0x31, 0x80, 0x0,
@@ -593,1281 +72,7 @@ static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] = {
     0x0, 0x0, 0x31, 0x80, 0x0, 0x0, 0x3, 0x18,
     0x0, 0x0, 0x0, 0x31, 0x80, 0x0, 0x0, 0x3,
     0x1f, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff,
-    0xfe,
-
-    /* U+003F "?" */
-    0x0, 0x0, 0xf, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0x80, 0x0, 0x0, 0xc, 0xdf, 0x80, 0x0, 0x3,
-    0xf3, 0xf, 0x80, 0x0, 0x7f, 0xcc, 0xf, 0x0,
-    0x3, 0xe3, 0x30, 0x1e, 0x0, 0x3c, 0xc, 0xc0,
-    0x1c, 0x1, 0xe0, 0x33, 0x0, 0x38, 0xe, 0x0,
-    0xcc, 0x0, 0xe0, 0x30, 0x3, 0x30, 0x1, 0xc1,
-    0x80, 0xc, 0xc0, 0x3, 0xe, 0x0, 0x33, 0x0,
-    0xe, 0x30, 0x0, 0xcc, 0x0, 0x19, 0xc0, 0x3,
-    0x30, 0x0, 0x66, 0x0, 0xc, 0xc0, 0x1, 0xd8,
-    0x0, 0x33, 0x0, 0x3, 0xc0, 0x0, 0xcf, 0xff,
-    0xff, 0x0, 0x3, 0x3f, 0xff, 0xfc, 0x0, 0xc,
-    0x0, 0x0, 0x30, 0x0, 0x30, 0x0, 0x0, 0xc0,
-    0x0, 0xff, 0xff, 0xe3, 0x0, 0x3, 0xff, 0xff,
-    0x8c, 0x0, 0x0, 0x0, 0x6, 0x30, 0x0, 0x0,
-    0x0, 0x18, 0x60, 0x0, 0x0, 0x0, 0x61, 0x80,
-    0x0, 0x0, 0x3, 0x86, 0x0, 0x0, 0x0, 0xc,
-    0xc, 0x0, 0x0, 0x0, 0x70, 0x30, 0x0, 0x0,
-    0x1, 0x80, 0x60, 0x0, 0x0, 0xe, 0x1, 0xc0,
-    0x0, 0x0, 0x70, 0x3, 0x80, 0x0, 0x3, 0x80,
-    0x7, 0x0, 0x0, 0x1e, 0x0, 0xe, 0x0, 0x0,
-    0xf0, 0x0, 0x1e, 0x0, 0xf, 0x0, 0x0, 0x1f,
-    0x1, 0xf8, 0x0, 0x0, 0x1f, 0xff, 0x80, 0x0,
-    0x0, 0xf, 0xf0, 0x0, 0x0,
-
-    /* U+0040 "@" */
-    0x3, 0xff, 0x80, 0x0, 0x0, 0x7f, 0xfc, 0x0,
-    0x0, 0x6, 0x1, 0xe0, 0x0, 0x0, 0x60, 0x1b,
-    0x0, 0x0, 0x6, 0x1, 0x98, 0x0, 0x0, 0x60,
-    0x18, 0xc0, 0x0, 0x6, 0x1, 0x86, 0x0, 0x0,
-    0x60, 0x18, 0x30, 0x0, 0x6, 0x1, 0x81, 0x80,
-    0x0, 0x60, 0x18, 0xc, 0x0, 0x6, 0x1, 0x80,
-    0x70, 0x0, 0x60, 0x18, 0x3, 0x80, 0x6, 0x1,
-    0x80, 0x1c, 0x0, 0x60, 0x18, 0x0, 0xe0, 0x6,
-    0x1, 0xff, 0xfe, 0x0, 0x60, 0xf, 0xff, 0xe0,
-    0x6, 0x0, 0x0, 0x6, 0x0, 0x60, 0x0, 0x0,
-    0x60, 0x6, 0x0, 0x0, 0x6, 0x0, 0x60, 0x0,
-    0x0, 0x60, 0x6, 0x0, 0x0, 0x6, 0x0, 0x60,
-    0x0, 0x0, 0x60, 0x7f, 0xff, 0xff, 0xff, 0xef,
-    0xff, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x3c, 0x0, 0x0, 0x0, 0x3, 0xc0, 0x0, 0x0,
-    0x0, 0x3c, 0x0, 0x1f, 0xff, 0xe3, 0xc0, 0x1,
-    0xff, 0xfe, 0x3c, 0x0, 0x0, 0x0, 0x3, 0xc0,
-    0x0, 0x0, 0x0, 0x3c, 0x0, 0x0, 0x0, 0x3,
-    0xc0, 0x0, 0x7, 0xfe, 0x3c, 0x0, 0x0, 0x7f,
-    0xe3, 0xc0, 0x0, 0x0, 0x0, 0x3c, 0x0, 0x0,
-    0x0, 0x3, 0xc0, 0x0, 0x0, 0x0, 0x3c, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0xff, 0xff, 0xf7,
-    0xff, 0xff, 0xff, 0xfe,
-
-    /* U+0041 "A" */
-    0x7f, 0xf0, 0x0, 0x3f, 0xfe, 0x0, 0xc, 0x3,
-    0xc0, 0x3, 0x0, 0xd8, 0x0, 0xc0, 0x33, 0x0,
-    0x30, 0xc, 0x60, 0xc, 0x3, 0xc, 0x3, 0x0,
-    0xc1, 0xc0, 0xc0, 0x30, 0x38, 0x30, 0xc, 0x7,
-    0xc, 0x3, 0x0, 0xe3, 0x0, 0xc0, 0x1c, 0xc0,
-    0x30, 0x3, 0xb0, 0xc, 0x0, 0x7c, 0x3, 0xff,
-    0xff, 0x0, 0x7f, 0xff, 0xc0, 0x0, 0x0, 0xf0,
-    0x0, 0x0, 0x3c, 0x0, 0x0, 0xf, 0x0, 0x0,
-    0x3, 0xc0, 0x0, 0x0, 0xf0, 0x0, 0x0, 0x3c,
-    0x0, 0x0, 0xf, 0x0, 0x0, 0x3, 0xc0, 0x0,
-    0x0, 0xf0, 0x0, 0x0, 0x3c, 0x0, 0x0, 0xf,
-    0x0, 0x0, 0x3, 0xc0, 0x0, 0x0, 0xf0, 0x0,
-    0x0, 0x3c, 0x0, 0x0, 0xf, 0x0, 0x0, 0x3,
-    0xc0, 0x0, 0x0, 0xf0, 0x0, 0x0, 0x3c, 0x0,
-    0x0, 0xf, 0x0, 0x0, 0x3, 0xc0, 0x0, 0x0,
-    0xf0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xfd, 0xff,
-    0xff, 0xfe,
-
-    /* U+0042 "B" */
-    0x7f, 0xf0, 0x0, 0x3f, 0xfe, 0x0, 0xc, 0x3,
-    0xc0, 0x3, 0x0, 0xd8, 0x0, 0xc0, 0x33, 0x0,
-    0x30, 0xc, 0x60, 0xc, 0x3, 0xc, 0x3, 0x0,
-    0xc1, 0xc0, 0xc0, 0x30, 0x38, 0x30, 0xc, 0x7,
-    0xc, 0x3, 0x0, 0xe3, 0x0, 0xc0, 0x1c, 0xc0,
-    0x30, 0x3, 0xb0, 0xc, 0x0, 0x7c, 0x3, 0xff,
-    0xff, 0x0, 0x7f, 0xff, 0xc0, 0x0, 0x0, 0xf0,
-    0x0, 0x0, 0x3c, 0x0, 0x0, 0xf, 0x0, 0x0,
-    0x3, 0xcc, 0xff, 0xfe, 0xf3, 0x3f, 0xff, 0xbc,
-    0x0, 0x0, 0xf, 0x0, 0x0, 0x3, 0xc0, 0x0,
-    0x0, 0xf3, 0x3f, 0xff, 0xbc, 0xcf, 0xff, 0xef,
-    0x0, 0x0, 0x3, 0xc0, 0x0, 0x0, 0xf0, 0x0,
-    0x0, 0x3c, 0xcf, 0xff, 0xef, 0x33, 0xff, 0xfb,
-    0xc0, 0x0, 0x0, 0xf0, 0x0, 0x0, 0x3c, 0x0,
-    0x0, 0xf, 0x0, 0x0, 0x3, 0xc0, 0x0, 0x0,
-    0xf0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xfd, 0xff,
-    0xff, 0xfe,
-
-    /* U+0043 "C" */
-    0x7f, 0xf0, 0x0, 0x0, 0x7, 0xff, 0xc0, 0x0,
-    0x0, 0x30, 0xf, 0x0, 0x0, 0x1, 0x80, 0x6c,
-    0x0, 0x0, 0xc, 0x3, 0x30, 0x0, 0x0, 0x60,
-    0x18, 0xc0, 0x0, 0x3, 0x0, 0xc3, 0x0, 0x0,
-    0x18, 0x6, 0xc, 0x0, 0x0, 0xc0, 0x30, 0x30,
-    0x0, 0x6, 0x1, 0x80, 0xc0, 0x0, 0x30, 0xc,
-    0x3, 0x80, 0x1, 0x80, 0x60, 0xe, 0x0, 0xc,
-    0x3, 0x0, 0x38, 0x0, 0x60, 0x18, 0x0, 0xe0,
-    0x3, 0x0, 0xff, 0xff, 0x0, 0x18, 0x3, 0xff,
-    0xf8, 0x0, 0xc0, 0x0, 0x0, 0xc0, 0x6, 0x0,
-    0x0, 0x6, 0x0, 0x30, 0x0, 0x0, 0x30, 0x1,
-    0x9f, 0xff, 0xfd, 0x80, 0xc, 0xff, 0xff, 0xec,
-    0x18, 0x60, 0x0, 0x0, 0x61, 0xe3, 0x0, 0x0,
-    0x3, 0x1f, 0x98, 0x0, 0x0, 0x1, 0xce, 0xcf,
-    0xff, 0xfe, 0x1e, 0x3e, 0x7f, 0xff, 0xf1, 0xf9,
-    0xf0, 0x0, 0x0, 0x1c, 0xfd, 0x80, 0x0, 0x1,
-    0xc3, 0xcc, 0x0, 0x0, 0x1c, 0x1c, 0x67, 0xfe,
-    0x1, 0xc1, 0xc3, 0x3f, 0xf0, 0x1c, 0x1c, 0x18,
-    0x0, 0x1, 0xc1, 0xc0, 0xc0, 0x0, 0x1c, 0x1c,
-    0x6, 0x7f, 0xe0, 0xc1, 0xc0, 0x33, 0xff, 0xc,
-    0x1c, 0x1, 0x80, 0x0, 0x61, 0xc0, 0xc, 0x0,
-    0x3, 0x1c, 0x0, 0x60, 0x0, 0x17, 0xc0, 0x3,
-    0xff, 0xf9, 0xfc, 0x0, 0xf, 0xff, 0xce, 0x0,
-    0x0,
-
-    /* U+0044 "D" */
-    0x7f, 0xf0, 0x0, 0x3, 0xff, 0xe0, 0x0, 0xc,
-    0x3, 0xc0, 0x0, 0x30, 0xd, 0x80, 0x0, 0xc0,
-    0x33, 0x0, 0x3, 0x0, 0xc6, 0x0, 0xc, 0x3,
-    0xc, 0x0, 0x30, 0xc, 0x18, 0x0, 0xc0, 0x30,
-    0x30, 0x3, 0x0, 0xc0, 0x60, 0xc, 0x3, 0x0,
-    0xe0, 0x30, 0xc, 0x1, 0xc0, 0xc0, 0x30, 0x3,
-    0x83, 0x0, 0xc0, 0x7, 0xc, 0x3, 0xff, 0xfc,
-    0x30, 0x7, 0xff, 0xf0, 0xc0, 0x0, 0x0, 0xc3,
-    0x0, 0x0, 0x3, 0xc, 0x0, 0x0, 0xc, 0x30,
-    0x0, 0x0, 0x30, 0xc0, 0x0, 0x0, 0xc3, 0x0,
-    0x0, 0x3, 0xc, 0x0, 0x0, 0xc, 0x30, 0x0,
-    0x0, 0x30, 0xc0, 0x0, 0x0, 0xc3, 0x0, 0x0,
-    0x3, 0xc, 0x0, 0x0, 0xc, 0x30, 0x0, 0x0,
-    0x30, 0xc0, 0x0, 0x0, 0x3, 0x0, 0x0, 0x0,
-    0xc, 0x0, 0x0, 0xc, 0x30, 0x0, 0x0, 0x30,
-    0xc0, 0x0, 0x0, 0xc3, 0x0, 0x0, 0x3, 0xc,
-    0x0, 0x0, 0xff, 0xf0, 0x0, 0x3, 0xff, 0xc0,
-    0x0, 0x0, 0xc3, 0x0, 0x0, 0x3, 0xf, 0xff,
-    0xff, 0xc, 0x1f, 0xff, 0xfc, 0x30,
-
-    /* U+0045 "E" */
-    0x7f, 0xff, 0x0, 0x0, 0xf, 0xff, 0xf8, 0x0,
-    0x0, 0xc0, 0x1, 0x80, 0x0, 0xc, 0x0, 0x18,
-    0x0, 0x0, 0xc0, 0x1, 0x80, 0x0, 0xf, 0xff,
-    0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0x3, 0xc0, 0x0, 0x0, 0x0,
-    0x3c, 0x0, 0x0, 0x0, 0x3, 0xc0, 0x0, 0x0,
-    0x0, 0x3c, 0x0, 0x0, 0x0, 0x3, 0xc0, 0x0,
-    0x0, 0x0, 0x3c, 0x0, 0x0, 0x0, 0x3, 0xc0,
-    0x0, 0x0, 0x0, 0x3c, 0x0, 0x0, 0x0, 0x3,
-    0xc0, 0x0, 0x0, 0x0, 0x3c, 0x0, 0x0, 0x0,
-    0x3, 0xc0, 0x0, 0x0, 0x0, 0x3c, 0x0, 0x0,
-    0x0, 0x3, 0xc0, 0x0, 0x0, 0x0, 0x3c, 0x0,
-    0x0, 0x0, 0x3, 0xc0, 0x0, 0x0, 0x0, 0x3c,
-    0x0, 0x0, 0x0, 0x3, 0xc0, 0x0, 0x0, 0x0,
-    0x3c, 0x0, 0x0, 0x0, 0x3, 0xc0, 0x0, 0x0,
-    0x0, 0x3c, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff,
-    0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xfe,
-
-    /* U+0046 "F" */
-    0x0, 0x60, 0x6, 0x0, 0x0, 0x60, 0x6, 0x0,
-    0x0, 0x60, 0x6, 0x0, 0x7f, 0xff, 0xff, 0xfe,
-    0xff, 0xff, 0xff, 0xff, 0xc0, 0x60, 0x6, 0x3,
-    0xc0, 0x0, 0x0, 0x3, 0xc0, 0x0, 0x0, 0x3,
-    0xc0, 0x0, 0x0, 0x3, 0xc0, 0x0, 0x0, 0x3,
-    0xc0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x3,
-    0xc0, 0x0, 0x0, 0x3, 0xc0, 0x0, 0x0, 0x3,
-    0xc7, 0xdf, 0x0, 0x3, 0xc7, 0xdf, 0x0, 0x3,
-    0xc7, 0xdf, 0x0, 0x3, 0xc7, 0xdf, 0x0, 0x3,
-    0xc7, 0xdf, 0x0, 0x3, 0xc0, 0x0, 0x0, 0x3,
-    0xc7, 0xc0, 0x0, 0x3, 0xc7, 0xc0, 0x0, 0x3,
-    0xc7, 0xc0, 0x0, 0x3, 0xc7, 0xc0, 0x0, 0x3,
-    0xc7, 0xc0, 0x0, 0x3, 0xc0, 0x0, 0x0, 0x3,
-    0xc0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xff, 0xff,
-    0x7f, 0xff, 0xff, 0xfe,
-
-    /* U+0047 "G" */
-    0x7f, 0xff, 0xff, 0xff, 0xef, 0xff, 0xff, 0xff,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x3c, 0x0, 0x0,
-    0x0, 0x3, 0xcd, 0xe0, 0x0, 0x0, 0x3c, 0xde,
-    0x0, 0x0, 0x3, 0xc0, 0x0, 0x0, 0x0, 0x3c,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x3c, 0x0, 0x0, 0x0, 0x3, 0xc0, 0x0,
-    0x0, 0x0, 0x3c, 0x0, 0x0, 0x0, 0x3, 0xc0,
-    0x0, 0x0, 0x0, 0x3c, 0x0, 0x0, 0x0, 0x3,
-    0xc0, 0x0, 0x0, 0x0, 0x3c, 0x0, 0x0, 0x0,
-    0x3, 0xc0, 0x0, 0x0, 0x0, 0x3c, 0x0, 0x0,
-    0x0, 0x3, 0xc0, 0x0, 0x0, 0x0, 0x3c, 0x0,
-    0x0, 0x0, 0x3, 0xc0, 0x0, 0x0, 0x0, 0x3c,
-    0x0, 0x0, 0x0, 0x3, 0xc0, 0x0, 0x0, 0x0,
-    0x3c, 0x0, 0x0, 0x0, 0x3, 0xc0, 0x0, 0x0,
-    0x0, 0x3c, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff,
-    0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xfe,
-
-    /* U+0048 "H" */
-    0x7f, 0xff, 0xff, 0xff, 0xef, 0xff, 0xff, 0xff,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x3c, 0x0, 0x0,
-    0x0, 0x3, 0xcd, 0xe0, 0x0, 0x0, 0x3c, 0xde,
-    0x0, 0x0, 0x3, 0xc0, 0x0, 0x0, 0x0, 0x3c,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x3c, 0x0, 0x0, 0x0, 0x3, 0xc0, 0x0,
-    0x0, 0x0, 0x3c, 0x0, 0x0, 0x0, 0x3, 0xc0,
-    0x0, 0x8, 0x0, 0x3c, 0x0, 0x70, 0xe0, 0x3,
-    0xc0, 0xe, 0xf, 0x80, 0x3c, 0x3, 0xc0, 0x3c,
-    0x3, 0xc0, 0x70, 0x1, 0xf0, 0x3c, 0x6, 0x0,
-    0xf, 0x3, 0xc0, 0x38, 0x1, 0xe0, 0x3c, 0x1,
-    0xe0, 0x78, 0x3, 0xc0, 0x7, 0xf, 0x0, 0x3c,
-    0x0, 0x30, 0xc0, 0x3, 0xc0, 0x0, 0x0, 0x0,
-    0x3c, 0x0, 0x0, 0x0, 0x3, 0xc0, 0x0, 0x0,
-    0x0, 0x3c, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff,
-    0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xfe,
-
-    /* U+0049 "I" */
-    0x0, 0x1f, 0xff, 0x80, 0x0, 0x1, 0xff, 0xf8,
-    0x0, 0x0, 0x18, 0x1, 0x80, 0x0, 0x1, 0x80,
-    0x18, 0x0, 0x0, 0x18, 0x1, 0x80, 0x7, 0xff,
-    0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xfc,
-    0xc, 0x0, 0x3, 0x3, 0xc0, 0xc0, 0x0, 0x30,
-    0x3c, 0xc, 0x0, 0x3, 0x3, 0xc0, 0xc0, 0x0,
-    0x30, 0x3c, 0xc, 0x0, 0x3, 0x3, 0xc0, 0xc0,
-    0x0, 0x30, 0x3c, 0xc, 0x0, 0x3, 0x3, 0xc0,
-    0xc0, 0x0, 0x30, 0x3c, 0xc, 0x0, 0x3, 0x3,
-    0xc0, 0xc0, 0x0, 0x30, 0x3c, 0xc, 0x0, 0x3,
-    0x3, 0xc0, 0xc0, 0x0, 0x30, 0x3c, 0xc, 0x0,
-    0x3, 0x3, 0xc0, 0xc0, 0x0, 0x30, 0x3c, 0xc,
-    0x0, 0x3, 0x3, 0xc0, 0xc0, 0x0, 0x30, 0x3c,
-    0xc, 0x0, 0x3, 0x3, 0xc0, 0xc0, 0x0, 0x30,
-    0x3c, 0xc, 0x0, 0x3, 0x3, 0xc0, 0xc0, 0x0,
-    0x30, 0x3c, 0xc, 0x0, 0x3, 0x3, 0xc0, 0xc0,
-    0x0, 0x30, 0x3c, 0xc, 0x0, 0x3, 0x3, 0xc0,
-    0xc0, 0x0, 0x30, 0x3f, 0xff, 0xff, 0xff, 0xff,
-    0x7f, 0xff, 0xff, 0xff, 0xe0,
-
-    /* U+004A "J" */
-    0x0, 0x0, 0xf0, 0x0, 0x0, 0x0, 0x1f, 0x80,
-    0x0, 0x0, 0x3, 0x9c, 0x0, 0x0, 0x0, 0x70,
-    0xe0, 0x0, 0x0, 0x1f, 0xf, 0x80, 0x0, 0x7,
-    0x80, 0x1e, 0x0, 0x0, 0xf0, 0x0, 0xf0, 0x0,
-    0xc, 0x0, 0x3, 0x80, 0x1, 0x80, 0x0, 0x18,
-    0x0, 0x38, 0x0, 0x1, 0xc0, 0x3, 0x0, 0x0,
-    0xc, 0x0, 0x30, 0x0, 0x0, 0xc0, 0x3, 0x0,
-    0x0, 0xe, 0x0, 0x70, 0x0, 0x0, 0x60, 0x6,
-    0x0, 0x0, 0x6, 0x0, 0x60, 0x0, 0x0, 0x60,
-    0x6, 0x0, 0x0, 0x6, 0x0, 0x60, 0x0, 0x0,
-    0x60, 0x6, 0x0, 0x0, 0x7, 0x0, 0xe0, 0x0,
-    0x0, 0x70, 0xc, 0x0, 0x0, 0x3, 0x0, 0xc0,
-    0x0, 0x0, 0x30, 0xc, 0x0, 0x0, 0x3, 0x81,
-    0xc0, 0x0, 0x0, 0x38, 0x18, 0x0, 0x0, 0x1,
-    0x81, 0x80, 0x0, 0x0, 0x1c, 0x30, 0x0, 0x0,
-    0x0, 0xc3, 0x0, 0x0, 0x0, 0xe, 0x60, 0x0,
-    0x0, 0x0, 0x6f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xf8, 0x0, 0x0, 0x0, 0x1f, 0x80,
-    0x0, 0x0, 0x0, 0xf0, 0x0, 0x0,
-
-    /* U+004B "K" */
-    0x0, 0x7e, 0x0, 0x0, 0x7, 0xff, 0x80, 0x0,
-    0x1e, 0x7, 0x80, 0x0, 0x70, 0x3, 0xc0, 0x1,
-    0x80, 0x1, 0x80, 0x6, 0x0, 0x1, 0x80, 0x1c,
-    0x0, 0x3, 0x80, 0x30, 0x0, 0x3, 0x0, 0x60,
-    0x0, 0x6, 0x1, 0x80, 0x0, 0x6, 0x3, 0x0,
-    0x0, 0xc, 0x6, 0x0, 0x0, 0x18, 0xc, 0x0,
-    0x0, 0x30, 0x18, 0x0, 0x0, 0x60, 0x30, 0x0,
-    0x0, 0xc0, 0x30, 0x0, 0x3, 0x0, 0x60, 0x0,
-    0x6, 0x0, 0xe0, 0x0, 0x1c, 0x0, 0xc0, 0x0,
-    0x30, 0x0, 0xc0, 0x0, 0xf0, 0x0, 0xe0, 0x7,
-    0xf0, 0x0, 0xf0, 0x3f, 0xf0, 0x0, 0xff, 0xf3,
-    0xf0, 0x0, 0x3f, 0x83, 0xf0, 0x0, 0x0, 0x3,
-    0xf0, 0x0, 0x0, 0x3, 0xf0, 0x0, 0x0, 0x3,
-    0xf0, 0x0, 0x0, 0x3, 0xf0, 0x0, 0x0, 0x3,
-    0xe0, 0x0, 0x0, 0x3, 0xc0, 0x0, 0x0, 0x3,
-    0x0,
-
-    /* U+004C "L" */
-    0x0, 0x7e, 0x0, 0x0, 0x3, 0xff, 0xc0, 0x0,
-    0x7, 0x81, 0xe0, 0x0, 0xe, 0x0, 0x78, 0x0,
-    0x18, 0x0, 0x18, 0x0, 0x30, 0x0, 0xc, 0x0,
-    0x70, 0x0, 0xe, 0x0, 0x60, 0x0, 0x6, 0x0,
-    0x60, 0x0, 0x6, 0x0, 0xc0, 0x0, 0x3, 0x0,
-    0xc0, 0x0, 0x3, 0x0, 0xc1, 0xff, 0x83, 0x0,
-    0xc1, 0xff, 0x83, 0x0, 0xc0, 0x0, 0x3, 0x0,
-    0xc0, 0x0, 0x3, 0x0, 0x60, 0x0, 0x6, 0x0,
-    0x60, 0x0, 0x6, 0x0, 0x70, 0x0, 0xe, 0x0,
-    0x30, 0x0, 0xc, 0x0, 0x18, 0x0, 0x1e, 0x0,
-    0xe, 0x0, 0x7f, 0x0, 0x7, 0x81, 0xff, 0x80,
-    0x3, 0xff, 0xdf, 0xc0, 0x0, 0xff, 0x7, 0xe0,
-    0x0, 0x0, 0x3, 0xf0, 0x0, 0x0, 0x1, 0xf8,
-    0x0, 0x0, 0x0, 0xfc, 0x0, 0x0, 0x0, 0x7e,
-    0x0, 0x0, 0x0, 0x3e, 0x0, 0x0, 0x0, 0x1e,
-    0x0, 0x0, 0x0, 0xc,
-
-    /* U+004D "M" */
-    0x7f, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff,
-    0xc0, 0x0, 0x0, 0x3, 0xc0, 0x0, 0x0, 0x3,
-    0xc0, 0x0, 0x0, 0x3, 0xc0, 0x0, 0x0, 0x3,
-    0xc0, 0x0, 0x0, 0x3, 0xc1, 0xff, 0xff, 0xc3,
-    0xc1, 0xff, 0xff, 0xc3, 0xc0, 0x0, 0x0, 0x3,
-    0xc0, 0x0, 0x0, 0x3, 0xc0, 0x0, 0x0, 0x3,
-    0xc0, 0x3f, 0xff, 0xc3, 0xc0, 0x3f, 0xff, 0xc3,
-    0xc0, 0x0, 0x0, 0x3, 0xc0, 0x0, 0x0, 0x3,
-    0xc0, 0x0, 0xff, 0xc3, 0xc0, 0x0, 0xff, 0xc3,
-    0xc0, 0x0, 0x0, 0x3, 0xc0, 0x0, 0x0, 0x3,
-    0xc0, 0x0, 0x0, 0x3, 0xc0, 0x0, 0x0, 0x3,
-    0xc0, 0x0, 0x0, 0x3, 0xc0, 0x0, 0x0, 0x3,
-    0xc0, 0x0, 0x0, 0x3, 0xc0, 0x0, 0x0, 0x3,
-    0xff, 0xff, 0xf1, 0xff, 0x7f, 0xff, 0xf9, 0xfe,
-    0x0, 0x0, 0x1f, 0x80, 0x0, 0x0, 0x7, 0x80,
-    0x0, 0x0, 0x3, 0x80, 0x0, 0x0, 0x0, 0x80,
-
-    /* U+004E "N" */
-    0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff,
-    0xc0, 0x60, 0x0, 0x0, 0x60, 0x30, 0x0, 0x0,
-    0x30, 0x18, 0x0, 0x0, 0x18, 0xc, 0x0, 0x0,
-    0xc, 0x6, 0x0, 0x0, 0x6, 0x0, 0x0, 0x0,
-    0x3, 0x0, 0x0, 0x0, 0x1, 0xbf, 0xff, 0xff,
-    0xc0, 0xff, 0xff, 0xff, 0xf0, 0x78, 0x0, 0x0,
-    0x18, 0x3c, 0x0, 0x0, 0xc, 0x1e, 0x0, 0x0,
-    0x6, 0xf, 0x0, 0x0, 0x3, 0x7, 0x8f, 0xff,
-    0xf1, 0x83, 0xc7, 0xff, 0xf8, 0xc1, 0xe0, 0x0,
-    0x0, 0x60, 0xf0, 0x0, 0x0, 0x33, 0xf8, 0x0,
-    0x0, 0x19, 0xec, 0x1, 0xff, 0x8c, 0x6, 0x0,
-    0xff, 0xc6, 0x3, 0x0, 0x0, 0x3, 0x1, 0x80,
-    0x0, 0x1, 0x80, 0xc0, 0x0, 0x0, 0xc0, 0x60,
-    0x0, 0x0, 0x60, 0x30, 0x0, 0x0, 0x30, 0x1f,
-    0xff, 0x8f, 0xf8, 0x7, 0xff, 0xe7, 0xf8, 0x0,
-    0x0, 0x3f, 0x0, 0x0, 0x0, 0x7, 0x80, 0x0,
-    0x0, 0x1, 0xc0, 0x0, 0x0, 0x0, 0x20, 0x0,
-    0x0,
-
-    /* U+004F "O" */
-    0x0, 0x0, 0x1, 0xf0, 0x0, 0x0, 0x7, 0xf0,
-    0x0, 0x0, 0x1c, 0x30, 0x0, 0x7, 0xf0, 0x30,
-    0x0, 0x1f, 0xc0, 0x60, 0x0, 0x73, 0x0, 0xc0,
-    0x0, 0xc0, 0x1, 0x80, 0x1, 0x80, 0x6, 0x0,
-    0x3, 0x80, 0x1c, 0x0, 0x3, 0x80, 0x70, 0x0,
-    0x7, 0x81, 0xc0, 0x0, 0x1f, 0x83, 0x80, 0x0,
-    0x73, 0x83, 0x0, 0x1, 0xc3, 0x86, 0x0, 0x7,
-    0x7, 0x9c, 0x0, 0x1c, 0x1f, 0xf0, 0x0, 0x70,
-    0x73, 0xc0, 0x1, 0xc1, 0xc0, 0x0, 0x7, 0x7,
-    0x0, 0x0, 0x1c, 0x1c, 0x0, 0x0, 0x70, 0x70,
-    0x0, 0x1, 0xc1, 0xc0, 0x0, 0x7, 0x7, 0x0,
-    0x0, 0x1c, 0x1c, 0x0, 0x0, 0x30, 0x70, 0x0,
-    0x0, 0xe1, 0xc0, 0x0, 0x1, 0x87, 0x0, 0x0,
-    0x7, 0x3c, 0x0, 0x0, 0xd, 0xf0, 0x0, 0x0,
-    0x1f, 0x80, 0x0, 0x0, 0x1c, 0x0, 0x0, 0x0,
-    0x0,
-
-    /* U+0050 "P" */
-    0x0, 0xfc, 0x0, 0x7, 0xf8, 0x0, 0x38, 0x70,
-    0x1, 0x80, 0x60, 0xe, 0x1, 0xc0, 0x30, 0x3,
-    0x0, 0xc0, 0xc, 0x3, 0x0, 0x30, 0xc, 0x0,
-    0xc0, 0x38, 0x7, 0x0, 0x60, 0x18, 0x0, 0xe1,
-    0xc0, 0x1, 0xfe, 0x0, 0x3, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xc0, 0xf, 0xff, 0xc0, 0x70,
-    0x3, 0x83, 0x80, 0x7, 0x1c, 0x0, 0xe, 0x60,
-    0x0, 0x1b, 0x80, 0x0, 0x3c, 0x0, 0x0, 0xf0,
-    0x0, 0x3, 0xc0, 0x0, 0xf, 0x0, 0x0, 0x3c,
-    0x0, 0x0, 0xf0, 0x0, 0x3, 0xc0, 0x0, 0xf,
-    0x0, 0x0, 0x3c, 0x0, 0x0, 0xf0, 0x0, 0x3,
-    0xc0, 0x0, 0xf, 0x0, 0x0, 0x3f, 0xff, 0xff,
-    0xdf, 0xff, 0xfe,
-
-    /* U+0051 "Q" */
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfc,
-
-    /* U+0052 "R" */
-    0x0, 0x7e, 0x0, 0x3, 0xff, 0xc0, 0x7, 0x81,
-    0xe0, 0xe, 0x0, 0x70, 0x18, 0x0, 0x18, 0x30,
-    0x0, 0xc, 0x70, 0x0, 0xe, 0x60, 0x0, 0x6,
-    0x60, 0x0, 0x6, 0xc0, 0x0, 0x3, 0xc0, 0x0,
-    0x3, 0xc0, 0x0, 0x3, 0xc0, 0x0, 0x3, 0xc0,
-    0x0, 0x3, 0xc0, 0x0, 0x3, 0x60, 0x0, 0x6,
-    0x60, 0x0, 0x6, 0x60, 0x0, 0xe, 0x30, 0x0,
-    0xc, 0x30, 0x0, 0x1c, 0x18, 0x0, 0x18, 0x18,
-    0x0, 0x38, 0xc, 0x0, 0x70, 0x4, 0x0, 0x70,
-    0x6, 0x0, 0x60, 0x6, 0x0, 0xe0, 0x3, 0xff,
-    0xc0, 0x3, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0x0, 0x1, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7c, 0x0, 0x0, 0x7c, 0x0,
-
-    /* U+0053 "S" */
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xe0, 0xf, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xf8,
-    0x3, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
-    0x80, 0x3f, 0xff, 0xe0, 0x0,
-
-    /* U+0054 "T" */
-    0x7f, 0xff, 0xff, 0xcf, 0xff, 0xff, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0xf8, 0x1, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xff, 0xf9, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0xff, 0x0, 0x3f, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xfc, 0x0, 0xff, 0xff, 0x80,
-
-    /* U+0055 "U" */
-    0x0, 0x3, 0xfc, 0x0, 0x0, 0x1, 0xff, 0xf8,
-    0x0, 0x0, 0x7f, 0xc3, 0xe0, 0x0, 0x1f, 0xfc,
-    0x7, 0x80, 0x3, 0xff, 0xc0, 0x1c, 0x0, 0x7f,
-    0xfc, 0x1, 0xe0, 0xe, 0x3e, 0x0, 0x3f, 0x1,
-    0xc1, 0x0, 0x3, 0xf8, 0x1c, 0x0, 0x0, 0x3f,
-    0x83, 0x80, 0x0, 0x1, 0xfc, 0x30, 0x0, 0x0,
-    0x1f, 0xc7, 0x0, 0x0, 0x0, 0xfe, 0x60, 0x0,
-    0x38, 0x7, 0xe7, 0x80, 0x1f, 0xc0, 0x3e, 0xfc,
-    0x7, 0xfe, 0x0, 0x3f, 0xc0, 0x7f, 0xe0, 0x3,
-    0xfc, 0x7, 0xff, 0x0, 0x3f, 0xc0, 0x7f, 0xf8,
-    0x3, 0xfc, 0x7, 0xff, 0x80, 0x3f, 0xc0, 0x7f,
-    0xf0, 0x3, 0xfc, 0x7, 0xfe, 0x0, 0x3f, 0xc0,
-    0x7f, 0xc0, 0x3, 0x70, 0x1, 0xfc, 0x3, 0xe6,
-    0x0, 0x3, 0x80, 0x7e, 0x70, 0x0, 0x0, 0x7,
-    0xe3, 0x0, 0x0, 0x0, 0xfc, 0x38, 0x0, 0x0,
-    0x1f, 0xc1, 0xc0, 0x0, 0x1, 0xf8, 0x1c, 0x0,
-    0x0, 0x3f, 0x80, 0xe3, 0xc0, 0x1, 0xf0, 0x7,
-    0xff, 0xc0, 0x1e, 0x0, 0x3f, 0xfc, 0x1, 0xc0,
-    0x1, 0xff, 0xc0, 0x78, 0x0, 0x7, 0xfc, 0x3e,
-    0x0, 0x0, 0x1f, 0xff, 0x80, 0x0, 0x0, 0x3f,
-    0xc0, 0x0,
-
-    /* U+0056 "V" */
-    0x0, 0x0, 0x0, 0xff, 0xc0, 0x0, 0x3, 0xff,
-    0xfc, 0x0, 0x3, 0xfc, 0x1, 0x80, 0x1, 0xf8,
-    0x0, 0x30, 0x0, 0xf8, 0x0, 0x6, 0x0, 0x38,
-    0x0, 0x0, 0xc0, 0x1e, 0x0, 0x0, 0x18, 0x7,
-    0x0, 0x0, 0x3, 0x1, 0xc0, 0x0, 0x0, 0x60,
-    0x70, 0x0, 0x0, 0xc, 0xc, 0x0, 0x0, 0x3,
-    0x83, 0x0, 0x1, 0x80, 0x60, 0xe0, 0x6, 0x70,
-    0xc, 0x18, 0x0, 0xfe, 0x1, 0x87, 0x0, 0xf,
-    0x80, 0x30, 0xc0, 0x18, 0xe0, 0xe, 0x38, 0x3,
-    0xbe, 0x1, 0x86, 0x0, 0x1e, 0xe0, 0x30, 0xc0,
-    0x7f, 0xc0, 0xe, 0x38, 0x7, 0xdc, 0x1, 0x86,
-    0x0, 0x79, 0x80, 0x70, 0xc0, 0x1f, 0x0, 0xc,
-    0x18, 0x7, 0x70, 0x3, 0x87, 0x0, 0xc6, 0x0,
-    0x60, 0xc0, 0x0, 0x0, 0x18, 0x18, 0x0, 0x0,
-    0x7, 0x3, 0x0, 0x0, 0x1, 0xc0, 0x60, 0x0,
-    0x0, 0x70, 0xc, 0x0, 0x0, 0x3c, 0x1, 0x80,
-    0x0, 0x1e, 0x0, 0x30, 0x0, 0xf, 0x80, 0x6,
-    0x0, 0xf, 0xc0, 0x0, 0xc0, 0x3f, 0xe0, 0x0,
-    0x1f, 0xff, 0xe0, 0x0, 0x1, 0xff, 0x80, 0x0,
-    0x0, 0x0,
-
-    /* U+0057 "W" */
-    0x0, 0x3, 0xfc, 0x0, 0x0, 0x1, 0xff, 0xf8,
-    0x0, 0x0, 0x7c, 0x3, 0xe0, 0x0, 0x1e, 0x0,
-    0x7, 0x80, 0x3, 0x80, 0x0, 0x1c, 0x0, 0x70,
-    0x0, 0x0, 0xe0, 0xe, 0x0, 0x0, 0x7, 0x1,
-    0xc0, 0x0, 0x0, 0x38, 0x18, 0x3, 0x0, 0x1,
-    0x83, 0x0, 0x38, 0x0, 0xc, 0x30, 0x1, 0xc0,
-    0x0, 0xc6, 0x0, 0xe, 0x0, 0x6, 0x60, 0x0,
-    0x70, 0x0, 0x66, 0x0, 0x3, 0x80, 0x6, 0xc0,
-    0x0, 0x1c, 0x0, 0x3c, 0x0, 0x0, 0xe0, 0x3,
-    0xc0, 0x0, 0x7, 0x0, 0x3c, 0x0, 0x0, 0x38,
-    0x3, 0xc0, 0x0, 0x1, 0xc0, 0x3c, 0x0, 0x0,
-    0x38, 0x3, 0xc0, 0x0, 0x7, 0x0, 0x3c, 0x0,
-    0x0, 0xe0, 0x3, 0x60, 0x0, 0x1c, 0x0, 0x66,
-    0x0, 0x3, 0x80, 0x6, 0x60, 0x0, 0x70, 0x0,
-    0x63, 0x0, 0xe, 0x0, 0xc, 0x30, 0x1, 0xc0,
-    0x0, 0xc1, 0x80, 0x38, 0x0, 0x18, 0x1c, 0x3,
-    0x0, 0x3, 0x80, 0xe0, 0x0, 0x0, 0x70, 0x7,
-    0x0, 0x0, 0xe, 0x0, 0x38, 0x0, 0x1, 0xc0,
-    0x1, 0xe0, 0x0, 0x78, 0x0, 0x7, 0xc0, 0x3e,
-    0x0, 0x0, 0x1f, 0xff, 0x80, 0x0, 0x0, 0x3f,
-    0xc0, 0x0,
-
-    /* U+0058 "X" */
-    0x0, 0x0, 0x70, 0x0, 0x0, 0x0, 0x7, 0x0,
-    0x0, 0x0, 0x0, 0x70, 0x0, 0x0, 0x0, 0x7,
-    0x0, 0x0, 0x0, 0x30, 0x70, 0xc0, 0x0, 0xf,
-    0x7, 0xf, 0x0, 0x1, 0xe0, 0x70, 0x78, 0x0,
-    0x38, 0x7, 0x1, 0xc0, 0x7, 0x0, 0x70, 0xe,
-    0x0, 0xe0, 0x7, 0x0, 0x70, 0x1c, 0x0, 0x70,
-    0x3, 0x81, 0x80, 0x7, 0x0, 0x18, 0x30, 0x0,
-    0x70, 0x0, 0xc3, 0x0, 0x0, 0x0, 0xc, 0x60,
-    0x0, 0x0, 0x0, 0x66, 0x0, 0x0, 0x0, 0x6,
-    0xe0, 0x0, 0x0, 0x0, 0x6c, 0x0, 0x0, 0x0,
-    0x3, 0xc0, 0x0, 0x0, 0x0, 0x3c, 0x0, 0x0,
-    0x0, 0x3, 0xc0, 0x0, 0x0, 0x0, 0x3c, 0x0,
-    0x0, 0x0, 0x3, 0xc0, 0x0, 0x0, 0x0, 0x3c,
-    0x0, 0x0, 0x0, 0x3, 0xc0, 0x0, 0x0, 0x0,
-    0x36, 0x0, 0x0, 0x0, 0x6, 0x60, 0x0, 0x0,
-    0x0, 0x66, 0x0, 0x0, 0x0, 0x6, 0x30, 0x0,
-    0x0, 0x0, 0xc3, 0x0, 0x0, 0x0, 0xc, 0x18,
-    0x0, 0x0, 0x1, 0x81, 0xc0, 0x0, 0x0, 0x38,
-    0xe, 0x0, 0x0, 0x7, 0x0, 0x70, 0x0, 0x0,
-    0xe0, 0x3, 0x80, 0x0, 0x1c, 0x0, 0x1e, 0x0,
-    0x7, 0x80, 0x0, 0x7c, 0x3, 0xe0, 0x0, 0x1,
-    0xff, 0xf8, 0x0, 0x0, 0x3, 0xfc, 0x0, 0x0,
-
-    /* U+0059 "Y" */
-    0x0, 0x3, 0xfc, 0x0, 0x0, 0x1, 0xff, 0xf8,
-    0x0, 0x0, 0x7c, 0x3, 0xe0, 0x0, 0x1e, 0x0,
-    0x7, 0x80, 0x3, 0x80, 0x0, 0x1c, 0x0, 0x70,
-    0x0, 0x0, 0xe0, 0xe, 0x0, 0x0, 0x7, 0x1,
-    0xc0, 0x0, 0x0, 0x38, 0x18, 0x0, 0x0, 0x1,
-    0x83, 0x0, 0x0, 0x0, 0xc, 0x30, 0x0, 0x0,
-    0x0, 0xc6, 0x0, 0x0, 0x0, 0x6, 0x60, 0x0,
-    0x0, 0x0, 0x66, 0x18, 0x0, 0x2, 0x6, 0xc1,
-    0xc0, 0x0, 0x70, 0x3c, 0xe, 0x0, 0xe, 0x3,
-    0xc0, 0x70, 0x1, 0xc0, 0x3c, 0x3, 0x80, 0x38,
-    0x3, 0xc0, 0x1c, 0x7, 0x0, 0x3c, 0x0, 0xe0,
-    0xf0, 0x3, 0xc0, 0x7, 0x1e, 0x0, 0x3c, 0x0,
-    0x3b, 0xc0, 0x3, 0x60, 0x1, 0xf8, 0x0, 0x66,
-    0x0, 0xf, 0x0, 0x6, 0x60, 0x0, 0x60, 0x0,
-    0x63, 0x0, 0x0, 0x0, 0xc, 0x30, 0x0, 0x0,
-    0x0, 0xc1, 0x80, 0x0, 0x0, 0x18, 0x1c, 0x0,
-    0x0, 0x3, 0x80, 0xe0, 0x0, 0x0, 0x70, 0x7,
-    0x0, 0x0, 0xe, 0x0, 0x38, 0x0, 0x1, 0xc0,
-    0x1, 0xe0, 0x0, 0x78, 0x0, 0x7, 0xc0, 0x3e,
-    0x0, 0x0, 0x1f, 0xff, 0x80, 0x0, 0x0, 0x3f,
-    0xc0, 0x0,
-
-    /* U+005A "Z" */
-    0x0, 0x3, 0xfc, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0x80, 0x0, 0x0, 0x7c, 0x3, 0xe0, 0x0, 0x1,
-    0xe0, 0x0, 0xf8, 0x0, 0x3, 0x80, 0x0, 0x3c,
-    0x0, 0x7, 0x0, 0x0, 0xe, 0x0, 0xe, 0x0,
-    0x0, 0x7, 0x0, 0x1c, 0x0, 0x0, 0x3, 0x0,
-    0x18, 0x0, 0x0, 0x3, 0x80, 0x30, 0x0, 0x0,
-    0x1, 0xc0, 0x30, 0x0, 0x0, 0x0, 0xc0, 0x60,
-    0x0, 0x0, 0x0, 0xe0, 0x60, 0x0, 0x0, 0x0,
-    0x60, 0x60, 0x0, 0x0, 0x0, 0x60, 0xc0, 0x0,
-    0x0, 0x0, 0x60, 0xc0, 0x0, 0x0, 0x0, 0x60,
-    0xc0, 0x0, 0x0, 0x0, 0x60, 0xc0, 0x0, 0x0,
-    0x3, 0xfe, 0xc0, 0x0, 0x0, 0x1, 0xfc, 0xc0,
-    0x0, 0x0, 0x0, 0xf8, 0xc0, 0x0, 0x0, 0x0,
-    0x70, 0xc0, 0x0, 0x0, 0x0, 0x20, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x30, 0x0, 0x0, 0x0, 0x0, 0x18,
-    0x0, 0x0, 0x0, 0x0, 0x1c, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0x0, 0x0, 0x0, 0x0, 0x7, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0x80, 0x0, 0x0, 0x0,
-    0x1, 0xe0, 0x0, 0x80, 0x0, 0x0, 0x7c, 0x3,
-    0x80, 0x0, 0x0, 0x1f, 0xff, 0x80, 0x0, 0x0,
-    0x3, 0xfc, 0x0, 0x0,
-
-    /* U+005B "[" */
-    0x7f, 0x0, 0x0, 0x0, 0x0, 0x7f, 0x0, 0x0,
-    0x0, 0x3, 0x3, 0x80, 0x0, 0x0, 0x7, 0x1,
-    0x80, 0x0, 0x0, 0x6, 0x1, 0x80, 0x0, 0x0,
-    0x6, 0x0, 0xff, 0xff, 0xff, 0xfe, 0x0, 0xff,
-    0xff, 0xff, 0xfc, 0x0, 0x60, 0x0, 0x0, 0xc,
-    0x0, 0x60, 0x0, 0x0, 0x1c, 0x0, 0x30, 0x0,
-    0x0, 0x18, 0x0, 0x30, 0x0, 0x0, 0x18, 0x0,
-    0x38, 0x0, 0x0, 0x18, 0x0, 0x18, 0x0, 0x0,
-    0x38, 0x0, 0x1c, 0x0, 0x0, 0x30, 0x0, 0xc,
-    0x0, 0x0, 0x30, 0x0, 0xc, 0x0, 0x0, 0x30,
-    0x0, 0x6, 0x0, 0x0, 0x60, 0x0, 0x6, 0x0,
-    0x0, 0x60, 0x0, 0x3, 0x0, 0x0, 0x60, 0x0,
-    0x3, 0x0, 0x0, 0xc0, 0x0, 0x3, 0xff, 0xff,
-    0xc0, 0x0, 0x1, 0xff, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x38, 0x7, 0x0,
-    0x0, 0x0, 0x7c, 0xf, 0x80, 0x0, 0x0, 0xee,
-    0x1d, 0xc0, 0x0, 0x0, 0xc6, 0x18, 0xc0, 0x0,
-    0x0, 0xc6, 0x18, 0xc0, 0x0, 0x0, 0x7c, 0xf,
-    0x80, 0x0, 0x0, 0x38, 0x7, 0x0,
-
-    /* U+005C "\\" */
-    0x7f, 0xff, 0xff, 0xbf, 0xff, 0xff, 0xfc, 0x0,
-    0x0, 0xf, 0x0, 0x0, 0x3, 0xc0, 0x0, 0x0,
-    0xf0, 0x0, 0x0, 0x3c, 0x0, 0x0, 0xf, 0x0,
-    0x0, 0x3, 0xc0, 0x0, 0x0, 0xf0, 0x0, 0x0,
-    0x3c, 0x0, 0x0, 0xf, 0x0, 0x0, 0x3, 0xc0,
-    0x0, 0x0, 0xf0, 0x0, 0x0, 0x3c, 0x0, 0x0,
-    0xf, 0x0, 0x0, 0x3, 0xc0, 0x0, 0x0, 0xf0,
-    0x0, 0x0, 0x3c, 0x0, 0x0, 0xf, 0x0, 0x0,
-    0x3, 0xc0, 0x0, 0x0, 0xf0, 0x0, 0x0, 0x3c,
-    0x0, 0x0, 0xf, 0x0, 0x0, 0x3, 0xc0, 0x0,
-    0x0, 0xf0, 0x0, 0x0, 0x3c, 0x0, 0x0, 0xf,
-    0x0, 0x0, 0x3, 0xc0, 0x0, 0x0, 0xf0, 0x0,
-    0x0, 0x3c, 0x0, 0x0, 0xf, 0x0, 0x0, 0x3,
-    0xc0, 0x0, 0x0, 0xf0, 0x0, 0x0, 0x3f, 0xff,
-    0xff, 0xff, 0xff, 0xcf, 0xff, 0xff, 0xe1, 0xff,
-    0xff, 0xf8, 0x7f, 0xff, 0xff, 0x3f, 0xfd, 0xff,
-    0xff, 0xfe,
-
-    /* U+005D "]" */
-    0x0, 0x7, 0xe0, 0x0, 0x0, 0x1f, 0xf8, 0x0,
-    0x0, 0x38, 0x1c, 0x0, 0x0, 0x70, 0xe, 0x0,
-    0x0, 0x60, 0x6, 0x0, 0x0, 0xc0, 0x7, 0x0,
-    0x0, 0xc0, 0x3, 0x0, 0x0, 0xc0, 0x3, 0x0,
-    0x0, 0xc0, 0x3, 0x0, 0x1f, 0xff, 0xff, 0xf8,
-    0x1f, 0xff, 0xff, 0xf8, 0x30, 0xc0, 0x3, 0xc,
-    0x70, 0xc0, 0x3, 0xe, 0x7f, 0xff, 0xff, 0xfe,
-    0xff, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x3,
-    0xc0, 0x0, 0x0, 0x3, 0xc0, 0x0, 0x0, 0x3,
-    0xc0, 0x0, 0x0, 0x3, 0xc0, 0x0, 0x0, 0x3,
-    0xc0, 0x0, 0x0, 0x3, 0xc0, 0x0, 0x0, 0x3,
-    0xc0, 0x0, 0x0, 0x3, 0xc0, 0x0, 0x0, 0x3,
-    0xc0, 0x0, 0x0, 0x3, 0xc0, 0x0, 0x0, 0x3,
-    0xc0, 0x0, 0x0, 0x3, 0xc0, 0x0, 0x0, 0x3,
-    0xc0, 0x0, 0x0, 0x3, 0xc0, 0x0, 0x0, 0x3,
-    0xc0, 0x0, 0x0, 0x3, 0xc0, 0x0, 0x0, 0x3,
-    0xc0, 0x0, 0x0, 0x3, 0xc0, 0x0, 0x0, 0x3,
-    0xc0, 0x0, 0x0, 0x3, 0xc0, 0x0, 0x0, 0x3,
-    0xc0, 0x0, 0x0, 0x3, 0xc0, 0x0, 0x0, 0x3,
-    0xff, 0xff, 0xff, 0xff, 0x7f, 0xff, 0xff, 0xfe,
-
-    /* U+005E "^" */
-    0x0, 0x7f, 0xf0, 0x0, 0x1f, 0xff, 0xf0, 0x3,
-    0xe0, 0x3, 0xe0, 0x38, 0x0, 0x3, 0x83, 0x80,
-    0x0, 0xe, 0x31, 0xff, 0xff, 0x1b, 0x9f, 0xff,
-    0xfc, 0xf9, 0xc0, 0x0, 0x73, 0xcc, 0x0, 0x1,
-    0x9e, 0x60, 0x0, 0xc, 0xf3, 0x0, 0x0, 0x67,
-    0x98, 0x0, 0x3, 0x3c, 0xc0, 0x0, 0x19, 0xe6,
-    0x0, 0x0, 0xcf, 0x30, 0x0, 0x6, 0x79, 0x80,
-    0x0, 0x33, 0xcc, 0x0, 0x1, 0x9e, 0x60, 0x0,
-    0xc, 0xf3, 0x0, 0x0, 0x67, 0x98, 0x0, 0x3,
-    0x3c, 0xc0, 0x0, 0x19, 0xe6, 0x0, 0x0, 0xcf,
-    0x30, 0x0, 0x6, 0x79, 0x80, 0x0, 0x33, 0xcc,
-    0x0, 0x1, 0x9e, 0x60, 0x0, 0xc, 0xf3, 0x0,
-    0x0, 0x67, 0x9c, 0x0, 0x7, 0x3c, 0x7f, 0xff,
-    0xf1, 0xe1, 0xff, 0xff, 0xf, 0x0, 0x0, 0x0,
-    0x78, 0x0, 0x0, 0x3, 0xe0, 0x3, 0x0, 0x3b,
-    0x80, 0x3c, 0x3, 0x8e, 0x0, 0xc0, 0x38, 0x3c,
-    0x0, 0x7, 0x80, 0xfc, 0x1, 0xf8, 0x1, 0xff,
-    0xff, 0x0, 0x0, 0xff, 0x80, 0x0,
-
-    /* U+005F "_" */
-    0x0, 0x3f, 0x0, 0x0, 0x3f, 0xf0, 0x0, 0x1c,
-    0xe, 0x0, 0xe, 0x1, 0xc0, 0x3, 0x0, 0x30,
-    0x1, 0x80, 0x6, 0x0, 0x60, 0x1, 0x80, 0x18,
-    0x0, 0x60, 0x6, 0x0, 0x18, 0x1, 0x80, 0x6,
-    0x0, 0x60, 0x1, 0x80, 0x18, 0x0, 0x60, 0x6,
-    0x0, 0x18, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x0, 0x0, 0x3, 0xc0, 0x0, 0x0, 0xf0,
-    0x0, 0x0, 0x3c, 0x1, 0xc0, 0xf, 0x0, 0xf8,
-    0x3, 0xc0, 0x3e, 0x0, 0xf0, 0xf, 0x80, 0x3c,
-    0x0, 0xc0, 0xf, 0x0, 0x30, 0x3, 0xc0, 0xc,
-    0x0, 0xf0, 0x3, 0x0, 0x3c, 0x0, 0xc0, 0xf,
-    0x0, 0x30, 0x3, 0xc0, 0x0, 0x0, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfc,
-
-    /* U+0060 "`" */
-    0x0, 0x3, 0xfc, 0x0, 0x0, 0x1, 0xff, 0xf8,
-    0x0, 0x0, 0x7c, 0x3, 0xe0, 0x0, 0x1e, 0x0,
-    0x7, 0x80, 0x3, 0x80, 0x0, 0x1c, 0x0, 0x70,
-    0x0, 0x0, 0xe0, 0xe, 0x0, 0x0, 0x7, 0x1,
-    0xc0, 0x0, 0x0, 0x38, 0x18, 0x80, 0x0, 0x1,
-    0x83, 0xf, 0x0, 0x0, 0xc, 0x30, 0xfe, 0x0,
-    0x0, 0xc6, 0x7, 0xfc, 0x0, 0x6, 0x60, 0x7f,
-    0xf8, 0x0, 0x66, 0x7, 0xff, 0xe0, 0x6, 0xc0,
-    0x3f, 0xff, 0x0, 0x3c, 0x3, 0xff, 0xb0, 0x3,
-    0xc0, 0x1f, 0x93, 0x0, 0x3c, 0x1, 0xf0, 0x38,
-    0x3, 0xc0, 0x1f, 0x1, 0x80, 0x3c, 0x0, 0xf8,
-    0x18, 0x3, 0xc0, 0xf, 0x1, 0xc0, 0x3c, 0x0,
-    0x60, 0xc, 0x3, 0x60, 0x7, 0x80, 0xc0, 0x66,
-    0x0, 0x3f, 0xe, 0x6, 0x60, 0x0, 0xfc, 0x60,
-    0x63, 0x0, 0x1, 0xfe, 0xc, 0x30, 0x0, 0x7,
-    0xf0, 0xc1, 0x80, 0x0, 0xf, 0x18, 0x1c, 0x0,
-    0x0, 0x3, 0x80, 0xe0, 0x0, 0x0, 0x70, 0x7,
-    0x0, 0x0, 0xe, 0x0, 0x38, 0x0, 0x1, 0xc0,
-    0x1, 0xe0, 0x0, 0x78, 0x0, 0x7, 0xc0, 0x3e,
-    0x0, 0x0, 0x1f, 0xff, 0x80, 0x0, 0x0, 0x3f,
-    0xc0, 0x0,
-
-    /* U+0061 "a" */
-    0x7f, 0xf0, 0x0, 0x3f, 0xfe, 0x0, 0xc, 0x3,
-    0xc0, 0x3, 0x0, 0xd8, 0x0, 0xc0, 0x33, 0x0,
-    0x30, 0xc, 0x60, 0xc, 0x3, 0xc, 0x3, 0x0,
-    0xc1, 0x80, 0xc0, 0x30, 0x30, 0x30, 0xc, 0x6,
-    0xc, 0x3, 0x0, 0xe3, 0x0, 0xc0, 0x1c, 0xc0,
-    0x30, 0x3, 0xb0, 0xc, 0x0, 0x7c, 0x3, 0xff,
-    0xff, 0x0, 0x7f, 0xff, 0xc0, 0x0, 0x0, 0xf0,
-    0x0, 0x0, 0x3c, 0x0, 0x0, 0xf, 0x0, 0x0,
-    0x3, 0xcf, 0xff, 0xfe, 0xf3, 0xff, 0xff, 0xbc,
-    0x0, 0x0, 0xf, 0x0, 0x0, 0x3, 0xc0, 0x0,
-    0x0, 0xf3, 0xff, 0xff, 0xbc, 0xff, 0xff, 0xef,
-    0x0, 0x0, 0x3, 0xc0, 0x0, 0x0, 0xf0, 0x0,
-    0x0, 0x3c, 0xff, 0xff, 0xef, 0x3f, 0xff, 0xfb,
-    0xc0, 0x0, 0x0, 0xf0, 0x0, 0x0, 0x3c, 0x0,
-    0x0, 0xf, 0x0, 0x0, 0x3, 0xc0, 0x0, 0x0,
-    0xf0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xfd, 0xff,
-    0xff, 0xfe,
-
-    /* U+0062 "b" */
-    0x7f, 0xf0, 0x0, 0x3f, 0xfe, 0x0, 0xc, 0x3,
-    0xc0, 0x3, 0x0, 0xd8, 0x0, 0xc0, 0x33, 0x0,
-    0x30, 0xc, 0x60, 0xc, 0x3, 0xc, 0x3, 0x0,
-    0xc1, 0x80, 0xc0, 0x30, 0x30, 0x30, 0xc, 0x6,
-    0xc, 0x3, 0x0, 0xe3, 0x0, 0xc0, 0x1c, 0xc0,
-    0x30, 0x3, 0xb0, 0xc, 0x0, 0x7c, 0x3, 0xff,
-    0xff, 0x0, 0x7f, 0xff, 0xc0, 0x0, 0x0, 0xf0,
-    0x0, 0x0, 0x3c, 0x0, 0x0, 0xf, 0x0, 0x0,
-    0x3, 0xc0, 0x0, 0x0, 0xf0, 0x0, 0x0, 0x3c,
-    0x0, 0x0, 0xf, 0x1, 0xc6, 0x3, 0xc0, 0xe1,
-    0xe0, 0xf0, 0xf0, 0x3e, 0x3c, 0xf0, 0x3, 0xcf,
-    0x38, 0x0, 0x3b, 0xc7, 0x0, 0x3c, 0xf0, 0xf0,
-    0x3e, 0x3c, 0xe, 0x1e, 0xf, 0x1, 0x86, 0x3,
-    0xc0, 0x0, 0x0, 0xf0, 0x0, 0x0, 0x3c, 0x0,
-    0x0, 0xf, 0x0, 0x0, 0x3, 0xc0, 0x0, 0x0,
-    0xf0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xfd, 0xff,
-    0xff, 0xfe,
-
-    /* U+0063 "c" */
-    0x0, 0x7f, 0xf8, 0x0, 0x3, 0xff, 0xf0, 0x0,
-    0xc, 0x1, 0xe0, 0x0, 0x30, 0x7, 0xc0, 0x0,
-    0xc0, 0x1b, 0x80, 0x3, 0x0, 0x66, 0x0, 0x0,
-    0x1, 0x8c, 0x0, 0x0, 0x6, 0x38, 0x7f, 0xf0,
-    0x18, 0x73, 0xff, 0xe0, 0x60, 0xec, 0x3, 0xc1,
-    0x81, 0xf0, 0xd, 0x87, 0xff, 0xc0, 0x37, 0xf,
-    0xff, 0x0, 0xce, 0x0, 0x3c, 0x3, 0x1c, 0x0,
-    0xf0, 0xc, 0x38, 0x3, 0xc0, 0x30, 0x70, 0xf,
-    0x0, 0xc0, 0xe0, 0x3c, 0x3, 0x1, 0xc0, 0xf0,
-    0xf, 0xff, 0x3, 0xc0, 0x1f, 0xfc, 0xf, 0x0,
-    0x0, 0x30, 0x3c, 0x0, 0x0, 0xc0, 0xf0, 0x0,
-    0x3, 0x3, 0xdf, 0xff, 0xcc, 0xf, 0x7f, 0xff,
-    0x30, 0x3c, 0x0, 0x0, 0xc0, 0xf0, 0x0, 0x3,
-    0x3, 0xdf, 0xff, 0xcc, 0xf, 0x7f, 0xff, 0x30,
-    0x3c, 0x0, 0x0, 0xdf, 0xf0, 0x0, 0x3, 0x7e,
-    0xc0, 0x0, 0xc, 0x3, 0x7f, 0xff, 0x30, 0xd,
-    0xff, 0xfc, 0xc0, 0x30, 0x0, 0x3, 0x0, 0xc0,
-    0x0, 0xc, 0x3, 0x0, 0x0, 0x30, 0xf, 0xff,
-    0xff, 0xc0, 0x1f, 0xff, 0xfe, 0x0,
-
-    /* U+0064 "d" */
-    0x7f, 0xf0, 0x0, 0x3, 0xff, 0xe0, 0x0, 0xc,
-    0x3, 0xc0, 0x0, 0x30, 0xd, 0x80, 0x0, 0xc0,
-    0x33, 0x0, 0x3, 0x0, 0xc6, 0x0, 0xc, 0x3,
-    0xc, 0x0, 0x30, 0xc, 0x18, 0x0, 0xc0, 0x30,
-    0x30, 0x3, 0x0, 0xc0, 0x60, 0xc, 0x3, 0x0,
-    0xe0, 0x30, 0xc, 0x1, 0xc0, 0xc0, 0x30, 0x3,
-    0x83, 0x0, 0xc0, 0x7, 0xc, 0x3, 0xff, 0xfc,
-    0x30, 0x7, 0xff, 0xf0, 0xc0, 0x0, 0x0, 0xc3,
-    0x0, 0x0, 0x3, 0xc, 0x0, 0x0, 0xc, 0x30,
-    0x0, 0x0, 0x30, 0xc0, 0x0, 0x0, 0xc3, 0x0,
-    0x0, 0x3, 0xc, 0x0, 0x0, 0xc, 0x30, 0x0,
-    0x0, 0x30, 0xc0, 0x0, 0x0, 0xc3, 0x0, 0x0,
-    0x3, 0xc, 0x0, 0x0, 0xc, 0x30, 0x0, 0x0,
-    0x30, 0xc0, 0x0, 0x0, 0xc3, 0x0, 0x0, 0x0,
-    0xc, 0x0, 0x0, 0x0, 0x30, 0x0, 0x3, 0xff,
-    0xc0, 0x0, 0xf, 0xff, 0x0, 0x0, 0x0, 0xc,
-    0x0, 0x0, 0x0, 0x30, 0x0, 0x0, 0x30, 0xc0,
-    0x0, 0x0, 0xc3, 0x0, 0x0, 0x3, 0xf, 0xff,
-    0xff, 0xfc, 0x1f, 0xff, 0xff, 0xe0,
-
-    /* U+0065 "e" */
-    0x7f, 0xff, 0x0, 0x0, 0x0, 0xff, 0xff, 0x80,
-    0x0, 0x0, 0xc0, 0x1, 0x80, 0x0, 0x0, 0xc0,
-    0x1, 0x80, 0x0, 0x0, 0xc0, 0x1, 0x80, 0x0,
-    0x0, 0xff, 0xff, 0xff, 0xff, 0xe0, 0xff, 0xff,
-    0xff, 0xff, 0xf0, 0xc0, 0x0, 0x0, 0x0, 0x30,
-    0xc0, 0x0, 0x0, 0x0, 0x30, 0xc0, 0x0, 0x0,
-    0x0, 0x30, 0xc0, 0x0, 0x0, 0x0, 0x30, 0xc0,
-    0x0, 0x0, 0x0, 0x30, 0xc0, 0x0, 0x0, 0x0,
-    0x30, 0xc0, 0x0, 0x0, 0x1e, 0x0, 0xc0, 0x0,
-    0x0, 0x7f, 0x80, 0xc0, 0x0, 0x0, 0xe1, 0xc0,
-    0xc0, 0x0, 0x0, 0xc0, 0xc0, 0xc0, 0x0, 0x1,
-    0x80, 0x60, 0xc0, 0x0, 0x1, 0x80, 0x60, 0xc0,
-    0x0, 0x1, 0x80, 0x60, 0xc0, 0x0, 0x1, 0x80,
-    0x60, 0xc0, 0x0, 0x0, 0xc0, 0xe0, 0xc0, 0x0,
-    0x0, 0xe1, 0xe0, 0xc0, 0x0, 0x0, 0x7f, 0xf0,
-    0xc0, 0x0, 0x0, 0x3f, 0xf8, 0xc0, 0x0, 0x0,
-    0x0, 0x7c, 0xc0, 0x0, 0x0, 0x0, 0x3e, 0xc0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xff, 0xff,
-    0xf, 0x7f, 0xff, 0xff, 0xff, 0x6,
-
-    /* U+0066 "f" */
-    0x0, 0x60, 0x6, 0x0, 0x0, 0x60, 0x6, 0x0,
-    0x0, 0x60, 0x6, 0x0, 0x7f, 0xff, 0xff, 0xfe,
-    0xff, 0xff, 0xff, 0xff, 0xc0, 0x60, 0x6, 0x3,
-    0xc0, 0x0, 0x0, 0x3, 0xc0, 0x0, 0x0, 0x3,
-    0xc0, 0x0, 0x0, 0x3, 0xc0, 0x0, 0x0, 0x3,
-    0xc0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x3,
-    0xc0, 0x0, 0x0, 0x3, 0xc0, 0x0, 0x0, 0x3,
-    0xc0, 0x0, 0x0, 0x3, 0xc1, 0xbf, 0xff, 0x83,
-    0xc1, 0xbf, 0xff, 0x83, 0xc0, 0x0, 0x0, 0x3,
-    0xc0, 0x0, 0x0, 0x3, 0xc0, 0x0, 0x0, 0x3,
-    0xc1, 0xbf, 0xff, 0x83, 0xc1, 0xbf, 0xff, 0x83,
-    0xc0, 0x0, 0x0, 0x3, 0xc0, 0x0, 0x0, 0x3,
-    0xc0, 0x0, 0x0, 0x3, 0xc0, 0x0, 0x0, 0x3,
-    0xc0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xff, 0xff,
-    0x7f, 0xff, 0xff, 0xfe,
-
-    /* U+0067 "g" */
-    0x0, 0xff, 0xff, 0xff, 0xfe, 0x1, 0xff, 0xff,
-    0xff, 0xff, 0x1, 0x80, 0x0, 0x0, 0x3, 0x1,
-    0x80, 0x0, 0x0, 0x3, 0x1, 0x80, 0x0, 0x0,
-    0x3, 0x1, 0x80, 0x0, 0x0, 0x3, 0x1, 0x80,
-    0x0, 0x0, 0x3, 0x1, 0x80, 0x0, 0x0, 0x3,
-    0x1, 0xff, 0xff, 0xff, 0xff, 0x1, 0xff, 0xff,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x3, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0x7f, 0xff, 0xff, 0xff,
-    0x3, 0xff, 0xff, 0xff, 0xff, 0x83, 0xc0, 0x0,
-    0x0, 0x1, 0x83, 0xc0, 0x0, 0x0, 0x1, 0x83,
-    0xcd, 0xe0, 0x0, 0x1, 0x83, 0xcd, 0xe0, 0x0,
-    0x1, 0x83, 0xc0, 0x0, 0x0, 0x1, 0x83, 0xc0,
-    0x0, 0x0, 0x1, 0x83, 0xff, 0xff, 0xff, 0xff,
-    0x83, 0xff, 0xff, 0xff, 0xff, 0x83, 0xc0, 0x0,
-    0x0, 0x1, 0x83, 0xc0, 0x0, 0x0, 0x1, 0x83,
-    0xc0, 0x0, 0x0, 0x1, 0x83, 0xc0, 0x0, 0x0,
-    0x1, 0x83, 0xc0, 0x0, 0x0, 0x1, 0x9f, 0xc0,
-    0x0, 0x0, 0x1, 0x9e, 0xc0, 0x0, 0x0, 0x1,
-    0x80, 0xc0, 0x0, 0x0, 0x1, 0x80, 0xc0, 0x0,
-    0x0, 0x1, 0x80, 0xc0, 0x0, 0x0, 0x1, 0x80,
-    0xc0, 0x0, 0x0, 0x1, 0x80, 0xc0, 0x0, 0x0,
-    0x1, 0x80, 0xc0, 0x0, 0x0, 0x1, 0x80, 0xc0,
-    0x0, 0x0, 0x1, 0x80, 0xc0, 0x0, 0x0, 0x1,
-    0x80, 0xc0, 0x0, 0x0, 0x1, 0x80, 0xff, 0xff,
-    0xff, 0xff, 0x80, 0x7f, 0xff, 0xff, 0xff, 0x0,
-
-    /* U+0068 "h" */
-    0x0, 0x1f, 0xff, 0x80, 0x0, 0x1, 0xff, 0xf8,
-    0x0, 0x0, 0x18, 0x1, 0x80, 0x0, 0x1, 0x80,
-    0x18, 0x0, 0x0, 0x18, 0x1, 0x80, 0x7, 0xff,
-    0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0x3, 0xc0, 0x0, 0x0, 0x0,
-    0x3c, 0x0, 0x0, 0x0, 0x3, 0xc0, 0x0, 0x0,
-    0x0, 0x3c, 0x0, 0x0, 0x0, 0x3, 0xc0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfc, 0x0, 0x1f, 0x80, 0x3,
-    0xc0, 0x0, 0xf0, 0x0, 0x3c, 0x0, 0x0, 0x0,
-    0x3, 0xc0, 0x0, 0x0, 0x0, 0x3c, 0x0, 0x0,
-    0x0, 0x3, 0xc0, 0x0, 0x0, 0x0, 0x3c, 0x0,
-    0x0, 0x0, 0x3, 0xc0, 0x0, 0x0, 0x0, 0x3c,
-    0x0, 0x0, 0x0, 0x3, 0xc0, 0x0, 0x0, 0x0,
-    0x3c, 0x0, 0x0, 0x0, 0x3, 0xc0, 0x0, 0x0,
-    0x0, 0x3c, 0x0, 0x0, 0x0, 0x3, 0xc0, 0x0,
-    0x0, 0x0, 0x3c, 0x0, 0x0, 0x0, 0x3, 0xc0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xff, 0xff,
-    0x7f, 0xff, 0xff, 0xff, 0xe0,
-
-    /* U+0069 "i" */
-    0x0, 0x3, 0xfc, 0x0, 0x0, 0x1, 0xff, 0xf8,
-    0x0, 0x0, 0x7c, 0x3, 0xe0, 0x0, 0x1e, 0x0,
-    0x7, 0x80, 0x3, 0x80, 0x0, 0x1c, 0x0, 0x70,
-    0x0, 0x0, 0xe0, 0xe, 0x0, 0x0, 0x7, 0x1,
-    0xc0, 0x6, 0x0, 0x38, 0x18, 0x0, 0x60, 0x1,
-    0x83, 0x0, 0x6, 0x0, 0xc, 0x30, 0x0, 0x60,
-    0x0, 0xc6, 0x0, 0x6, 0x0, 0x6, 0x60, 0x0,
-    0x60, 0x0, 0x66, 0x0, 0x6, 0x0, 0x6, 0xc0,
-    0x0, 0x60, 0x0, 0x3c, 0x0, 0x6, 0x0, 0x3,
-    0xc0, 0x0, 0x60, 0x0, 0x3c, 0x0, 0x6, 0x0,
-    0x3, 0xc0, 0x0, 0x70, 0x0, 0x3c, 0x0, 0x3,
-    0x80, 0x3, 0xc0, 0x0, 0x1c, 0x0, 0x3c, 0x0,
-    0x0, 0xe0, 0x3, 0x60, 0x0, 0x7, 0x0, 0x66,
-    0x0, 0x0, 0x38, 0x6, 0x60, 0x0, 0x1, 0x80,
-    0x63, 0x0, 0x0, 0x0, 0xc, 0x30, 0x0, 0x0,
-    0x0, 0xc1, 0x80, 0x0, 0x0, 0x18, 0x1c, 0x0,
-    0x0, 0x3, 0x80, 0xe0, 0x0, 0x0, 0x70, 0x7,
-    0x0, 0x0, 0xe, 0x0, 0x38, 0x0, 0x1, 0xc0,
-    0x1, 0xe0, 0x0, 0x78, 0x0, 0x7, 0xc0, 0x3e,
-    0x0, 0x0, 0x1f, 0xff, 0x80, 0x0, 0x0, 0x3f,
-    0xc0, 0x0,
-
-    /* U+006A "j" */
-    0x0, 0x3, 0xfc, 0x0, 0x0, 0x0, 0xff, 0xc0,
-    0x0, 0x3, 0x18, 0x18, 0xc0, 0x0, 0xfb, 0x3,
-    0x7c, 0x0, 0x73, 0xe0, 0x7d, 0xc0, 0x1c, 0x30,
-    0x3, 0x1c, 0x7, 0x0, 0x0, 0x1, 0xc0, 0xc0,
-    0x0, 0x0, 0x18, 0x18, 0x0, 0x0, 0x3, 0x3,
-    0x80, 0x0, 0x0, 0x60, 0x38, 0x0, 0x0, 0x18,
-    0x6, 0x0, 0x78, 0x3, 0x7, 0xc0, 0x3f, 0xc0,
-    0x7d, 0xf8, 0xe, 0x1c, 0x7, 0xf0, 0x1, 0x81,
-    0x80, 0x1e, 0x0, 0x60, 0x18, 0x3, 0xc0, 0xc,
-    0x3, 0x0, 0x78, 0x1, 0x80, 0x60, 0xf, 0x0,
-    0x30, 0xc, 0x1, 0xe0, 0x3, 0x3, 0x0, 0x3f,
-    0xc0, 0x70, 0xe0, 0x3e, 0xf8, 0x7, 0xf8, 0xf,
-    0x83, 0x0, 0x3c, 0x1, 0x80, 0x70, 0x0, 0x0,
-    0x30, 0x1c, 0x0, 0x0, 0x3, 0x3, 0x0, 0x0,
-    0x0, 0x60, 0x60, 0x0, 0x0, 0xc, 0xe, 0x0,
-    0x0, 0x3, 0x80, 0xe1, 0x80, 0x18, 0xe0, 0xe,
-    0x7c, 0xf, 0xb8, 0x0, 0xfd, 0x81, 0xbe, 0x0,
-    0xe, 0x30, 0x31, 0x80, 0x0, 0x6, 0x6, 0x0,
-    0x0, 0x0, 0xff, 0xc0, 0x0, 0x0, 0xf, 0xf0,
-    0x0, 0x0,
-
-    /* U+006B "k" */
-    0x0, 0x7e, 0x0, 0x0, 0x7, 0xff, 0x80, 0x0,
-    0x1e, 0x7, 0x80, 0x0, 0x70, 0x3, 0xc0, 0x1,
-    0x80, 0x1, 0x80, 0x6, 0x0, 0x1, 0x80, 0x1c,
-    0x0, 0x3, 0x80, 0x30, 0xc, 0x3, 0x0, 0x60,
-    0x18, 0x6, 0x1, 0x80, 0x30, 0x6, 0x3, 0x0,
-    0x60, 0xc, 0x6, 0xf, 0xfc, 0x18, 0xc, 0x1f,
-    0xf8, 0x30, 0x18, 0x3, 0x0, 0x60, 0x30, 0x6,
-    0x0, 0xc0, 0x30, 0xc, 0x3, 0x0, 0x60, 0x18,
-    0x6, 0x0, 0xe0, 0x0, 0x1c, 0x0, 0xc0, 0x0,
-    0x30, 0x0, 0xc0, 0x0, 0xf0, 0x0, 0xe0, 0x7,
-    0xf0, 0x0, 0xf0, 0x3f, 0xf0, 0x0, 0xff, 0xf7,
-    0xf0, 0x0, 0x7f, 0x87, 0xf0, 0x0, 0x0, 0x3,
-    0xf0, 0x0, 0x0, 0x3, 0xf0, 0x0, 0x0, 0x3,
-    0xf0, 0x0, 0x0, 0x3, 0xf0, 0x0, 0x0, 0x3,
-    0xe0, 0x0, 0x0, 0x3, 0xc0, 0x0, 0x0, 0x3,
-    0x0,
-
-    /* U+006C "l" */
-    0x7f, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x3, 0xc0,
-    0x0, 0x0, 0x0, 0x3, 0xc0, 0x0, 0x0, 0x0,
-    0x3, 0xc0, 0x0, 0x0, 0x0, 0x3, 0xc0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x3, 0xc0, 0x0, 0x0, 0x0, 0x3, 0xc0, 0x0,
-    0x0, 0x0, 0x3, 0xc0, 0x0, 0x0, 0x0, 0x3,
-    0xc3, 0xff, 0xff, 0x87, 0xc3, 0xc3, 0xff, 0xff,
-    0x87, 0xc3, 0xc0, 0x0, 0x0, 0x7, 0xc3, 0xc0,
-    0x0, 0x0, 0x7, 0xc3, 0xc0, 0x0, 0x0, 0x7,
-    0xc3, 0xc3, 0xff, 0xfc, 0x0, 0x3, 0xc3, 0xff,
-    0xfc, 0x0, 0x3, 0xc0, 0x0, 0x0, 0x0, 0x3,
-    0xc0, 0x0, 0x0, 0x0, 0x3, 0xc0, 0x0, 0x0,
-    0x0, 0x3, 0xc0, 0x0, 0x0, 0x0, 0x3, 0xc0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x7f, 0xff, 0xff, 0xff, 0xfe,
-
-    /* U+006D "m" */
-    0x7f, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff,
-    0xc0, 0x0, 0x0, 0x3, 0xc0, 0x0, 0x0, 0x3,
-    0xc0, 0x0, 0x0, 0x3, 0xc0, 0x0, 0x0, 0x3,
-    0xc0, 0x0, 0x0, 0x3, 0xc0, 0x0, 0x0, 0x3,
-    0xc0, 0x0, 0x0, 0x3, 0xc0, 0x0, 0x0, 0x3,
-    0xc0, 0x0, 0x0, 0x3, 0xc0, 0x0, 0x0, 0x3,
-    0xc0, 0x0, 0x0, 0x3, 0xc0, 0xe1, 0xc7, 0x3,
-    0xc0, 0xe1, 0xc7, 0x3, 0xc0, 0xe1, 0xc7, 0x3,
-    0xc0, 0x0, 0x0, 0x3, 0xc0, 0x0, 0x0, 0x3,
-    0xc0, 0x0, 0x0, 0x3, 0xc0, 0x0, 0x0, 0x3,
-    0xc0, 0x0, 0x0, 0x3, 0xc0, 0x0, 0x0, 0x3,
-    0xc0, 0x0, 0x0, 0x3, 0xc0, 0x0, 0x0, 0x3,
-    0xc0, 0x0, 0x0, 0x3, 0xc0, 0x0, 0x0, 0x3,
-    0xff, 0xff, 0xf1, 0xff, 0x7f, 0xff, 0xf9, 0xfe,
-    0x0, 0x0, 0x1f, 0x80, 0x0, 0x0, 0x7, 0x80,
-    0x0, 0x0, 0x3, 0x80, 0x0, 0x0, 0x0, 0x80,
-
-    /* U+006E "n" */
-    0x0, 0x0, 0x0, 0x70, 0x0, 0x0, 0x0, 0xf8,
-    0x0, 0x0, 0x1, 0xdc, 0x0, 0x0, 0x3, 0x8e,
-    0x0, 0x0, 0x7, 0x7, 0x0, 0x0, 0xf, 0x87,
-    0x0, 0x0, 0x1f, 0xce, 0x0, 0x0, 0x1c, 0xfc,
-    0x0, 0x0, 0x38, 0x78, 0x0, 0x0, 0x70, 0x70,
-    0x0, 0x0, 0xe0, 0xe0, 0x0, 0x1, 0xc1, 0xc0,
-    0x0, 0x3, 0x83, 0x80, 0x0, 0x7, 0x7, 0x0,
-    0x0, 0xe, 0xe, 0x0, 0x0, 0x1c, 0x1e, 0x0,
-    0x0, 0x38, 0x3c, 0x0, 0x0, 0x70, 0x78, 0x0,
-    0x0, 0xe0, 0x70, 0x0, 0x1, 0xc0, 0xe0, 0x0,
-    0x3, 0x81, 0xc0, 0x0, 0x7, 0x3, 0x80, 0x0,
-    0xe, 0x7, 0x0, 0x0, 0x1c, 0xe, 0x0, 0x0,
-    0x38, 0x1c, 0x0, 0x0, 0x7c, 0x38, 0x0, 0x0,
-    0x6e, 0x70, 0x0, 0x0, 0x67, 0xe0, 0x0, 0x0,
-    0xe3, 0xc0, 0x0, 0x0, 0xc7, 0x80, 0x0, 0x0,
-    0xff, 0x0, 0x0, 0x0, 0xfe, 0x0, 0x0, 0x0,
-    0xe0, 0x0, 0x0, 0x0,
-
-    /* U+006F "o" */
-    0x1, 0xff, 0xf0, 0x0, 0x3f, 0xfe, 0x0, 0x6,
-    0x0, 0xc0, 0x0, 0xc0, 0x18, 0x7, 0xff, 0xff,
-    0xfd, 0xff, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x1e,
-    0x0, 0x0, 0x3, 0xc0, 0x0, 0x0, 0x7f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x98, 0x0, 0x0,
-    0xc3, 0x0, 0x0, 0x18, 0x61, 0x8c, 0x63, 0xc,
-    0x31, 0x8c, 0x61, 0x86, 0x31, 0x8c, 0x30, 0xc6,
-    0x31, 0x86, 0x18, 0xc6, 0x30, 0xc3, 0x18, 0xc6,
-    0x18, 0x63, 0x18, 0xc3, 0xc, 0x63, 0x18, 0x61,
-    0x8c, 0x63, 0xc, 0x31, 0x8c, 0x61, 0x86, 0x31,
-    0x8c, 0x30, 0xc6, 0x31, 0x86, 0x18, 0xc6, 0x30,
-    0xc3, 0x18, 0xc6, 0x18, 0x63, 0x18, 0xc3, 0xc,
-    0x63, 0x18, 0x61, 0x8c, 0x63, 0xc, 0x31, 0x8c,
-    0x61, 0x80, 0x0, 0xc, 0x30, 0x0, 0x1, 0x87,
-    0xff, 0xff, 0xf0, 0x7f, 0xff, 0xfc, 0x0,
-
-    /* U+0070 "p" */
-    0x0, 0xfc, 0x0, 0x7, 0xf8, 0x0, 0x38, 0x70,
-    0x1, 0x80, 0x60, 0xe, 0x1, 0xc0, 0x30, 0x3,
-    0x0, 0xc0, 0xc, 0x3, 0x0, 0x30, 0xc, 0x0,
-    0xc0, 0x38, 0x7, 0x0, 0x60, 0x18, 0x0, 0xe1,
-    0xc0, 0x1, 0xfe, 0x0, 0x3, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0x80, 0xf, 0xff, 0xc0, 0x7f,
-    0xff, 0x83, 0x87, 0x87, 0x1c, 0xc, 0xe, 0x60,
-    0x30, 0x1b, 0x80, 0xc0, 0x7c, 0x3, 0x0, 0xf0,
-    0x1e, 0x3, 0xc0, 0x78, 0xf, 0x1, 0xe0, 0x3c,
-    0x7, 0x80, 0xf0, 0x1e, 0x3, 0xc0, 0xfc, 0xf,
-    0x3, 0xf0, 0x3c, 0x7, 0x80, 0xf0, 0xc, 0x3,
-    0xc0, 0x0, 0xf, 0x0, 0x0, 0x3f, 0xff, 0xff,
-    0xdf, 0xff, 0xfe,
-
-    /* U+0071 "q" */
-    0xf, 0x0, 0x3f, 0xc0, 0x70, 0xe0, 0x60, 0x60,
-    0xc0, 0x30, 0xc0, 0x30, 0xc0, 0x30, 0xc0, 0x30,
-    0xc0, 0x30, 0xc0, 0x30, 0xc0, 0x33, 0xc0, 0x33,
-    0xc0, 0x33, 0xc0, 0x33, 0xcc, 0x33, 0xcc, 0x33,
-    0xcc, 0x33, 0xcc, 0x33, 0xcc, 0x33, 0xcc, 0x33,
-    0xcc, 0x33, 0xcc, 0x33, 0xcc, 0x33, 0xcc, 0x33,
-    0xcc, 0x33, 0xce, 0x73, 0xc7, 0xe3, 0xc3, 0xc3,
-    0xc0, 0x3, 0xc0, 0x7, 0x60, 0x6, 0x70, 0xe,
-    0x3c, 0x3c, 0x1f, 0xf8, 0x7, 0xe0,
-
-    /* U+0072 "r" */
-    0x0, 0x0, 0xc0, 0x0, 0x0, 0x0, 0x30, 0x0,
-    0x0, 0x0, 0xc, 0x0, 0x0, 0x0, 0x3, 0x0,
-    0x0, 0x0, 0x0, 0xc0, 0x0, 0x1, 0x80, 0x78,
-    0x6, 0x0, 0x71, 0xff, 0xe3, 0x80, 0xf, 0xf0,
-    0x3f, 0xc0, 0x1, 0xf0, 0x3, 0xe0, 0x0, 0x70,
-    0x0, 0x38, 0x0, 0x18, 0x0, 0x6, 0x0, 0xe,
-    0x0, 0x1, 0xc0, 0x3, 0x0, 0x0, 0x30, 0x1,
-    0xc1, 0x80, 0xe, 0x0, 0x60, 0xe0, 0x81, 0x80,
-    0x18, 0x3c, 0xf0, 0x60, 0xfe, 0x1f, 0x7e, 0x1f,
-    0xff, 0x8e, 0xfd, 0xc7, 0xf0, 0x63, 0x1e, 0x39,
-    0x80, 0x18, 0x7, 0x4, 0x60, 0x3, 0x1, 0x80,
-    0x30, 0x0, 0xc0, 0x0, 0xc, 0x0, 0x38, 0x0,
-    0x3, 0x0, 0x6, 0x0, 0x1, 0x80, 0x1, 0xc0,
-    0x0, 0x60, 0x0, 0x70, 0x0, 0x38, 0x0, 0x3e,
-    0x0, 0xf, 0x0, 0x1d, 0xc0, 0x6, 0xe0, 0x6,
-    0x30, 0x1, 0x98, 0x1, 0xe, 0x0, 0x42, 0x0,
-    0x3, 0x80, 0x30, 0x0, 0x0, 0x7f, 0xfc, 0x0,
-    0x0, 0x1f, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xc0, 0x0, 0x0, 0x1f, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7c,
-    0x0, 0x0, 0x0, 0x1f, 0x0, 0x0,
-
-    /* U+0073 "s" */
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0xf0, 0x7, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xfc, 0x1, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0xc0, 0x1f, 0xff, 0xf0,
-
-    /* U+0074 "t" */
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf0,
-
-    /* U+0075 "u" */
-    0x0, 0x3, 0xfc, 0x0, 0x0, 0x1, 0xff, 0xf8,
-    0x0, 0x0, 0x78, 0x1f, 0xe0, 0x0, 0x1e, 0x1,
-    0xcf, 0x80, 0x3, 0xf0, 0x1c, 0x3c, 0x0, 0x73,
-    0x80, 0xc1, 0xe0, 0xe, 0x1c, 0xc, 0x7, 0x1,
-    0xc0, 0xc0, 0xc0, 0x38, 0x18, 0x6, 0xc, 0x3,
-    0x83, 0x0, 0x70, 0xe0, 0x7c, 0x30, 0x3, 0x6,
-    0xe, 0xc6, 0x0, 0x38, 0x61, 0xc6, 0x60, 0x1,
-    0x86, 0x18, 0x66, 0x0, 0x18, 0x63, 0x86, 0xe0,
-    0x0, 0xc6, 0x30, 0x3f, 0x0, 0xc, 0x67, 0x3,
-    0xfc, 0x0, 0xc6, 0x60, 0x3d, 0xf0, 0xc, 0x66,
-    0x3, 0xc7, 0xc0, 0xc6, 0x60, 0xfc, 0x1f, 0x8c,
-    0x66, 0x7f, 0xc0, 0x7f, 0xc6, 0x7f, 0xbc, 0x0,
-    0xff, 0xff, 0xe3, 0x60, 0x1, 0xff, 0xf0, 0x66,
-    0x0, 0x18, 0x63, 0x86, 0x60, 0x3, 0x6, 0x38,
-    0x63, 0x0, 0x30, 0xe1, 0xcc, 0x30, 0x6, 0xc,
-    0x1d, 0xc1, 0x80, 0xe0, 0xc0, 0xf8, 0x1c, 0x1c,
-    0xc, 0x7, 0x80, 0xe3, 0x80, 0xc0, 0x70, 0x7,
-    0x70, 0xc, 0xe, 0x0, 0x3e, 0x1, 0xc3, 0xc0,
-    0x1, 0xe0, 0x1c, 0xf8, 0x0, 0x7, 0xc1, 0xbe,
-    0x0, 0x0, 0x1f, 0xff, 0x80, 0x0, 0x0, 0x3f,
-    0xc0, 0x0,
-
-    /* U+0076 "v" */
-    0x7, 0xff, 0xff, 0xff, 0xc0, 0x7, 0xff, 0xff,
-    0xff, 0xc0, 0x6, 0x0, 0x0, 0x0, 0xc0, 0xfe,
-    0x0, 0x0, 0x0, 0xff, 0xfe, 0x0, 0x0, 0x0,
-    0xff, 0xc6, 0x0, 0x0, 0x0, 0xc3, 0xc6, 0x0,
-    0x0, 0x0, 0xc3, 0xc6, 0x0, 0x0, 0x0, 0xc3,
-    0xc6, 0x0, 0x0, 0x0, 0xc3, 0xe6, 0x0, 0x0,
-    0x0, 0xc7, 0x66, 0x0, 0x0, 0x0, 0xc6, 0x66,
-    0x0, 0x0, 0x0, 0xce, 0x36, 0x0, 0x0, 0x0,
-    0xce, 0x3a, 0x0, 0x0, 0x0, 0xdc, 0x1e, 0x0,
-    0x0, 0x0, 0xf8, 0xe, 0x0, 0x0, 0x0, 0xf0,
-    0x3, 0x0, 0x0, 0x0, 0xc0, 0x3, 0x0, 0x0,
-    0x0, 0xc0, 0x1, 0x0, 0x0, 0x1, 0x80, 0x1,
-    0x0, 0x0, 0x1, 0x80, 0x1, 0x80, 0x0, 0x1,
-    0x80, 0x0, 0x80, 0x0, 0x3, 0x0, 0x0, 0xc0,
-    0x0, 0x7, 0x0, 0x0, 0x60, 0x0, 0xe, 0x0,
-    0x0, 0x30, 0x0, 0x1c, 0x0, 0x0, 0x1c, 0x0,
-    0x38, 0x0, 0x0, 0xf, 0x1, 0xf0, 0x0, 0x0,
-    0x7, 0xff, 0xe0, 0x0, 0x0, 0x1, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x18, 0x0, 0x0, 0x0, 0x0,
-    0x18, 0x0, 0x0, 0x0, 0x0, 0x18, 0x0, 0x0,
-    0x0, 0x0, 0x18, 0x0, 0x0, 0x0, 0x0, 0x18,
-    0x0, 0x0, 0x0, 0x0, 0x18, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xc0, 0x0, 0x0, 0x3, 0xff, 0xc0,
-    0x0,
-
-    /* U+0077 "w" */
-    0x0, 0x3, 0xfc, 0x0, 0x0, 0x1, 0xff, 0xf8,
-    0x0, 0x0, 0x7c, 0x3, 0xe0, 0x0, 0x1e, 0x0,
-    0x7, 0x80, 0x3, 0x80, 0x0, 0x1c, 0x0, 0x70,
-    0x0, 0x0, 0xe0, 0xe, 0x0, 0x0, 0x7, 0x1,
-    0xc0, 0x0, 0x0, 0x38, 0x18, 0x0, 0xc, 0x1,
-    0x83, 0x0, 0x1, 0xc0, 0xc, 0x30, 0x0, 0x38,
-    0x0, 0xc6, 0x0, 0x7, 0x0, 0x6, 0x60, 0x0,
-    0xe0, 0x0, 0x66, 0x0, 0x1c, 0x0, 0x6, 0xc0,
-    0x3, 0x80, 0x0, 0x3c, 0x0, 0x70, 0x0, 0x3,
-    0xc0, 0xe, 0x0, 0x0, 0x3c, 0x1, 0xc0, 0x0,
-    0x3, 0xc0, 0x38, 0x0, 0x0, 0x3c, 0x1, 0xc0,
-    0x0, 0x3, 0xc0, 0xe, 0x0, 0x0, 0x3c, 0x0,
-    0x70, 0x0, 0x3, 0x60, 0x3, 0x80, 0x0, 0x66,
-    0x0, 0x1c, 0x0, 0x6, 0x60, 0x0, 0xe0, 0x0,
-    0x63, 0x0, 0x7, 0x0, 0xc, 0x30, 0x0, 0x38,
-    0x0, 0xc1, 0x80, 0x1, 0xc0, 0x18, 0x1c, 0x0,
-    0xc, 0x3, 0x80, 0xe0, 0x0, 0x0, 0x70, 0x7,
-    0x0, 0x0, 0xe, 0x0, 0x38, 0x0, 0x1, 0xc0,
-    0x1, 0xe0, 0x0, 0x78, 0x0, 0x7, 0xc0, 0x3e,
-    0x0, 0x0, 0x1f, 0xff, 0x80, 0x0, 0x0, 0x3f,
-    0xc0, 0x0,
-
-    /* U+0078 "x" */
-    0x0, 0x0, 0x30, 0xc, 0x0, 0x30, 0x1e, 0x0,
-    0x30, 0x3f, 0x0, 0x30, 0x7f, 0x80, 0x30, 0xff,
-    0xc0, 0x30, 0xc, 0x0, 0x30, 0xc, 0x0, 0x30,
-    0xc, 0x0, 0x30, 0xc, 0x0, 0x30, 0xc, 0x0,
-    0x30, 0xc, 0x0, 0x30, 0xc, 0x0, 0x30, 0xc,
-    0x0, 0x30, 0xc, 0x0, 0x30, 0xc, 0x0, 0x30,
-    0xc, 0x0, 0x30, 0xc, 0x0, 0x30, 0xc, 0x0,
-    0x30, 0xc, 0x0, 0x30, 0xc, 0x0, 0x30, 0xc,
-    0x0, 0x30, 0xc, 0x0, 0x30, 0xc, 0x0, 0x30,
-    0xc, 0x0, 0x30, 0xc, 0x0, 0x30, 0xc, 0x0,
-    0x30, 0xc, 0x0, 0x30, 0xc, 0x0, 0x30, 0xc,
-    0x0, 0x30, 0xc, 0x0, 0x30, 0xc, 0x0, 0x30,
-    0xc, 0x3, 0xff, 0xc, 0x1, 0xfe, 0xc, 0x0,
-    0xfc, 0xc, 0x0, 0x78, 0xc, 0x0, 0x38, 0xc,
-    0x0, 0x10,
-
-    /* U+0079 "y" */
-    0x0, 0x3, 0xfc, 0x0, 0x0, 0x1, 0xff, 0xf8,
-    0x0, 0x0, 0x7c, 0x3, 0xe0, 0x0, 0x1e, 0x0,
-    0x7, 0x80, 0x3, 0x80, 0x0, 0x1c, 0x0, 0x70,
-    0x0, 0x0, 0xe0, 0xe, 0x0, 0x0, 0x7, 0x1,
-    0xc0, 0x0, 0x0, 0x38, 0x18, 0x0, 0x0, 0x1,
-    0x83, 0x0, 0x0, 0x0, 0xc, 0x30, 0x0, 0x0,
-    0x0, 0xc6, 0x0, 0xe, 0x0, 0x6, 0x60, 0x1,
-    0xf0, 0x0, 0x66, 0x0, 0x3b, 0x80, 0x6, 0xc0,
-    0x7, 0x1c, 0x0, 0x3c, 0x0, 0xe0, 0xe0, 0x3,
-    0xc0, 0x1e, 0x7, 0x0, 0x3c, 0x3, 0xc0, 0x38,
-    0x3, 0xc0, 0x78, 0x1, 0xc0, 0x3c, 0xf, 0x0,
-    0xe, 0x3, 0xc1, 0xe0, 0x0, 0x70, 0x3c, 0x1c,
-    0x0, 0x7, 0x3, 0x60, 0x0, 0x0, 0x0, 0x66,
-    0x0, 0x0, 0x0, 0x6, 0x60, 0x0, 0x0, 0x0,
-    0x63, 0x0, 0x0, 0x0, 0xc, 0x30, 0x0, 0x0,
-    0x0, 0xc1, 0x80, 0x0, 0x0, 0x18, 0x1c, 0x0,
-    0x0, 0x3, 0x80, 0xe0, 0x0, 0x0, 0x70, 0x7,
-    0x0, 0x0, 0xe, 0x0, 0x38, 0x0, 0x1, 0xc0,
-    0x1, 0xe0, 0x0, 0x78, 0x0, 0x7, 0xc0, 0x3e,
-    0x0, 0x0, 0x1f, 0xff, 0x80, 0x0, 0x0, 0x3f,
-    0xc0, 0x0,
-
-    /* U+007A "z" */
-    0x0, 0x0, 0x3f, 0xc0, 0x0, 0x0, 0x1, 0xff,
-    0xf8, 0x0, 0x0, 0x7, 0xc0, 0x3e, 0x0, 0x0,
-    0x1f, 0x0, 0x7, 0x80, 0x0, 0x3c, 0x0, 0x1,
-    0xc0, 0x0, 0x70, 0x0, 0x0, 0xe0, 0x0, 0xe0,
-    0x0, 0x0, 0x70, 0x0, 0xc0, 0x0, 0x0, 0x38,
-    0x1, 0xc0, 0x0, 0x0, 0x18, 0x3, 0x80, 0x0,
-    0x0, 0xc, 0x3, 0x0, 0x0, 0x0, 0xc, 0x7,
-    0x0, 0x0, 0x0, 0x6, 0x6, 0x0, 0x0, 0x0,
-    0x6, 0x6, 0x0, 0x0, 0x0, 0x6, 0x6, 0x0,
-    0x0, 0x0, 0x3, 0x6, 0x0, 0x0, 0x0, 0x3,
-    0xe, 0x0, 0x0, 0x0, 0x3, 0x7f, 0xc0, 0x0,
-    0x0, 0x3, 0x3f, 0x80, 0x0, 0x0, 0x3, 0x1f,
-    0x0, 0x0, 0x0, 0x3, 0xe, 0x0, 0x0, 0x0,
-    0x3, 0x4, 0x0, 0x0, 0x0, 0x3, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0x0, 0x0, 0x0, 0x0, 0xc, 0x0,
-    0x0, 0x0, 0x0, 0x18, 0x0, 0x0, 0x0, 0x0,
-    0x38, 0x0, 0x0, 0x0, 0x0, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0xe0, 0x0, 0x0, 0x0, 0x1, 0xc0,
-    0x0, 0x1, 0x0, 0x7, 0x80, 0x0, 0x1, 0xc0,
-    0x3e, 0x0, 0x0, 0x1, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x3f, 0xc0, 0x0,
-
-    /* U+007B "{" */
-    0x0, 0x2, 0x0, 0x0, 0x0, 0x0, 0x7, 0x0,
-    0x0, 0x0, 0x0, 0x6, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0x0, 0x0, 0x0, 0x0, 0x7, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xe0, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x3f, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0x80, 0x0, 0x0, 0x0, 0x1,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xfe,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x3, 0xc0, 0x0, 0x0, 0x0, 0x3, 0xc0,
-    0x0, 0x0, 0x0, 0x3, 0xc0, 0x0, 0x0, 0x0,
-    0x3, 0xc0, 0x0, 0x0, 0x0, 0x3, 0xc0, 0xc7,
-    0x18, 0xc3, 0x3, 0xc0, 0xc7, 0x18, 0xc3, 0x3,
-    0xc0, 0x18, 0xc3, 0x18, 0x3, 0xc0, 0x18, 0xc3,
-    0x18, 0x3, 0xc0, 0x0, 0x0, 0x0, 0x3, 0xc0,
-    0xc7, 0x18, 0xc3, 0x3, 0xc0, 0xc7, 0x18, 0xc3,
-    0x3, 0xc0, 0x0, 0x0, 0x0, 0x3, 0xc0, 0x0,
-    0x0, 0x0, 0x3, 0xc0, 0x0, 0x0, 0x0, 0x3,
-    0xc0, 0x0, 0x0, 0x0, 0x3, 0xc0, 0x7f, 0xff,
-    0xfc, 0x3, 0xc0, 0x7f, 0xff, 0xfc, 0x3, 0xc0,
-    0x0, 0x0, 0x0, 0x3, 0xc0, 0x0, 0x0, 0x0,
-    0x3, 0xc0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xfe,
-
-    /* U+007C "|" */
-    0x0, 0x2, 0x0, 0x80, 0x0, 0x0, 0x3e, 0x3,
-    0xe0, 0x0, 0x7, 0xfc, 0x7, 0xfc, 0x0, 0xff,
-    0x9e, 0x3c, 0xff, 0x8f, 0xf0, 0x1f, 0xf0, 0x1f,
-    0xfe, 0x0, 0xf, 0x80, 0x3, 0xf0, 0x0, 0x0,
-    0x0, 0x1, 0xf0, 0x0, 0x0, 0x0, 0x7, 0x60,
-    0x0, 0x0, 0x0, 0xc, 0xc0, 0x0, 0x0, 0x0,
-    0x19, 0x80, 0x0, 0x0, 0x0, 0x33, 0x80, 0x0,
-    0x0, 0x0, 0xe3, 0xfc, 0x0, 0x0, 0x7f, 0x87,
-    0xf8, 0x0, 0x0, 0xff, 0x0, 0x30, 0x0, 0x1,
-    0x80, 0x0, 0x60, 0x0, 0x3, 0x0, 0x0, 0xc0,
-    0x0, 0x6, 0x0, 0x1, 0x80, 0x0, 0xc, 0x0,
-    0x3, 0x0, 0x0, 0x18, 0x0, 0x6, 0x0, 0x0,
-    0x30, 0x0, 0xc, 0x0, 0x0, 0x60, 0x0, 0x18,
-    0x0, 0x0, 0xc0, 0x0, 0x30, 0x0, 0x1, 0x80,
-    0x0, 0x60, 0x0, 0x3, 0x0, 0x0, 0xc0, 0x0,
-    0x6, 0x0, 0x1, 0x80, 0x0, 0xc, 0x0, 0x3,
-    0x0, 0x0, 0x18, 0x0, 0x6, 0x0, 0x0, 0x30,
-    0x0, 0xc, 0x0, 0x0, 0x60, 0x0, 0x18, 0x0,
-    0x0, 0xc0, 0x0, 0x3f, 0xff, 0xff, 0x80, 0x0,
-    0x7f, 0xff, 0xff, 0x0,
-
-    /* U+007D "}" */
-    0xff, 0xff, 0xfe, 0x7, 0xff, 0xff, 0xf8, 0x30,
-    0x7e, 0x18, 0xe1, 0x83, 0xf0, 0xc3, 0x8c, 0x1f,
-    0x86, 0xe, 0x60, 0xfc, 0x30, 0x3b, 0x7, 0xe1,
-    0x80, 0xf8, 0x3f, 0xc, 0x3, 0xc1, 0xff, 0xe0,
-    0x1e, 0xf, 0xff, 0x0, 0xf0, 0x0, 0x0, 0x7,
-    0x80, 0x0, 0x0, 0x3c, 0x0, 0x0, 0x1, 0xe0,
-    0x0, 0x0, 0xf, 0x0, 0x0, 0x0, 0x78, 0x0,
-    0x0, 0x3, 0xc0, 0x0, 0x0, 0x1e, 0x0, 0x0,
-    0x0, 0xf0, 0x0, 0x0, 0x7, 0x80, 0x0, 0x0,
-    0x3c, 0x0, 0x0, 0x1, 0xe0, 0x0, 0x0, 0xf,
-    0x0, 0x0, 0x0, 0x78, 0x0, 0x0, 0x3, 0xc0,
-    0x0, 0x0, 0x1e, 0x0, 0x0, 0x0, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-
-    /* U+007E "~" */
-    0x0, 0x0, 0x1f, 0xff, 0x80, 0x0, 0x1f, 0xff,
-    0xc0, 0x0, 0x1c, 0x0, 0x60, 0x0, 0x1c, 0x0,
-    0x30, 0x0, 0x1c, 0xe, 0x18, 0x0, 0x1c, 0xf,
-    0x8c, 0x0, 0x1c, 0xc, 0x66, 0x0, 0x1c, 0x6,
-    0x33, 0x0, 0x1c, 0x3, 0x19, 0x80, 0x1c, 0x0,
-    0xf8, 0xc0, 0x1c, 0x0, 0x38, 0x60, 0x1c, 0x0,
-    0x0, 0x30, 0x1c, 0x0, 0x0, 0x18, 0x1c, 0x0,
-    0x0, 0x1c, 0x1c, 0x0, 0x0, 0x1c, 0x1c, 0x0,
-    0x0, 0x1c, 0x1c, 0x0, 0x0, 0x1c, 0x1c, 0x0,
-    0x0, 0x1c, 0x1c, 0x0, 0x0, 0x1c, 0xc, 0x0,
-    0x0, 0x1c, 0x7, 0x0, 0x0, 0x1c, 0x1, 0xc0,
-    0x0, 0x1c, 0x0, 0x70, 0x0, 0x1c, 0x0, 0x1c,
-    0x0, 0x1c, 0x0, 0x7, 0x0, 0x1c, 0x0, 0x1,
-    0xc0, 0x1c, 0x0, 0x0, 0x70, 0x1c, 0x0, 0x0,
-    0x1c, 0x1c, 0x0, 0x0, 0x7, 0x1c, 0x0, 0x0,
-    0x1, 0xdc, 0x0, 0x0, 0x0, 0x7c, 0x0, 0x0,
-    0x0, 0x1c, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0
+    0xfe
 };
 
 
@@ -1878,122 +83,32 @@ static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] = {
 static const lv_font_fmt_txt_glyph_dsc_t glyph_dsc[] = {
     {.bitmap_index = 0, .adv_w = 0, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0} /* id = 0 reserved */,
     {.bitmap_index = 0, .adv_w = 320, .box_w = 1, .box_h = 1, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1, .adv_w = 632, .box_w = 37, .box_h = 34, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 159, .adv_w = 600, .box_w = 37, .box_h = 35, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 321, .adv_w = 644, .box_w = 36, .box_h = 36, .ofs_x = 1, .ofs_y = -5},
-    {.bitmap_index = 483, .adv_w = 384, .box_w = 21, .box_h = 34, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 573, .adv_w = 653, .box_w = 36, .box_h = 30, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 708, .adv_w = 409, .box_w = 22, .box_h = 40, .ofs_x = 2, .ofs_y = -5},
-    {.bitmap_index = 818, .adv_w = 666, .box_w = 38, .box_h = 38, .ofs_x = 3, .ofs_y = -5},
-    {.bitmap_index = 999, .adv_w = 662, .box_w = 38, .box_h = 38, .ofs_x = 2, .ofs_y = -5},
-    {.bitmap_index = 1180, .adv_w = 583, .box_w = 33, .box_h = 40, .ofs_x = 2, .ofs_y = -5},
-    {.bitmap_index = 1345, .adv_w = 645, .box_w = 36, .box_h = 28, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 1471, .adv_w = 655, .box_w = 36, .box_h = 18, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 1552, .adv_w = 467, .box_w = 26, .box_h = 31, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 1653, .adv_w = 646, .box_w = 36, .box_h = 18, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 1734, .adv_w = 673, .box_w = 40, .box_h = 40, .ofs_x = 1, .ofs_y = -5},
-    {.bitmap_index = 1934, .adv_w = 694, .box_w = 40, .box_h = 28, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 2074, .adv_w = 674, .box_w = 37, .box_h = 36, .ofs_x = 2, .ofs_y = -5},
-    {.bitmap_index = 2241, .adv_w = 628, .box_w = 36, .box_h = 36, .ofs_x = 2, .ofs_y = -5},
-    {.bitmap_index = 2403, .adv_w = 628, .box_w = 36, .box_h = 36, .ofs_x = 2, .ofs_y = -5},
-    {.bitmap_index = 2565, .adv_w = 594, .box_w = 36, .box_h = 36, .ofs_x = 1, .ofs_y = -5},
-    {.bitmap_index = 2727, .adv_w = 548, .box_w = 34, .box_h = 34, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 2872, .adv_w = 669, .box_w = 40, .box_h = 28, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 3012, .adv_w = 520, .box_w = 30, .box_h = 30, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 3125, .adv_w = 520, .box_w = 30, .box_h = 30, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 3238, .adv_w = 516, .box_w = 31, .box_h = 31, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 3359, .adv_w = 660, .box_w = 36, .box_h = 30, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 3494, .adv_w = 655, .box_w = 36, .box_h = 18, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 3575, .adv_w = 628, .box_w = 36, .box_h = 36, .ofs_x = 2, .ofs_y = -5},
-    {.bitmap_index = 3737, .adv_w = 662, .box_w = 38, .box_h = 38, .ofs_x = 2, .ofs_y = -5},
-    {.bitmap_index = 3918, .adv_w = 655, .box_w = 36, .box_h = 18, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 3999, .adv_w = 662, .box_w = 38, .box_h = 38, .ofs_x = 2, .ofs_y = -5},
-    {.bitmap_index = 4180, .adv_w = 635, .box_w = 36, .box_h = 40, .ofs_x = 2, .ofs_y = -5},
-    {.bitmap_index = 4360, .adv_w = 497, .box_w = 26, .box_h = 40, .ofs_x = 3, .ofs_y = -5},
-    {.bitmap_index = 4490, .adv_w = 497, .box_w = 26, .box_h = 40, .ofs_x = 3, .ofs_y = -5},
-    {.bitmap_index = 4620, .adv_w = 643, .box_w = 37, .box_h = 40, .ofs_x = 3, .ofs_y = -5},
-    {.bitmap_index = 4805, .adv_w = 545, .box_w = 30, .box_h = 40, .ofs_x = 3, .ofs_y = -5},
-    {.bitmap_index = 4955, .adv_w = 649, .box_w = 36, .box_h = 30, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 5090, .adv_w = 590, .box_w = 32, .box_h = 31, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 5214, .adv_w = 660, .box_w = 36, .box_h = 30, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 5349, .adv_w = 660, .box_w = 36, .box_h = 30, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 5484, .adv_w = 651, .box_w = 36, .box_h = 33, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 5633, .adv_w = 610, .box_w = 36, .box_h = 35, .ofs_x = 1, .ofs_y = -4},
-    {.bitmap_index = 5791, .adv_w = 559, .box_w = 31, .box_h = 31, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 5912, .adv_w = 559, .box_w = 32, .box_h = 31, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 6036, .adv_w = 582, .box_w = 32, .box_h = 32, .ofs_x = 2, .ofs_y = 1},
-    {.bitmap_index = 6164, .adv_w = 586, .box_w = 33, .box_h = 33, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 6301, .adv_w = 524, .box_w = 31, .box_h = 31, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 6422, .adv_w = 414, .box_w = 22, .box_h = 36, .ofs_x = 2, .ofs_y = -5},
-    {.bitmap_index = 6521, .adv_w = 439, .box_w = 26, .box_h = 23, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 6596, .adv_w = 423, .box_w = 24, .box_h = 34, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 6698, .adv_w = 434, .box_w = 26, .box_h = 26, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 6783, .adv_w = 432, .box_w = 27, .box_h = 26, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 6871, .adv_w = 630, .box_w = 36, .box_h = 36, .ofs_x = 2, .ofs_y = -5},
-    {.bitmap_index = 7033, .adv_w = 605, .box_w = 35, .box_h = 35, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 7187, .adv_w = 626, .box_w = 36, .box_h = 36, .ofs_x = 2, .ofs_y = -5},
-    {.bitmap_index = 7349, .adv_w = 637, .box_w = 36, .box_h = 39, .ofs_x = 2, .ofs_y = -5},
-    {.bitmap_index = 7525, .adv_w = 628, .box_w = 36, .box_h = 36, .ofs_x = 2, .ofs_y = -5},
-    {.bitmap_index = 7687, .adv_w = 679, .box_w = 40, .box_h = 36, .ofs_x = 2, .ofs_y = -5},
-    {.bitmap_index = 7867, .adv_w = 666, .box_w = 40, .box_h = 30, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 8017, .adv_w = 510, .box_w = 26, .box_h = 40, .ofs_x = 3, .ofs_y = -5},
-    {.bitmap_index = 8147, .adv_w = 578, .box_w = 32, .box_h = 40, .ofs_x = 2, .ofs_y = -5},
-    {.bitmap_index = 8307, .adv_w = 544, .box_w = 29, .box_h = 39, .ofs_x = 2, .ofs_y = -5},
-    {.bitmap_index = 8449, .adv_w = 467, .box_w = 26, .box_h = 31, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 8550, .adv_w = 628, .box_w = 36, .box_h = 36, .ofs_x = 2, .ofs_y = -5},
-    {.bitmap_index = 8712, .adv_w = 496, .box_w = 26, .box_h = 40, .ofs_x = 3, .ofs_y = -5},
-    {.bitmap_index = 8842, .adv_w = 496, .box_w = 26, .box_h = 40, .ofs_x = 3, .ofs_y = -5},
-    {.bitmap_index = 8972, .adv_w = 543, .box_w = 30, .box_h = 40, .ofs_x = 2, .ofs_y = -5},
-    {.bitmap_index = 9122, .adv_w = 542, .box_w = 30, .box_h = 40, .ofs_x = 3, .ofs_y = -5},
-    {.bitmap_index = 9272, .adv_w = 706, .box_w = 40, .box_h = 30, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 9422, .adv_w = 589, .box_w = 32, .box_h = 31, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 9546, .adv_w = 702, .box_w = 40, .box_h = 40, .ofs_x = 2, .ofs_y = -5},
-    {.bitmap_index = 9746, .adv_w = 651, .box_w = 36, .box_h = 33, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 9895, .adv_w = 626, .box_w = 36, .box_h = 36, .ofs_x = 2, .ofs_y = -5},
-    {.bitmap_index = 10057, .adv_w = 621, .box_w = 35, .box_h = 35, .ofs_x = 2, .ofs_y = -5},
-    {.bitmap_index = 10211, .adv_w = 559, .box_w = 31, .box_h = 31, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 10332, .adv_w = 714, .box_w = 40, .box_h = 30, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 10482, .adv_w = 582, .box_w = 32, .box_h = 32, .ofs_x = 2, .ofs_y = 1},
-    {.bitmap_index = 10610, .adv_w = 533, .box_w = 32, .box_h = 33, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 10742, .adv_w = 497, .box_w = 27, .box_h = 35, .ofs_x = 2, .ofs_y = -5},
-    {.bitmap_index = 10861, .adv_w = 414, .box_w = 22, .box_h = 36, .ofs_x = 2, .ofs_y = -5},
-    {.bitmap_index = 10960, .adv_w = 319, .box_w = 16, .box_h = 35, .ofs_x = 2, .ofs_y = -5},
-    {.bitmap_index = 11030, .adv_w = 576, .box_w = 34, .box_h = 39, .ofs_x = 1, .ofs_y = -5},
-    {.bitmap_index = 11196, .adv_w = 434, .box_w = 26, .box_h = 26, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 11281, .adv_w = 442, .box_w = 26, .box_h = 26, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 11366, .adv_w = 626, .box_w = 36, .box_h = 36, .ofs_x = 2, .ofs_y = -5},
-    {.bitmap_index = 11528, .adv_w = 693, .box_w = 40, .box_h = 37, .ofs_x = 2, .ofs_y = -5},
-    {.bitmap_index = 11713, .adv_w = 626, .box_w = 36, .box_h = 36, .ofs_x = 2, .ofs_y = -5},
-    {.bitmap_index = 11875, .adv_w = 450, .box_w = 24, .box_h = 38, .ofs_x = 2, .ofs_y = -5},
-    {.bitmap_index = 11989, .adv_w = 626, .box_w = 36, .box_h = 36, .ofs_x = 2, .ofs_y = -5},
-    {.bitmap_index = 12151, .adv_w = 679, .box_w = 40, .box_h = 36, .ofs_x = 1, .ofs_y = -5},
-    {.bitmap_index = 12331, .adv_w = 692, .box_w = 40, .box_h = 40, .ofs_x = 2, .ofs_y = -5},
-    {.bitmap_index = 12531, .adv_w = 681, .box_w = 39, .box_h = 32, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 12687, .adv_w = 546, .box_w = 29, .box_h = 28, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 12789, .adv_w = 548, .box_w = 33, .box_h = 33, .ofs_x = 0, .ofs_y = -1}
+    {.bitmap_index = 1, .adv_w = 655, .box_w = 36, .box_h = 18, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 82, .adv_w = 646, .box_w = 36, .box_h = 18, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 163, .adv_w = 655, .box_w = 36, .box_h = 18, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 244, .adv_w = 655, .box_w = 36, .box_h = 18, .ofs_x = 2, .ofs_y = 0}
 };
 
 /*---------------------
  *  CHARACTER MAPPING
  *--------------------*/
 
-
+static const uint16_t unicode_list_0[] = {
+    0, 12, 14, 27, 30
+};
 
 /*Collect the unicode lists and glyph_id offsets*/
 static const lv_font_fmt_txt_cmap_t cmaps[] =
 {
     {
-        .range_start = 32, .range_length = 5, .glyph_id_start = 1,
-        .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY
-    },
-    {
-        .range_start = 38, .range_length = 89, .glyph_id_start = 6,
-        .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY
+        .range_start = 32, .range_length = 31, .glyph_id_start = 1,
+        .unicode_list = unicode_list_0, .glyph_id_ofs_list = NULL, .list_length = 5, .type = LV_FONT_FMT_TXT_CMAP_SPARSE_TINY
     }
 };
 
 
 
+
 /*--------------------
  *  ALL CUSTOM DATA
  *--------------------*/
@@ -2013,7 +128,7 @@ static lv_font_fmt_txt_dsc_t font_dsc = {
     .cmaps = cmaps,
     .kern_dsc = NULL,
     .kern_scale = 0,
-    .cmap_num = 2,
+    .cmap_num = 1,
     .bpp = 1,
     .kern_classes = 0,
     .bitmap_format = 0,
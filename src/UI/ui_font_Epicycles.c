@@ -2,6 +2,7 @@
  * Size: 32 px
  * Bpp: 1
  * Opts: --bpp 1 --size 32 --font /Users/gjonesblackcyton/Documents/PlatformIO/Projects/klaussometer_test/SL/assets/EYECIC__.ttf -o /Users/gjonesblackcyton/Documents/PlatformIO/Projects/klaussometer_test/SL/assets/ui_font_Epicycles.c --format lvgl -r 0x20-0x7f --no-compress --no-prefilter
+ * Subset: U+0020, U+0061, U+0062 (scripts/font_subset.py)
  ******************************************************************************/
 
 #include "ui.h"
@@ -21,483 +22,6 @@ static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] = {
     /* U+0020 " " */
     0x0,
 
-    /* U+0021 "!" */
-    0xf, 0xc1, 0xf8, 0xf, 0xff, 0xfe, 0xf, 0xff,
-    0xff, 0x8f, 0xf9, 0x3f, 0xef, 0xfc, 0x9f, 0xff,
-    0xfe, 0xf, 0xff, 0xff, 0x7, 0xff, 0xff, 0x83,
-    0xff, 0xff, 0xc1, 0xff, 0xff, 0xe0, 0xff, 0xf8,
-    0x0, 0x0, 0xcc, 0x0, 0x0, 0x67, 0x80, 0x0,
-    0xf3, 0x80, 0x0, 0x39, 0x80, 0x0, 0xd, 0xff,
-    0x83, 0xff, 0xff, 0xc1, 0xff, 0xff, 0xe0, 0xff,
-    0xff, 0xf0, 0x7f, 0xff, 0xf8, 0x3f, 0xff, 0xfc,
-    0x9f, 0xfb, 0xfe, 0x4f, 0xf9, 0xff, 0xff, 0xfc,
-    0x7f, 0xff, 0xfc, 0x1f, 0xf7, 0xfc, 0x0, 0x80,
-    0x20, 0x0,
-
-    /* U+0026 "&" */
-    0x0, 0x10, 0x20, 0x0, 0x50, 0x61, 0x8a, 0x1,
-    0xf0, 0xfe, 0x3e, 0xf, 0xa2, 0xb9, 0xfe, 0x3f,
-    0x8b, 0xc7, 0xf1, 0xff, 0x2f, 0x3f, 0xf5, 0xf8,
-    0xbc, 0x7f, 0x1f, 0xe2, 0xf1, 0xfe, 0x15, 0xc,
-    0xc2, 0xa0, 0x10, 0x2f, 0x2, 0x0, 0x0, 0xbc,
-    0x0, 0x0, 0x2, 0xf0, 0x0, 0x0, 0xb, 0xc0,
-    0x0, 0x0, 0x2f, 0x0, 0x0, 0x0, 0xcc, 0x0,
-    0x0, 0x2, 0xf0, 0x0, 0x0, 0xb, 0xc0, 0x0,
-    0x0, 0x2b, 0x0, 0x0, 0x0, 0xbc, 0x0, 0x0,
-    0x1, 0xf0, 0x0, 0x0, 0x7, 0x80, 0x1, 0x0,
-    0xe, 0x0, 0x22, 0x0, 0x0, 0x1, 0x6, 0x0,
-    0x0, 0x8, 0x7, 0x0, 0x1, 0xc0, 0xf, 0x80,
-    0x3e, 0x0, 0x1f, 0xff, 0xf0, 0x0, 0x3f, 0xff,
-    0x80, 0x0, 0x7f, 0xfc, 0x0, 0x0, 0xff, 0xc0,
-    0x0, 0x1, 0xfe, 0x0, 0x0, 0x3, 0xf0, 0x0,
-    0x0, 0x7, 0x80, 0x0, 0x0, 0xc, 0x0, 0x0,
-
-    /* U+0028 "(" */
-    0x0, 0x1c, 0x0, 0x0, 0xf, 0x0, 0x0, 0xf,
-    0x80, 0x0, 0xf, 0xe0, 0x0, 0x7, 0xf8, 0x0,
-    0xf, 0xfe, 0x0, 0xf, 0xff, 0x80, 0x1f, 0xff,
-    0xf0, 0x7f, 0xff, 0xff, 0x7f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff,
-    0xf1, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xf8, 0x3f,
-    0xff, 0xf8, 0x1f, 0xff, 0xfc, 0x7, 0xff, 0xfc,
-    0x3, 0xff, 0xfe, 0x1, 0xff, 0xff, 0x0, 0xff,
-    0xff, 0x80, 0x7f, 0xff, 0xc0, 0x3f, 0xff, 0xe0,
-    0x1f, 0xff, 0xf0, 0x7, 0x80, 0x70, 0x0,
-
-    /* U+0029 ")" */
-    0x0, 0xc, 0x0, 0x0, 0x4, 0x80, 0x0, 0x2,
-    0x10, 0x0, 0x0, 0x84, 0x0, 0x0, 0x40, 0x80,
-    0x0, 0x20, 0x10, 0x0, 0x30, 0x2, 0x0, 0x30,
-    0x0, 0x60, 0x70, 0x0, 0x7, 0x30, 0x0, 0x0,
-    0x38, 0x0, 0x0, 0x6, 0x0, 0x0, 0x1, 0x40,
-    0x0, 0x0, 0xd8, 0x0, 0x0, 0x62, 0x0, 0x0,
-    0x10, 0x40, 0x0, 0xc, 0x10, 0x0, 0x2, 0x6,
-    0x0, 0x0, 0x80, 0x80, 0x0, 0x40, 0x20, 0x0,
-    0x10, 0x8, 0x0, 0x4, 0x2, 0x0, 0x1, 0x0,
-    0x80, 0x0, 0x40, 0x20, 0x0, 0x10, 0x8, 0x3f,
-    0x4, 0x2, 0x30, 0x31, 0x0, 0x70, 0x3, 0x80,
-
-    /* U+002E "." */
-    0x60, 0x0, 0x3b, 0xe0, 0xf, 0x9c, 0x7f, 0xbc,
-    0x78, 0x3, 0xc2, 0xa0, 0x2a, 0x12, 0xfe, 0x90,
-    0x48, 0x9, 0x2, 0x40, 0x48, 0x12, 0x2, 0x40,
-    0x90, 0x12, 0x4, 0x80, 0x90, 0x24, 0x4, 0x81,
-    0x20, 0x24, 0x12, 0xfe, 0xa0, 0xac, 0x1a, 0x87,
-    0x80, 0x3c, 0x59, 0xfc, 0xe3, 0xf0, 0x1f, 0x9c,
-    0x0, 0x1d, 0x80, 0x0, 0x20,
-
-    /* U+0030 "0" */
-    0xc0, 0x0, 0x5, 0xc0, 0x0, 0x21, 0xc0, 0x0,
-    0x81, 0xc0, 0x4, 0x1, 0xc0, 0x20, 0x1e, 0x0,
-    0x83, 0x0, 0x4, 0x30, 0x0, 0x23, 0x38, 0x0,
-    0x92, 0x60, 0x5, 0x20, 0x80, 0x29, 0x2, 0x0,
-    0x8c, 0xc, 0x4, 0x20, 0x30, 0x0, 0x80, 0xc0,
-    0x6, 0x1, 0x0, 0x10, 0x70, 0x0, 0x46, 0x0,
-    0x1, 0x20, 0x0, 0xe, 0x0, 0x0, 0x30, 0x0,
-    0x0, 0x80,
-
-    /* U+0031 "1" */
-    0x0, 0x0, 0x18, 0x0, 0x7, 0x40, 0x1, 0xc4,
-    0x0, 0x70, 0x20, 0x1c, 0x1, 0x0, 0x70, 0x10,
-    0x0, 0x60, 0x80, 0x1, 0x84, 0x0, 0xe6, 0x20,
-    0xc, 0x92, 0x0, 0x82, 0x50, 0x8, 0x12, 0x81,
-    0x80, 0x88, 0x18, 0x8, 0x41, 0x80, 0x80, 0x10,
-    0xc, 0x0, 0x70, 0x40, 0x0, 0xc4, 0x0, 0x2,
-    0x40, 0x0, 0xe, 0x0, 0x0, 0x60, 0x0, 0x2,
-    0x0, 0x0,
-
-    /* U+0032 "2" */
-    0x0, 0x1, 0x0, 0x0, 0x18, 0x0, 0x1, 0xc0,
-    0x0, 0x9, 0x0, 0x0, 0x8c, 0x0, 0x8, 0x38,
-    0x0, 0xc0, 0x21, 0x4, 0x6, 0x8, 0x40, 0x60,
-    0x64, 0x6, 0x5, 0x20, 0x40, 0x29, 0x4, 0x1,
-    0x2c, 0xc0, 0x11, 0xbc, 0x0, 0x86, 0x0, 0x4,
-    0xc, 0x0, 0x60, 0x3c, 0x2, 0x0, 0xe0, 0x10,
-    0x38, 0x0, 0x8e, 0x0, 0xb, 0x80, 0x0, 0x60,
-    0x0, 0x0,
-
-    /* U+0033 "3" */
-    0x4, 0x0, 0x0, 0x30, 0x0, 0x1, 0xc0, 0x0,
-    0x12, 0x0, 0x1, 0x88, 0x0, 0x70, 0x20, 0x3,
-    0x1, 0x80, 0xc, 0x4, 0x10, 0x30, 0x10, 0x80,
-    0x40, 0x46, 0x1, 0x2, 0x50, 0x6, 0x12, 0x80,
-    0x19, 0x26, 0x0, 0x7b, 0x10, 0x0, 0x30, 0x80,
-    0x3, 0x4, 0x0, 0x60, 0x10, 0xc, 0x0, 0x80,
-    0x1e, 0x4, 0x0, 0xe, 0x10, 0x0, 0xe, 0x80,
-    0x0, 0xc,
-
-    /* U+0034 "4" */
-    0x0, 0x4, 0x0, 0x0, 0x21, 0x81, 0x0, 0x6,
-    0x28, 0xc0, 0x0, 0xb8, 0xe8, 0x0, 0x10, 0x1,
-    0x0, 0x62, 0x0, 0x23, 0x7, 0x80, 0x3, 0xc0,
-    0x40, 0x0, 0x10, 0x4, 0x0, 0x4, 0x0, 0x80,
-    0x0, 0x80, 0x30, 0x0, 0x18, 0x38, 0x0, 0x0,
-    0xe7, 0x0, 0x0, 0x1c, 0x18, 0x0, 0xc, 0x1,
-    0x0, 0x1, 0x0, 0x20, 0x0, 0x20, 0x8, 0x0,
-    0x2, 0x3, 0xc0, 0x1, 0xe0, 0xc4, 0x0, 0x46,
-    0x0, 0x80, 0x8, 0x0, 0x17, 0x1d, 0x0, 0x3,
-    0x96, 0x60, 0x0, 0x42, 0x86, 0x0, 0x0, 0x30,
-    0x40, 0x0, 0x4, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0035 "5" */
-    0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x0, 0x2,
-    0x44, 0x0, 0x4, 0xf3, 0x40, 0x1, 0xbd, 0xd0,
-    0x2, 0x7a, 0xbc, 0x0, 0x76, 0x2f, 0x60, 0x14,
-    0x0, 0xf0, 0x3e, 0x0, 0xb, 0x82, 0x0, 0x1,
-    0xc7, 0x80, 0x0, 0x40, 0xc0, 0x0, 0xf, 0x8,
-    0x0, 0x3, 0x1c, 0x0, 0x0, 0xf7, 0x0, 0x0,
-    0x3c, 0xc0, 0x0, 0x8, 0xf8, 0x0, 0x1, 0x2,
-    0x0, 0x1, 0xf1, 0x80, 0x0, 0x60, 0x70, 0x0,
-    0x28, 0x3c, 0x0, 0xf, 0x1, 0x40, 0x2, 0x40,
-    0xf0, 0x3, 0x40, 0x25, 0x2, 0xb0, 0x1, 0xdb,
-    0x70, 0x0, 0xdb, 0xc4, 0x0, 0x6, 0x50, 0x0,
-    0x1, 0x0, 0x0,
-
-    /* U+0036 "6" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x8, 0x0,
-    0x0, 0x0, 0x84, 0x0, 0x0, 0x8, 0x62, 0x10,
-    0x0, 0x3, 0xff, 0x88, 0x0, 0x1, 0xa2, 0x2c,
-    0x0, 0x1b, 0x80, 0x1e, 0x0, 0x7, 0x80, 0x11,
-    0x10, 0x1, 0x0, 0x1, 0xf0, 0x3, 0x80, 0x0,
-    0x38, 0xf, 0x40, 0x0, 0x4, 0x1, 0x80, 0x0,
-    0x6, 0x40, 0xc0, 0x0, 0x1, 0xc0, 0x60, 0x0,
-    0x0, 0x40, 0x60, 0x0, 0x0, 0xa0, 0xf0, 0x0,
-    0x0, 0x30, 0x8, 0x0, 0x0, 0x18, 0x6, 0x0,
-    0x0, 0x7, 0x82, 0x0, 0x0, 0xa, 0x3, 0x0,
-    0x0, 0x5, 0x3, 0xc0, 0x0, 0x1, 0x2, 0x50,
-    0x0, 0x0, 0x80, 0x10, 0x0, 0x2, 0x78, 0xc,
-    0x0, 0x0, 0xc0, 0x7, 0x80, 0x0, 0x40, 0x6,
-    0x80, 0x1, 0x60, 0x4, 0x3e, 0x0, 0xf8, 0x0,
-    0x1c, 0x26, 0xc3, 0x0, 0x9, 0xe7, 0xe0, 0x0,
-    0x4, 0x6e, 0x10, 0x0, 0x0, 0x11, 0x4, 0x0,
-    0x0, 0x10, 0x40, 0x0, 0x0, 0x0, 0x20, 0x0,
-    0x0,
-
-    /* U+0037 "7" */
-    0x0, 0x1, 0x54, 0x2e, 0x85, 0xf4, 0x3f, 0x87,
-    0xfe, 0x7f, 0xc3, 0xfa, 0x5f, 0x42, 0xe8, 0x15,
-    0x40, 0x0,
-
-    /* U+0038 "8" */
-    0x0, 0x0, 0x12, 0x80, 0x76, 0x40, 0xdf, 0x7,
-    0x45, 0x84, 0x6, 0x14, 0x3, 0x18, 0x1c, 0x60,
-    0x1c, 0x60, 0x30, 0xd1, 0xe6, 0xdf, 0x1, 0xd9,
-    0x1, 0x28, 0x0, 0x0, 0x0,
-
-    /* U+0039 "9" */
-    0x7, 0xe1, 0xf8, 0x6, 0x7, 0x81, 0x82, 0x0,
-    0x0, 0x11, 0x0, 0x48, 0x2, 0x40, 0x2d, 0x0,
-    0xa0, 0xb, 0x40, 0x18, 0x2, 0x10, 0x6, 0x0,
-    0x84, 0x1, 0x80, 0x21, 0x0, 0x60, 0x8, 0x40,
-    0x18, 0xfe, 0x1f, 0xc5, 0x40, 0x0, 0xa, 0x58,
-    0x0, 0x6, 0x93, 0x0, 0x2, 0x25, 0x80, 0x0,
-    0x69, 0x40, 0x0, 0xa, 0x8f, 0xe1, 0xfc, 0x60,
-    0x8, 0x40, 0x18, 0x2, 0x10, 0x6, 0x0, 0x84,
-    0x1, 0x80, 0x21, 0x0, 0x60, 0x9, 0x40, 0x14,
-    0x2, 0xd0, 0x9, 0x0, 0x48, 0x2, 0x20, 0x0,
-    0x1, 0x6, 0x7, 0x81, 0x80, 0x7e, 0x1f, 0x80,
-
-    /* U+003A ":" */
-    0x0, 0x7f, 0x80, 0x0, 0x38, 0x8e, 0x0, 0x18,
-    0x28, 0x30, 0x6, 0xc, 0x83, 0x1, 0x81, 0x10,
-    0x30, 0x60, 0x22, 0x3, 0x8, 0x4, 0x40, 0x22,
-    0x0, 0x88, 0x2, 0x40, 0x20, 0x80, 0x50, 0x4,
-    0x10, 0x6, 0x1f, 0x83, 0xf0, 0xcc, 0x0, 0x1,
-    0xda, 0x0, 0x0, 0xb, 0x40, 0x0, 0x1, 0x67,
-    0x0, 0x0, 0xcc, 0x3f, 0x7, 0xe1, 0x80, 0x20,
-    0x80, 0x28, 0x4, 0x10, 0x9, 0x0, 0x84, 0x1,
-    0x10, 0x8, 0x80, 0x43, 0x1, 0x10, 0x18, 0x30,
-    0x22, 0x6, 0x3, 0x4, 0x41, 0x80, 0x30, 0x50,
-    0x60, 0x1, 0xce, 0x70, 0x0, 0xf, 0xf8, 0x0,
-
-    /* U+003B ";" */
-    0x0, 0x7c, 0x0, 0x0, 0x82, 0x0, 0x0, 0x81,
-    0x0, 0x1, 0x1, 0x0, 0x1, 0x1, 0x0, 0x0,
-    0x81, 0x0, 0x0, 0x81, 0x0, 0x3, 0x0, 0x80,
-    0x7e, 0x0, 0x7c, 0x80, 0x0, 0x2, 0x80, 0x0,
-    0x1, 0x80, 0x0, 0x1, 0x80, 0x0, 0x1, 0x80,
-    0x0, 0x1, 0x40, 0x0, 0x2, 0x3e, 0x0, 0x7c,
-    0x1, 0x0, 0x80, 0x0, 0x81, 0x0, 0x0, 0x81,
-    0x0, 0x1, 0x1, 0x0, 0x1, 0x1, 0x0, 0x0,
-    0x81, 0x0, 0x0, 0x42, 0x0, 0x0, 0x3c, 0x0,
-
-    /* U+0041 "A" */
-    0x80, 0x0, 0x0, 0xe0, 0x0, 0x1, 0xf0, 0x0,
-    0x1, 0xf8, 0x0, 0x3, 0xfc, 0x0, 0x3, 0xfe,
-    0x0, 0x7, 0xff, 0x0, 0x7, 0xff, 0x80, 0xf,
-    0xff, 0xc0, 0xf, 0xff, 0xe0, 0x1f, 0xff, 0xf0,
-    0x1f, 0xff, 0x0, 0x3f, 0xf0, 0x0, 0x3f, 0x80,
-    0x0, 0x7e, 0x0, 0x0, 0x7c, 0x0, 0x0, 0xf0,
-    0x0, 0x1, 0xe0, 0x0, 0x1, 0x80, 0x0, 0x3,
-    0x0, 0x0, 0x2, 0x0, 0x0, 0x4, 0x0, 0x0,
-    0x0, 0x0, 0x0,
-
-    /* U+0042 "B" */
-    0x0, 0x0, 0x2, 0x0, 0x0, 0x18, 0x0, 0x0,
-    0xf0, 0x0, 0xf, 0xc0, 0x0, 0x7f, 0x80, 0x3,
-    0xfe, 0x0, 0x1f, 0xfc, 0x0, 0xff, 0xf0, 0x7,
-    0xff, 0xe0, 0x3f, 0xff, 0x81, 0xff, 0xff, 0x0,
-    0x7f, 0xfc, 0x0, 0x1f, 0xf8, 0x0, 0xf, 0xe0,
-    0x0, 0xf, 0xc0, 0x0, 0x1f, 0x0, 0x0, 0x1e,
-    0x0, 0x0, 0x3c, 0x0, 0x0, 0x30, 0x0, 0x0,
-    0x60, 0x0, 0x0, 0x80, 0x0, 0x1, 0x0, 0x0,
-    0x0, 0x0, 0x0,
-
-    /* U+0043 "C" */
-    0x0, 0x0, 0x0, 0x0, 0x40, 0x0, 0x0, 0x80,
-    0x0, 0x3, 0x0, 0x0, 0x6, 0x0, 0x0, 0x1e,
-    0x0, 0x0, 0x3c, 0x0, 0x0, 0x7c, 0x0, 0x1,
-    0xf8, 0x0, 0x3, 0xf8, 0x0, 0xf, 0xfc, 0x0,
-    0x1f, 0xff, 0x0, 0x7f, 0xff, 0xc0, 0xff, 0xfe,
-    0x3, 0xff, 0xf0, 0x7, 0xff, 0x80, 0x1f, 0xfc,
-    0x0, 0x3f, 0xe0, 0x0, 0xff, 0x0, 0x1, 0xf0,
-    0x0, 0x7, 0xc0, 0x0, 0xc, 0x0, 0x0, 0x20,
-    0x0, 0x0, 0x0,
-
-    /* U+0044 "D" */
-    0x0, 0x0, 0x0, 0x0, 0x10, 0x0, 0x0, 0x20,
-    0x0, 0x0, 0x60, 0x0, 0x0, 0xc0, 0x0, 0x3,
-    0xc0, 0x0, 0x7, 0x80, 0x0, 0x1f, 0x80, 0x0,
-    0x3f, 0x0, 0x0, 0xfe, 0x0, 0x7, 0xfe, 0x0,
-    0x7f, 0xfc, 0x7, 0xff, 0xfc, 0x3, 0xff, 0xf8,
-    0x1, 0xff, 0xf8, 0x0, 0xff, 0xf0, 0x0, 0x7f,
-    0xf0, 0x0, 0x3f, 0xe0, 0x0, 0x1f, 0xe0, 0x0,
-    0xf, 0xc0, 0x0, 0x3, 0xc0, 0x0, 0x1, 0x80,
-    0x0, 0x0, 0x80,
-
-    /* U+0045 "E" */
-    0xe0, 0x0, 0xf, 0xc0, 0x0, 0x7f, 0x80, 0x7,
-    0xff, 0x0, 0x7f, 0xe0, 0x3, 0xf8, 0x0, 0x3f,
-    0x0, 0x3, 0xc0, 0x0, 0x1c, 0x70, 0x1, 0x8f,
-    0x80, 0x18, 0xfe, 0x1, 0xf, 0xf0, 0x0, 0x7f,
-    0x80, 0x3, 0xfc, 0x0, 0x3f, 0xf0, 0x1, 0xfc,
-    0x0, 0xf, 0x0, 0x0, 0x70, 0x0, 0x2, 0x0,
-    0x0, 0x20,
-
-    /* U+0046 "F" */
-    0x0, 0x0, 0x70, 0x0, 0x3f, 0x0, 0x1f, 0xe0,
-    0xf, 0xfe, 0x0, 0x7f, 0xe0, 0x1, 0xfc, 0x0,
-    0xf, 0xc0, 0x0, 0x7c, 0x0, 0xe3, 0x80, 0x1f,
-    0x18, 0x7, 0xf1, 0x80, 0xff, 0x10, 0x1f, 0xe0,
-    0x3, 0xfc, 0x0, 0xff, 0xc0, 0x3, 0xf8, 0x0,
-    0xf, 0x0, 0x0, 0xe0, 0x0, 0x4, 0x0, 0x0,
-    0x40, 0x0,
-
-    /* U+0047 "G" */
-    0x0, 0x2, 0x0, 0x0, 0x20, 0x0, 0x7, 0x0,
-    0x0, 0xf0, 0x0, 0x1f, 0xc0, 0x3, 0xff, 0x0,
-    0x3f, 0xc0, 0x7, 0xf8, 0x10, 0xff, 0x1, 0x8f,
-    0xe0, 0x18, 0xf8, 0x1, 0xc7, 0x0, 0x3e, 0x0,
-    0x3, 0xf0, 0x0, 0x3f, 0x80, 0x7, 0xfe, 0x0,
-    0x7f, 0xf0, 0x7, 0xf8, 0x0, 0xfc, 0x0, 0xe,
-    0x0, 0x0,
-
-    /* U+0048 "H" */
-    0x4, 0x0, 0x0, 0x40, 0x0, 0xe, 0x0, 0x0,
-    0xf0, 0x0, 0x3f, 0x80, 0xf, 0xfc, 0x0, 0x3f,
-    0xc0, 0x1, 0xfe, 0x0, 0xf, 0xf1, 0x0, 0x7f,
-    0x18, 0x1, 0xf1, 0x80, 0xe, 0x38, 0x0, 0x7,
-    0xc0, 0x0, 0xfc, 0x0, 0x1f, 0xc0, 0x7, 0xfe,
-    0x0, 0xff, 0xe0, 0x1, 0xfe, 0x0, 0x3, 0xf0,
-    0x0, 0x7,
-
-    /* U+0049 "I" */
-    0x0, 0x0, 0x0, 0x0, 0x2, 0x0, 0x0, 0x1,
-    0xc0, 0x0, 0x0, 0x70, 0x0, 0x0, 0x2e, 0x0,
-    0x0, 0xf, 0xc0, 0x6, 0x87, 0xf8, 0x9, 0xfb,
-    0x75, 0xbe, 0x3f, 0xfb, 0xff, 0xb, 0xff, 0xff,
-    0x1, 0xff, 0xff, 0xe0, 0x2f, 0xff, 0xf0, 0x7,
-    0xf7, 0x78, 0x1, 0xfd, 0xf6, 0x0, 0xbf, 0xff,
-    0x80, 0x3f, 0x7b, 0xf0, 0x1f, 0xef, 0x5c, 0x1f,
-    0xff, 0xef, 0xc7, 0xef, 0xd6, 0xfa, 0x81, 0x7e,
-    0x2, 0x0, 0x3b, 0x0, 0x0, 0x7, 0x80, 0x0,
-    0x1, 0xe0, 0x0, 0x0, 0x70, 0x0, 0x0, 0x8,
-    0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+004A "J" */
-    0x0, 0x0, 0x0, 0x0, 0x40, 0x8, 0x0, 0x18,
-    0x6, 0x0, 0x7, 0x5, 0x80, 0x1, 0xf1, 0xe0,
-    0x0, 0x7f, 0xf8, 0x0, 0x1f, 0xfc, 0x0, 0x3,
-    0xff, 0x80, 0x1, 0x7f, 0xe0, 0x0, 0x7f, 0xf4,
-    0x0, 0x7f, 0xfe, 0x80, 0xfa, 0xff, 0x7c, 0x3f,
-    0xf7, 0xff, 0x9e, 0x7f, 0xfd, 0xc1, 0xeb, 0xf6,
-    0xc0, 0xf, 0x7f, 0xc0, 0x1, 0xbf, 0xc0, 0x0,
-    0x5f, 0x58, 0x0, 0x1b, 0xfe, 0x0, 0x3, 0xff,
-    0x0, 0x1, 0xfd, 0xe0, 0x0, 0x68, 0xd8, 0x0,
-    0x1c, 0x1e, 0x0, 0x6, 0x1, 0x80, 0x1, 0x0,
-    0x20, 0x0,
-
-    /* U+004B "K" */
-    0x0, 0x4, 0x0, 0x0, 0x20, 0xc0, 0x0, 0x7,
-    0x28, 0xc0, 0x0, 0xba, 0xe8, 0x0, 0xc, 0x47,
-    0x0, 0x62, 0xd5, 0xa3, 0x7, 0x9e, 0xf3, 0xc0,
-    0x42, 0x2, 0x10, 0x7, 0xc0, 0x7c, 0x0, 0xb0,
-    0x3, 0x80, 0x32, 0x0, 0x58, 0x39, 0x80, 0x4,
-    0xe7, 0xf0, 0x0, 0xfc, 0x1f, 0x0, 0x3c, 0x1,
-    0x60, 0x5, 0x0, 0x3e, 0x3, 0xe0, 0xe, 0x40,
-    0x4a, 0x3, 0xcf, 0x79, 0xe0, 0xc5, 0xab, 0x46,
-    0x0, 0xa2, 0x38, 0x0, 0x17, 0x5d, 0x0, 0x3,
-    0x96, 0x60, 0x0, 0x42, 0x86, 0x0, 0x0, 0x30,
-    0x40, 0x0, 0x4, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+004C "L" */
-    0x0, 0x8, 0x0, 0x0, 0x18, 0x0, 0x0, 0x18,
-    0x0, 0x0, 0x24, 0x0, 0x0, 0x24, 0x0, 0x0,
-    0x42, 0x0, 0x0, 0x42, 0x0, 0x0, 0xbe, 0x0,
-    0x0, 0xc3, 0x0, 0x3, 0x80, 0xc0, 0xf, 0x3c,
-    0xb0, 0x79, 0x66, 0x4c, 0xe1, 0x42, 0x43, 0x61,
-    0x42, 0x42, 0x19, 0x66, 0x5c, 0x6, 0xbc, 0xe0,
-    0x1, 0xc3, 0x0, 0x0, 0xbe, 0x0, 0x0, 0x42,
-    0x0, 0x0, 0x42, 0x0, 0x0, 0x24, 0x0, 0x0,
-    0x24, 0x0, 0x0, 0x18, 0x0, 0x0, 0x18, 0x0,
-    0x0, 0x18, 0x0,
-
-    /* U+004D "M" */
-    0x0, 0x8, 0x0, 0x0, 0x4, 0x0, 0x0, 0x5,
-    0x0, 0x0, 0x2, 0x80, 0x0, 0xc2, 0x21, 0x80,
-    0x7d, 0xf7, 0xc0, 0x22, 0x8f, 0x20, 0x16, 0x7c,
-    0xa0, 0x6, 0xc1, 0xb0, 0x2, 0xc0, 0x78, 0x3,
-    0x40, 0x16, 0x7, 0xc0, 0x7, 0x8e, 0xa0, 0x3,
-    0x33, 0x50, 0x1, 0x98, 0xe8, 0x0, 0xf0, 0x1c,
-    0x0, 0x60, 0x5, 0x0, 0x50, 0x3, 0xc0, 0x78,
-    0x1, 0xf0, 0x7c, 0x1, 0x37, 0xd9, 0x0, 0x9e,
-    0x3c, 0x80, 0x71, 0xf1, 0xc0, 0x0, 0xd0, 0x0,
-    0x0, 0x28, 0x0, 0x0, 0x18, 0x0, 0x0, 0x4,
-    0x0, 0x0,
-
-    /* U+004E "N" */
-    0x0, 0x8, 0x0, 0x0, 0x4, 0x0, 0x0, 0x2,
-    0x0, 0x0, 0x1, 0x0, 0x0, 0x0, 0x80, 0x0,
-    0x10, 0x42, 0x0, 0xe, 0x57, 0x0, 0x3, 0xe5,
-    0x1, 0x0, 0x80, 0x87, 0xc0, 0x40, 0x7e, 0x1f,
-    0xc0, 0xc, 0x0, 0xc0, 0x8, 0x0, 0x10, 0x4,
-    0x0, 0x8, 0x1, 0x0, 0xc, 0x3, 0xe0, 0x19,
-    0x1, 0x0, 0x0, 0xb3, 0x80, 0x0, 0x76, 0x60,
-    0x0, 0x73, 0x18, 0x0, 0x31, 0x84, 0x0, 0x10,
-    0x43, 0x0, 0x18, 0x20, 0xc0, 0x8, 0x0, 0x20,
-    0x4, 0x0, 0x0,
-
-    /* U+004F "O" */
-    0x0, 0x0, 0x0, 0x40, 0x0, 0x60, 0x0, 0x28,
-    0x0, 0x14, 0x0, 0x12, 0x0, 0x8, 0x80, 0x4,
-    0x40, 0x4, 0x20, 0x2, 0x8, 0x1, 0x4, 0x1,
-    0x2, 0x0, 0x80, 0x80, 0x40, 0x40, 0x40, 0x20,
-    0x20, 0x8, 0x10, 0x4, 0x10, 0x2, 0x8, 0x0,
-    0x84, 0x0, 0x44, 0x0, 0x22, 0x3f, 0x9, 0x60,
-    0x65, 0x40, 0xf, 0xc0, 0x1, 0xc0, 0x0, 0x40,
-
-    /* U+0050 "P" */
-    0xc0, 0x0, 0x50, 0x0, 0x36, 0x0, 0x19, 0x60,
-    0xe, 0x2c, 0xc, 0x88, 0xfc, 0x42, 0x0, 0x10,
-    0x40, 0x4, 0x10, 0x2, 0x4, 0x0, 0x80, 0x80,
-    0x20, 0x20, 0x10, 0x8, 0x4, 0x1, 0x1, 0x0,
-    0x40, 0x80, 0x10, 0x20, 0x2, 0x8, 0x0, 0x84,
-    0x0, 0x21, 0x0, 0x4, 0x40, 0x1, 0x20, 0x0,
-    0x48, 0x0, 0xa, 0x0, 0x3, 0x0, 0x0, 0xc0,
-    0x0, 0x10, 0x0,
-
-    /* U+0051 "Q" */
-    0x0, 0x0, 0x1, 0x80, 0x0, 0x7, 0x80, 0x0,
-    0xe, 0xc0, 0x0, 0x38, 0x40, 0x0, 0xe0, 0x40,
-    0x3, 0x80, 0x20, 0xe, 0x0, 0x20, 0x1c, 0x0,
-    0x10, 0x70, 0x0, 0x8, 0x38, 0x0, 0x4, 0x3,
-    0x80, 0x2, 0x0, 0x70, 0x1, 0x0, 0x7, 0x0,
-    0x40, 0x0, 0x70, 0x20, 0x0, 0x7, 0x18, 0x0,
-    0x0, 0x74, 0x0, 0x0, 0x7, 0x0, 0x0, 0x0,
-    0xc0,
-
-    /* U+0052 "R" */
-    0xc0, 0x0, 0x0, 0x3c, 0x0, 0x0, 0x1b, 0x80,
-    0x0, 0x4, 0x38, 0x0, 0x1, 0x3, 0x80, 0x0,
-    0x80, 0x38, 0x0, 0x20, 0x3, 0x80, 0x10, 0x0,
-    0x70, 0x8, 0x0, 0x7, 0x4, 0x0, 0x3, 0x82,
-    0x0, 0xe, 0x1, 0x0, 0x1c, 0x1, 0x0, 0x70,
-    0x0, 0x81, 0xc0, 0x0, 0x87, 0x0, 0x0, 0x5c,
-    0x0, 0x0, 0x78, 0x0, 0x0, 0x60, 0x0, 0x0,
-    0x0,
-
-    /* U+0053 "S" */
-    0x0, 0x0, 0x0, 0xc0, 0x0, 0x0, 0x78, 0x0,
-    0x0, 0x4e, 0x0, 0x0, 0x23, 0x80, 0x0, 0x20,
-    0xe0, 0x0, 0x10, 0x38, 0x0, 0x10, 0xe, 0x0,
-    0x18, 0x1, 0x80, 0x8, 0x0, 0x60, 0xc, 0x0,
-    0x18, 0x4, 0x0, 0x6, 0x6, 0x0, 0x7f, 0x2,
-    0x1, 0xc0, 0x2, 0x3, 0x0, 0x1, 0x6, 0x0,
-    0x1, 0xc, 0x0, 0x0, 0x88, 0x0, 0x0, 0x98,
-    0x0, 0x0, 0x50, 0x0, 0x0, 0x50, 0x0, 0x0,
-    0x30, 0x0, 0x0, 0x30, 0x0, 0x0, 0x10, 0x0,
-    0x0, 0x0, 0x0,
-
-    /* U+0054 "T" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x0, 0x0,
-    0x1e, 0x0, 0x0, 0x62, 0x0, 0x1, 0x84, 0x0,
-    0x6, 0x4, 0x0, 0x18, 0x8, 0x0, 0x60, 0x8,
-    0x1, 0x80, 0x18, 0x6, 0x0, 0x10, 0x18, 0x0,
-    0x30, 0x60, 0x0, 0x20, 0x7e, 0x0, 0x60, 0x1,
-    0x80, 0x40, 0x0, 0xc0, 0xc0, 0x0, 0x20, 0x80,
-    0x0, 0x31, 0x80, 0x0, 0x11, 0x0, 0x0, 0x19,
-    0x0, 0x0, 0xa, 0x0, 0x0, 0xa, 0x0, 0x0,
-    0xc, 0x0, 0x0, 0xc, 0x0, 0x0, 0x8, 0x0,
-    0x0, 0x0, 0x0,
-
-    /* U+0055 "U" */
-    0x0, 0x0, 0x0, 0x0, 0x10, 0x0, 0x0, 0x30,
-    0x0, 0x0, 0x30, 0x0, 0x0, 0x50, 0x0, 0x0,
-    0x50, 0x0, 0x0, 0x98, 0x0, 0x0, 0x88, 0x0,
-    0x1, 0xc, 0x0, 0x1, 0x6, 0x0, 0x2, 0x3,
-    0x0, 0x2, 0x1, 0x80, 0x6, 0x0, 0x7c, 0x4,
-    0x0, 0x6, 0xc, 0x0, 0x38, 0x8, 0x0, 0x60,
-    0x8, 0x3, 0x80, 0x10, 0xe, 0x0, 0x10, 0x38,
-    0x0, 0x20, 0xe0, 0x0, 0x23, 0x80, 0x0, 0x4e,
-    0x0, 0x0, 0x78, 0x0, 0x0, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0,
-
-    /* U+0056 "V" */
-    0x0, 0x0, 0x0, 0x0, 0x8, 0x0, 0x0, 0xc,
-    0x0, 0x0, 0xc, 0x0, 0x0, 0xa, 0x0, 0x0,
-    0xa, 0x0, 0x0, 0x19, 0x0, 0x0, 0x11, 0x0,
-    0x0, 0x30, 0x80, 0x0, 0x60, 0x80, 0x0, 0xc0,
-    0xc0, 0x3, 0x80, 0x40, 0x7e, 0x0, 0x60, 0x60,
-    0x0, 0x20, 0x18, 0x0, 0x30, 0x6, 0x0, 0x10,
-    0x1, 0x80, 0x18, 0x0, 0x60, 0x8, 0x0, 0x18,
-    0x8, 0x0, 0x6, 0x4, 0x0, 0x1, 0x84, 0x0,
-    0x0, 0x62, 0x0, 0x0, 0x1a, 0x0, 0x0, 0x7,
-    0x0, 0x0, 0x0,
-
-    /* U+0057 "W" */
-    0x0, 0x0, 0x2, 0x0, 0xe, 0x0, 0x24, 0x0,
-    0x4c, 0x1, 0x8, 0x2, 0x18, 0x8, 0x10, 0x10,
-    0x30, 0x20, 0x20, 0x80, 0x61, 0x7e, 0x47, 0x3,
-    0xc8, 0x0, 0xc1, 0x20, 0x4, 0x20, 0x8, 0x40,
-    0x10, 0x80, 0x21, 0x0, 0x43, 0x0, 0x82, 0x2,
-    0x4, 0x4, 0x8, 0x8, 0x10, 0x10, 0x30, 0x2f,
-    0x60, 0x61, 0xc0, 0x0, 0x0,
-
-    /* U+0058 "X" */
-    0x0, 0x0, 0x30, 0x60, 0x5f, 0xc0, 0x81, 0x81,
-    0x2, 0x2, 0x4, 0x4, 0x8, 0x4, 0x30, 0x8,
-    0x60, 0x10, 0x80, 0x21, 0x0, 0x42, 0x0, 0x84,
-    0x0, 0x90, 0x10, 0x1, 0xb8, 0x1e, 0x2f, 0xc8,
-    0x40, 0x30, 0x40, 0x40, 0x81, 0x81, 0x2, 0x1,
-    0xc, 0x2, 0x10, 0x2, 0x60, 0x4, 0x80, 0x7,
-    0x0, 0x4, 0x0, 0x0, 0x0,
-
-    /* U+0059 "Y" */
-    0x0, 0x4, 0x0, 0x0, 0x1, 0xc0, 0x0, 0x0,
-    0x2c, 0x3, 0xf8, 0x8, 0xc0, 0x41, 0xf1, 0xc,
-    0x8, 0x2, 0x40, 0xc2, 0x0, 0x50, 0xc, 0x80,
-    0x14, 0x3, 0x20, 0x9, 0x3, 0x10, 0x7c, 0x43,
-    0xf, 0xe0, 0x23, 0x0, 0x0, 0xb, 0x0, 0x0,
-    0x7, 0x0, 0x0, 0x1, 0x0, 0x0,
-
-    /* U+005A "Z" */
-    0x0, 0x8, 0x0, 0x0, 0xe, 0x0, 0x0, 0xd,
-    0x0, 0x0, 0xc, 0x40, 0x3f, 0xc, 0x23, 0xf0,
-    0x8c, 0x9, 0x0, 0x4c, 0x2, 0x80, 0x13, 0x0,
-    0xa0, 0x4, 0x30, 0x24, 0x1, 0x3, 0x8, 0xf8,
-    0x20, 0x31, 0x1, 0xfc, 0x3, 0x40, 0x0, 0x0,
-    0x38, 0x0, 0x0, 0x2, 0x0, 0x0,
-
     /* U+0061 "a" */
     0x0, 0x0, 0x1, 0x0, 0x1, 0x80, 0x1, 0x80,
     0x3, 0x80, 0x3, 0xc0, 0x3, 0xc0, 0x7, 0xc0,
@@ -512,270 +36,7 @@ static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] = {
     0x1f, 0xf8, 0x1f, 0xf8, 0x1f, 0xf0, 0xf, 0xf0,
     0xf, 0xf0, 0xf, 0xe0, 0x7, 0xe0, 0x7, 0xe0,
     0x7, 0xc0, 0x3, 0xc0, 0x3, 0xc0, 0x3, 0x80,
-    0x1, 0x80, 0x1, 0x80, 0x1, 0x0, 0x0, 0x0,
-
-    /* U+0063 "c" */
-    0x0, 0x0, 0x2, 0x0, 0x0, 0x1e, 0x0, 0x0,
-    0xfc, 0x0, 0x7, 0xf8, 0x0, 0x1f, 0xf8, 0x0,
-    0xff, 0xf0, 0x7, 0xff, 0xf0, 0x3f, 0xff, 0xf0,
-    0x7f, 0xff, 0xf0, 0xf, 0xff, 0xf0, 0x1, 0xff,
-    0xf0, 0x0, 0x3f, 0xf8, 0x0, 0x7, 0xf8, 0x0,
-    0x0, 0xfc, 0x0, 0x0, 0x3c, 0x0, 0x0, 0x6,
-    0x0, 0x0, 0x0,
-
-    /* U+0064 "d" */
-    0x40, 0x0, 0x0, 0x78, 0x0, 0x0, 0x3f, 0x0,
-    0x0, 0x1f, 0xe0, 0x0, 0x1f, 0xf8, 0x0, 0xf,
-    0xff, 0x0, 0xf, 0xff, 0xe0, 0xf, 0xff, 0xfc,
-    0xf, 0xff, 0xfe, 0xf, 0xff, 0xf0, 0xf, 0xff,
-    0x80, 0x1f, 0xfc, 0x0, 0x1f, 0xe0, 0x0, 0x3f,
-    0x0, 0x0, 0x3c, 0x0, 0x0, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x0,
-
-    /* U+0065 "e" */
-    0x0, 0x10, 0x0, 0x0, 0x8, 0x0, 0x0, 0x4,
-    0x0, 0x0, 0x2, 0x0, 0x0, 0x1, 0x0, 0x0,
-    0x0, 0xc2, 0x0, 0xc, 0xe2, 0x0, 0x1, 0xfe,
-    0x0, 0x0, 0xff, 0x3, 0x3f, 0xff, 0xfe, 0x1,
-    0xff, 0xf8, 0x0, 0x3f, 0xf8, 0x0, 0x1f, 0xfe,
-    0x0, 0x1f, 0xff, 0x80, 0x33, 0xfc, 0x20, 0x21,
-    0xfe, 0x0, 0x0, 0xcc, 0x80, 0x0, 0x44, 0x40,
-    0x0, 0x42, 0x10, 0x0, 0x21, 0x4, 0x0, 0x20,
-    0x1, 0x0, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0066 "f" */
-    0x0, 0x10, 0x0, 0x0, 0x18, 0x0, 0x0, 0x18,
-    0x0, 0x0, 0x3c, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3c, 0x0, 0x0, 0xff, 0x0,
-    0x1, 0xff, 0x80, 0x3, 0xff, 0x80, 0x1b, 0xff,
-    0xd8, 0x7b, 0xff, 0xde, 0x7b, 0xff, 0xde, 0x1b,
-    0xff, 0xd8, 0x3, 0xff, 0x80, 0x1, 0xff, 0x80,
-    0x0, 0xff, 0x0, 0x0, 0x3e, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3c, 0x0, 0x0, 0x3c, 0x0, 0x0,
-    0x18, 0x0, 0x0, 0x18, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0067 "g" */
-    0x0, 0x10, 0x0, 0x0, 0x18, 0x0, 0x0, 0x18,
-    0x0, 0x8, 0x3c, 0x0, 0xe, 0x0, 0x70, 0xf,
-    0x0, 0xf0, 0x4, 0x3c, 0x60, 0x4, 0xff, 0x20,
-    0x1, 0xff, 0x80, 0x3, 0xff, 0x80, 0x1b, 0xff,
-    0xd8, 0x7b, 0xff, 0xde, 0x7b, 0xff, 0xde, 0x1b,
-    0xff, 0xd8, 0x3, 0xff, 0x80, 0x1, 0xff, 0x80,
-    0x4, 0xff, 0x20, 0x6, 0x3e, 0x60, 0xf, 0x0,
-    0xf0, 0xc, 0x3c, 0x30, 0x0, 0x3c, 0x0, 0x0,
-    0x18, 0x0, 0x0, 0x18, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0068 "h" */
-    0x0, 0x8, 0x0, 0x0, 0x8, 0x0, 0x0, 0x8,
-    0x0, 0x0, 0x1c, 0x0, 0x0, 0x1c, 0x0, 0x0,
-    0x3e, 0x0, 0x0, 0x3e, 0x0, 0x0, 0x3e, 0x0,
-    0x0, 0xc1, 0x0, 0x1, 0x80, 0x80, 0x7, 0x1c,
-    0x70, 0x1f, 0x3e, 0x7c, 0xff, 0x3e, 0x7f, 0x1f,
-    0x3e, 0x7c, 0x7, 0x1c, 0x70, 0x1, 0x0, 0x80,
-    0x0, 0x81, 0x0, 0x0, 0x7e, 0x0, 0x0, 0x3e,
-    0x0, 0x0, 0x3e, 0x0, 0x0, 0x1c, 0x0, 0x0,
-    0x1c, 0x0, 0x0, 0x8, 0x0, 0x0, 0x8, 0x0,
-
-    /* U+0069 "i" */
-    0x80, 0x1, 0x38, 0x3, 0x9f, 0x7, 0xcf, 0xff,
-    0xc3, 0x81, 0xe1, 0x80, 0x60, 0x47, 0x10, 0x27,
-    0xc8, 0x13, 0xe8, 0x9, 0xf2, 0x4, 0x71, 0x6,
-    0x1, 0x83, 0x81, 0xe3, 0xff, 0xf1, 0xf0, 0xfc,
-    0xe0, 0xe, 0xc0, 0x1, 0x0,
-
-    /* U+006A "j" */
-    0x0, 0x10, 0x0, 0x0, 0xc, 0x0, 0x0, 0x6,
-    0x0, 0x0, 0x3, 0x0, 0x0, 0x3, 0xa0, 0x0,
-    0x1, 0xd0, 0x0, 0x0, 0xf0, 0x0, 0x0, 0xfa,
-    0x0, 0x0, 0x7f, 0x0, 0x8, 0xaf, 0x22, 0x3b,
-    0x6f, 0xee, 0xdf, 0xef, 0xff, 0xf1, 0xff, 0xff,
-    0xc1, 0xff, 0xff, 0xf0, 0x7, 0xff, 0x0, 0x1e,
-    0xfe, 0xf0, 0x1, 0xfe, 0xc0, 0x1, 0x7f, 0xf0,
-    0x1, 0x76, 0xb4, 0x0, 0x5b, 0xfc, 0x0, 0x5d,
-    0x7f, 0x0, 0x1c, 0xab, 0x80, 0x16, 0x97, 0x40,
-    0x15, 0x1, 0x60, 0xc, 0x0, 0x28, 0x2, 0x0,
-    0x8, 0x0,
-
-    /* U+006B "k" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x80, 0x0, 0x0,
-    0x38, 0x0, 0x0, 0xb, 0x80, 0x0, 0x1, 0x70,
-    0x0, 0x0, 0x1e, 0x0, 0x0, 0x3, 0xc0, 0x0,
-    0x1, 0x78, 0x0, 0x0, 0xad, 0x80, 0x0, 0xb,
-    0xd4, 0xc0, 0xed, 0xff, 0xa7, 0x3b, 0x57, 0xff,
-    0xc0, 0xfd, 0xef, 0xe0, 0x5, 0xff, 0xd8, 0x1,
-    0x7f, 0xfc, 0x0, 0x19, 0xfe, 0xe0, 0x0, 0xff,
-    0xf0, 0x0, 0x2e, 0xf9, 0x0, 0x2, 0xff, 0xc0,
-    0x0, 0xbd, 0x78, 0x0, 0xe, 0xab, 0x0, 0x3,
-    0x52, 0xe0, 0x0, 0xb0, 0x6, 0x0, 0x28, 0x0,
-    0xa0, 0xa, 0x0, 0x8, 0x0, 0x40, 0x0, 0x0,
-
-    /* U+006C "l" */
-    0x0, 0x0, 0x0, 0x0, 0x2, 0x0, 0x0, 0x0,
-    0x80, 0x0, 0x0, 0x20, 0x0, 0x0, 0x14, 0x0,
-    0x0, 0x3, 0x0, 0x0, 0x0, 0xc0, 0x0, 0x0,
-    0x78, 0x0, 0x0, 0x5a, 0x0, 0x4, 0x8c, 0xe0,
-    0x84, 0xff, 0x3f, 0xc0, 0xfe, 0x0, 0xfe, 0x1b,
-    0x80, 0x3a, 0x0, 0xe0, 0xc, 0x0, 0xc, 0x4,
-    0x80, 0x3, 0x1, 0x0, 0x0, 0x40, 0x60, 0x0,
-    0x30, 0x18, 0x0, 0x1c, 0xe7, 0x0, 0x3, 0xe7,
-    0x0, 0x1, 0xe2, 0xe0, 0x0, 0x60, 0x1c, 0x0,
-    0x28, 0x6, 0x0, 0x18, 0x0, 0x40, 0x0, 0x0,
-    0x0, 0x0,
-
-    /* U+006D "m" */
-    0x2, 0x0, 0x10, 0x1, 0xc0, 0xe, 0x0, 0xf8,
-    0x7, 0xc0, 0x7f, 0x3, 0xf8, 0x3f, 0xe1, 0xff,
-    0x1f, 0xfc, 0x80, 0x28, 0x0, 0x3, 0x80, 0x3e,
-    0x1, 0xf0, 0xf, 0x80, 0x7c, 0x3, 0xe0, 0x3f,
-    0x81, 0xfc, 0xf, 0xe0, 0x7f, 0x3, 0xf8, 0x10,
-    0xc0, 0x0, 0x0,
-
-    /* U+006E "n" */
-    0x0, 0x0, 0x86, 0x7, 0xf0, 0x3f, 0x81, 0xfc,
-    0xf, 0xe0, 0x7f, 0x1, 0xf0, 0xf, 0x80, 0x7c,
-    0x3, 0xe0, 0x1f, 0x0, 0x70, 0x40, 0x1, 0x0,
-    0x4f, 0xfe, 0x3f, 0xe1, 0xff, 0x7, 0xf0, 0x3f,
-    0x80, 0xf8, 0x7, 0xc0, 0x1c, 0x0, 0xe0, 0x2,
-    0x0, 0x10, 0x0,
-
-    /* U+006F "o" */
-    0x0, 0x4, 0x0, 0x0, 0x0, 0xc0, 0x0, 0x0,
-    0x1c, 0x1, 0xf0, 0x7, 0xc0, 0x3f, 0xf1, 0xfc,
-    0xf, 0xfe, 0x7f, 0xc3, 0xff, 0x9f, 0xfc, 0xff,
-    0xe7, 0xfc, 0x3f, 0xf1, 0xfc, 0x1f, 0x0, 0x7c,
-    0x0, 0x0, 0x1c, 0x0, 0x0, 0xc, 0x0, 0x0,
-    0x4, 0x0, 0x0,
-
-    /* U+0070 "p" */
-    0x0, 0x8, 0x0, 0x0, 0xc, 0x0, 0x0, 0xe,
-    0x0, 0x0, 0xf, 0x80, 0x3e, 0xf, 0xe3, 0xff,
-    0xf, 0xf9, 0xff, 0xcf, 0xfe, 0x7f, 0xf0, 0xff,
-    0x9f, 0xfc, 0xf, 0xe3, 0xff, 0x0, 0xf8, 0x3,
-    0xe0, 0xe, 0x0, 0x0, 0x0, 0xc0, 0x0, 0x0,
-    0x10, 0x0, 0x0,
-
-    /* U+0071 "q" */
-    0x0, 0x0, 0x0, 0x0, 0xc, 0x0, 0x0, 0x7,
-    0x0, 0x0, 0x3, 0x80, 0x0, 0x1, 0xc0, 0x0,
-    0x0, 0xe0, 0x0, 0x0, 0xa8, 0x0, 0xa4, 0xfc,
-    0x6a, 0x3f, 0xdf, 0xfe, 0x17, 0xff, 0xed, 0x6,
-    0xff, 0xff, 0x1, 0xff, 0xff, 0x0, 0x3f, 0xfe,
-    0x0, 0x3f, 0xff, 0x80, 0x1f, 0xfe, 0xc0, 0x1f,
-    0xff, 0xc0, 0x1b, 0xfe, 0xfc, 0x1b, 0xdf, 0xbb,
-    0x3b, 0x9f, 0xaf, 0x5f, 0xd, 0xc3, 0xe0, 0x1,
-    0xa0, 0x0, 0x0, 0xe0, 0x0, 0x0, 0x50, 0x0,
-    0x0, 0x28, 0x0, 0x0, 0x18, 0x0, 0x0, 0x0,
-    0x0, 0x0,
-
-    /* U+0072 "r" */
-    0x0, 0x0, 0x0, 0x0, 0x4, 0x0, 0x0, 0x3,
-    0x4, 0x0, 0x11, 0x84, 0x0, 0xc, 0xe6, 0x0,
-    0x7, 0xff, 0x0, 0x2, 0xcd, 0x80, 0x3f, 0x81,
-    0xfc, 0xd, 0x80, 0x6c, 0x3, 0x0, 0xc, 0x1,
-    0xc0, 0xe, 0x1, 0xc0, 0x7, 0x8f, 0x80, 0x0,
-    0x78, 0x78, 0x0, 0xf0, 0x1c, 0x0, 0xe0, 0xc,
-    0x0, 0x30, 0xd, 0x80, 0x6c, 0xf, 0xe0, 0x7e,
-    0x0, 0x2c, 0xb8, 0x80, 0x1f, 0xec, 0x0, 0xf,
-    0xfe, 0x0, 0x4, 0xf3, 0x0, 0x4, 0x30, 0x80,
-    0x0, 0x18, 0x0, 0x0, 0x8, 0x0, 0x0, 0x0,
-    0x0, 0x0,
-
-    /* U+0073 "s" */
-    0x0, 0x0, 0x0, 0x0, 0x8, 0x0, 0x0, 0x84,
-    0x0, 0x0, 0x22, 0x8, 0x0, 0x11, 0x8, 0x0,
-    0x4, 0xc4, 0x0, 0x82, 0x26, 0x0, 0x21, 0x96,
-    0x8, 0xe, 0x7d, 0x38, 0x1, 0xe0, 0xe0, 0x0,
-    0x40, 0x20, 0x0, 0x70, 0x18, 0x7, 0xd8, 0xf,
-    0xf0, 0x4, 0x4, 0x0, 0x7, 0x5, 0x0, 0xc,
-    0xbb, 0x40, 0x8, 0xbf, 0x10, 0x18, 0x55, 0x84,
-    0x0, 0x32, 0x61, 0x0, 0x11, 0x10, 0x0, 0x10,
-    0x88, 0x0, 0x10, 0x42, 0x0, 0x0, 0x21, 0x0,
-    0x0, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0074 "t" */
-    0x0, 0x0, 0x0, 0x0, 0x40, 0x0, 0x4, 0x80,
-    0x0, 0x9, 0x10, 0x0, 0x12, 0x40, 0x1, 0x57,
-    0xa8, 0x1, 0x7d, 0xa8, 0x31, 0x80, 0xee, 0x1e,
-    0x0, 0xe0, 0xc, 0x1, 0xc1, 0xf0, 0x1, 0xf3,
-    0x40, 0x2, 0x41, 0xc0, 0x6, 0xd, 0xc0, 0x3b,
-    0x81, 0x80, 0x30, 0x6, 0x81, 0xf0, 0x13, 0x3,
-    0x90, 0xc7, 0xff, 0x98, 0x1b, 0xfa, 0x0, 0x56,
-    0xea, 0x0, 0x16, 0x48, 0x0, 0x24, 0x40, 0x0,
-    0x8, 0x0, 0x0, 0x10, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0075 "u" */
-    0x0, 0x8, 0x0, 0x1, 0x14, 0x80, 0x0, 0x4a,
-    0x48, 0x0, 0x37, 0xe8, 0x0, 0xdf, 0xfc, 0x80,
-    0x3f, 0xff, 0x80, 0x9f, 0xff, 0xc0, 0x3f, 0x83,
-    0xfc, 0xf, 0x80, 0xf8, 0x3f, 0x80, 0x3c, 0x7,
-    0x80, 0xf, 0xc3, 0xc0, 0x7, 0x8f, 0xe0, 0x3,
-    0xf8, 0xf0, 0x1, 0xe1, 0xf8, 0x0, 0xf0, 0x1e,
-    0x0, 0xfc, 0x1f, 0x80, 0xf8, 0xf, 0xe0, 0xfe,
-    0x9, 0xff, 0xfc, 0x81, 0xff, 0xfe, 0x0, 0x9f,
-    0xfd, 0x0, 0xb, 0xf6, 0x40, 0x9, 0x29, 0x0,
-    0x0, 0x94, 0x0, 0x0, 0x8, 0x0, 0x0,
-
-    /* U+0076 "v" */
-    0x0, 0x8, 0x0, 0x0, 0x4, 0x0, 0x0, 0xa,
-    0x48, 0x0, 0x27, 0xe8, 0x0, 0x9a, 0xbc, 0x40,
-    0x2c, 0x46, 0xc0, 0x18, 0x68, 0xe0, 0x7a, 0x86,
-    0x5c, 0x18, 0x81, 0x4c, 0x4, 0x40, 0x44, 0x1d,
-    0x80, 0x19, 0xc2, 0x40, 0x6, 0x87, 0x20, 0x2,
-    0x63, 0xb0, 0x1, 0xb8, 0x58, 0x0, 0xa0, 0xe4,
-    0x0, 0x68, 0x13, 0x0, 0x47, 0xc, 0xc0, 0x5c,
-    0x6, 0x50, 0x73, 0x4, 0xcf, 0xa6, 0x40, 0xfa,
-    0xc3, 0x0, 0x4c, 0x46, 0xc0, 0x5, 0xeb, 0x0,
-    0x4, 0x9c, 0x80, 0x0, 0x4a, 0x0, 0x0, 0x4,
-    0x0, 0x0,
-
-    /* U+0077 "w" */
-    0x0, 0x40, 0x0, 0x0, 0x4a, 0x0, 0x2, 0x4a,
-    0x0, 0x2, 0x4a, 0x80, 0x9, 0x2c, 0x88, 0x5,
-    0x2d, 0x10, 0x2, 0xed, 0x20, 0x33, 0x7e, 0x4c,
-    0xd, 0xfd, 0x90, 0x43, 0xe7, 0xe0, 0x39, 0xc3,
-    0x82, 0x7, 0x81, 0xfc, 0x3, 0x81, 0xc0, 0x7f,
-    0x81, 0xfe, 0xd, 0x81, 0xc0, 0xf2, 0xc3, 0xb8,
-    0x7, 0x7f, 0x66, 0x19, 0xbd, 0x90, 0x22, 0xd6,
-    0x88, 0xc, 0xaf, 0x44, 0x11, 0x4d, 0x20, 0x2,
-    0x54, 0x80, 0x2, 0x94, 0x80, 0x0, 0x94, 0x0,
-    0x0, 0x10, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0078 "x" */
-    0x0, 0x0, 0x0, 0x0, 0x52, 0x0, 0x2, 0x52,
-    0x0, 0x2, 0x52, 0x80, 0x9, 0x54, 0x88, 0x4,
-    0xb5, 0x10, 0x2, 0xf5, 0x20, 0x33, 0x7a, 0x4c,
-    0xd, 0xf7, 0xb0, 0x43, 0x65, 0xc0, 0x39, 0xc2,
-    0x86, 0x7, 0x81, 0xf8, 0x7f, 0x81, 0xe0, 0x2,
-    0x81, 0x9e, 0xf, 0x81, 0xe0, 0xf2, 0x43, 0xd8,
-    0x7, 0xb5, 0x66, 0x19, 0xbd, 0x90, 0x22, 0xfa,
-    0x88, 0xc, 0xdd, 0x44, 0x11, 0x55, 0x20, 0x2,
-    0x54, 0x80, 0x2, 0x94, 0x80, 0x0, 0x92, 0x0,
-    0x0, 0x10, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0079 "y" */
-    0x0, 0x0, 0x0, 0x0, 0x2, 0x0, 0x0, 0x1,
-    0x4, 0x0, 0x11, 0x84, 0x0, 0xc, 0xe6, 0x0,
-    0x7, 0xff, 0x0, 0x3, 0xff, 0x80, 0x3f, 0xff,
-    0xfc, 0xf, 0xff, 0xfc, 0x3, 0xff, 0xfc, 0x1,
-    0xff, 0xfe, 0x1, 0xff, 0xff, 0x8f, 0xff, 0xff,
-    0xf8, 0x7f, 0xff, 0xf0, 0x1f, 0xff, 0xe0, 0xf,
-    0xff, 0xf0, 0xf, 0xff, 0xfc, 0xf, 0xff, 0xfe,
-    0x0, 0x3f, 0xf8, 0x80, 0x1f, 0xfc, 0x0, 0xf,
-    0xfe, 0x0, 0x6, 0x73, 0x0, 0x4, 0x30, 0x80,
-    0x0, 0x8, 0x0, 0x0, 0x4, 0x0, 0x0, 0x0,
-    0x0, 0x0,
-
-    /* U+007A "z" */
-    0x0, 0x8, 0x0, 0x1, 0x14, 0x80, 0x0, 0x4a,
-    0x48, 0x0, 0x37, 0xe8, 0x0, 0xdf, 0xfc, 0x80,
-    0x3f, 0xff, 0x80, 0x9f, 0xff, 0xc0, 0x3f, 0xff,
-    0xfc, 0xf, 0xff, 0xf8, 0x3f, 0xff, 0xfc, 0x7,
-    0xff, 0xff, 0xc3, 0xff, 0xff, 0x8f, 0xff, 0xff,
-    0xf8, 0xff, 0xff, 0xe1, 0xff, 0xff, 0xf0, 0x1f,
-    0xff, 0xfc, 0x1f, 0xff, 0xf8, 0xf, 0xff, 0xfe,
-    0x9, 0xff, 0xfc, 0x81, 0xff, 0xfe, 0x0, 0x9f,
-    0xfd, 0x0, 0xb, 0xf6, 0x40, 0x9, 0x29, 0x0,
-    0x0, 0x94, 0x0, 0x0, 0x8, 0x0, 0x0
+    0x1, 0x80, 0x1, 0x80, 0x1, 0x0, 0x0, 0x0
 };
 
 
@@ -786,107 +47,30 @@ static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] = {
 static const lv_font_fmt_txt_glyph_dsc_t glyph_dsc[] = {
     {.bitmap_index = 0, .adv_w = 0, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0} /* id = 0 reserved */,
     {.bitmap_index = 0, .adv_w = 154, .box_w = 1, .box_h = 1, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1, .adv_w = 446, .box_w = 25, .box_h = 26, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 83, .adv_w = 485, .box_w = 30, .box_h = 34, .ofs_x = 0, .ofs_y = 1},
-    {.bitmap_index = 211, .adv_w = 553, .box_w = 25, .box_h = 25, .ofs_x = 5, .ofs_y = 1},
-    {.bitmap_index = 290, .adv_w = 553, .box_w = 26, .box_h = 27, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 378, .adv_w = 446, .box_w = 21, .box_h = 20, .ofs_x = 4, .ofs_y = 3},
-    {.bitmap_index = 431, .adv_w = 398, .box_w = 21, .box_h = 22, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 489, .adv_w = 398, .box_w = 21, .box_h = 22, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 547, .adv_w = 398, .box_w = 21, .box_h = 22, .ofs_x = 2, .ofs_y = 1},
-    {.bitmap_index = 605, .adv_w = 398, .box_w = 21, .box_h = 22, .ofs_x = 2, .ofs_y = 1},
-    {.bitmap_index = 663, .adv_w = 472, .box_w = 27, .box_h = 26, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 751, .adv_w = 472, .box_w = 26, .box_h = 28, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 842, .adv_w = 588, .box_w = 33, .box_h = 33, .ofs_x = 2, .ofs_y = -2},
-    {.bitmap_index = 979, .adv_w = 245, .box_w = 12, .box_h = 12, .ofs_x = 2, .ofs_y = 6},
-    {.bitmap_index = 997, .adv_w = 294, .box_w = 15, .box_h = 15, .ofs_x = 2, .ofs_y = 5},
-    {.bitmap_index = 1026, .adv_w = 446, .box_w = 26, .box_h = 27, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1114, .adv_w = 435, .box_w = 27, .box_h = 26, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1202, .adv_w = 478, .box_w = 24, .box_h = 24, .ofs_x = 3, .ofs_y = 1},
-    {.bitmap_index = 1274, .adv_w = 413, .box_w = 23, .box_h = 23, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1341, .adv_w = 413, .box_w = 23, .box_h = 23, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1408, .adv_w = 413, .box_w = 23, .box_h = 23, .ofs_x = 1, .ofs_y = 1},
-    {.bitmap_index = 1475, .adv_w = 413, .box_w = 23, .box_h = 23, .ofs_x = 1, .ofs_y = 1},
-    {.bitmap_index = 1542, .adv_w = 381, .box_w = 20, .box_h = 20, .ofs_x = 2, .ofs_y = 2},
-    {.bitmap_index = 1592, .adv_w = 381, .box_w = 20, .box_h = 20, .ofs_x = 2, .ofs_y = 2},
-    {.bitmap_index = 1642, .adv_w = 381, .box_w = 20, .box_h = 20, .ofs_x = 2, .ofs_y = 2},
-    {.bitmap_index = 1692, .adv_w = 381, .box_w = 20, .box_h = 20, .ofs_x = 2, .ofs_y = 2},
-    {.bitmap_index = 1742, .adv_w = 446, .box_w = 26, .box_h = 26, .ofs_x = 2, .ofs_y = -1},
-    {.bitmap_index = 1827, .adv_w = 460, .box_w = 26, .box_h = 25, .ofs_x = 1, .ofs_y = 1},
-    {.bitmap_index = 1909, .adv_w = 472, .box_w = 27, .box_h = 26, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1997, .adv_w = 445, .box_w = 24, .box_h = 25, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 2072, .adv_w = 447, .box_w = 25, .box_h = 26, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 2154, .adv_w = 453, .box_w = 25, .box_h = 24, .ofs_x = 2, .ofs_y = 1},
-    {.bitmap_index = 2229, .adv_w = 332, .box_w = 17, .box_h = 26, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 2285, .adv_w = 332, .box_w = 18, .box_h = 26, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 2344, .adv_w = 449, .box_w = 25, .box_h = 18, .ofs_x = 1, .ofs_y = 4},
-    {.bitmap_index = 2401, .adv_w = 449, .box_w = 25, .box_h = 18, .ofs_x = 2, .ofs_y = 4},
-    {.bitmap_index = 2458, .adv_w = 430, .box_w = 24, .box_h = 25, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 2533, .adv_w = 431, .box_w = 24, .box_h = 25, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 2608, .adv_w = 430, .box_w = 24, .box_h = 25, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 2683, .adv_w = 431, .box_w = 24, .box_h = 25, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 2758, .adv_w = 272, .box_w = 15, .box_h = 28, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 2811, .adv_w = 272, .box_w = 15, .box_h = 28, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 2864, .adv_w = 475, .box_w = 26, .box_h = 14, .ofs_x = 1, .ofs_y = 6},
-    {.bitmap_index = 2910, .adv_w = 475, .box_w = 26, .box_h = 14, .ofs_x = 2, .ofs_y = 6},
-    {.bitmap_index = 2956, .adv_w = 315, .box_w = 16, .box_h = 24, .ofs_x = 2, .ofs_y = 1},
-    {.bitmap_index = 3004, .adv_w = 315, .box_w = 16, .box_h = 24, .ofs_x = 2, .ofs_y = 1},
-    {.bitmap_index = 3052, .adv_w = 431, .box_w = 24, .box_h = 17, .ofs_x = 1, .ofs_y = 4},
-    {.bitmap_index = 3103, .adv_w = 431, .box_w = 24, .box_h = 17, .ofs_x = 2, .ofs_y = 4},
-    {.bitmap_index = 3154, .adv_w = 449, .box_w = 25, .box_h = 23, .ofs_x = 2, .ofs_y = 1},
-    {.bitmap_index = 3226, .adv_w = 430, .box_w = 24, .box_h = 24, .ofs_x = 1, .ofs_y = 1},
-    {.bitmap_index = 3298, .adv_w = 430, .box_w = 24, .box_h = 24, .ofs_x = 1, .ofs_y = 1},
-    {.bitmap_index = 3370, .adv_w = 427, .box_w = 24, .box_h = 24, .ofs_x = 1, .ofs_y = 1},
-    {.bitmap_index = 3442, .adv_w = 317, .box_w = 17, .box_h = 17, .ofs_x = 2, .ofs_y = 4},
-    {.bitmap_index = 3479, .adv_w = 471, .box_w = 25, .box_h = 26, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 3561, .adv_w = 468, .box_w = 27, .box_h = 26, .ofs_x = 1, .ofs_y = -1},
-    {.bitmap_index = 3649, .adv_w = 460, .box_w = 26, .box_h = 25, .ofs_x = 1, .ofs_y = 1},
-    {.bitmap_index = 3731, .adv_w = 256, .box_w = 13, .box_h = 26, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 3774, .adv_w = 256, .box_w = 13, .box_h = 26, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 3817, .adv_w = 457, .box_w = 26, .box_h = 13, .ofs_x = 1, .ofs_y = 6},
-    {.bitmap_index = 3860, .adv_w = 457, .box_w = 26, .box_h = 13, .ofs_x = 1, .ofs_y = 6},
-    {.bitmap_index = 3903, .adv_w = 440, .box_w = 25, .box_h = 26, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 3985, .adv_w = 453, .box_w = 25, .box_h = 26, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 4067, .adv_w = 457, .box_w = 25, .box_h = 25, .ofs_x = 2, .ofs_y = 1},
-    {.bitmap_index = 4146, .adv_w = 422, .box_w = 23, .box_h = 25, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 4218, .adv_w = 453, .box_w = 25, .box_h = 25, .ofs_x = 2, .ofs_y = 1},
-    {.bitmap_index = 4297, .adv_w = 453, .box_w = 25, .box_h = 26, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 4379, .adv_w = 453, .box_w = 24, .box_h = 26, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 4457, .adv_w = 453, .box_w = 24, .box_h = 26, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 4535, .adv_w = 453, .box_w = 25, .box_h = 26, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 4617, .adv_w = 453, .box_w = 25, .box_h = 25, .ofs_x = 2, .ofs_y = 1}
+    {.bitmap_index = 1, .adv_w = 315, .box_w = 16, .box_h = 24, .ofs_x = 2, .ofs_y = 1},
+    {.bitmap_index = 49, .adv_w = 315, .box_w = 16, .box_h = 24, .ofs_x = 2, .ofs_y = 1}
 };
 
 /*---------------------
  *  CHARACTER MAPPING
  *--------------------*/
 
-static const uint8_t glyph_id_ofs_list_0[] = {
-    0, 1, 0, 0, 0, 0, 2, 0,
-    3, 4, 0, 0, 0, 0, 5, 0,
-    6, 7, 8, 9, 10, 11, 12, 13,
-    14, 15, 16, 17
+static const uint16_t unicode_list_0[] = {
+    0, 65, 66
 };
 
 /*Collect the unicode lists and glyph_id offsets*/
 static const lv_font_fmt_txt_cmap_t cmaps[] =
 {
     {
-        .range_start = 32, .range_length = 28, .glyph_id_start = 1,
-        .unicode_list = NULL, .glyph_id_ofs_list = glyph_id_ofs_list_0, .list_length = 28, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_FULL
-    },
-    {
-        .range_start = 65, .range_length = 26, .glyph_id_start = 19,
-        .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY
-    },
-    {
-        .range_start = 97, .range_length = 26, .glyph_id_start = 45,
-        .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY
+        .range_start = 32, .range_length = 67, .glyph_id_start = 1,
+        .unicode_list = unicode_list_0, .glyph_id_ofs_list = NULL, .list_length = 3, .type = LV_FONT_FMT_TXT_CMAP_SPARSE_TINY
     }
 };
 
 
 
+
 /*--------------------
  *  ALL CUSTOM DATA
  *--------------------*/
@@ -906,7 +90,7 @@ static lv_font_fmt_txt_dsc_t font_dsc = {
     .cmaps = cmaps,
     .kern_dsc = NULL,
     .kern_scale = 0,
-    .cmap_num = 3,
+    .cmap_num = 1,
     .bpp = 1,
     .kern_classes = 0,
     .bitmap_format = 0,
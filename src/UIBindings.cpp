@@ -0,0 +1,174 @@
+#include "UIBindings.h"
+#include "ScreenUpdates.h"
+
+RoomBinding roomBindings[ROOM_COUNT];
+UvBinding uvBinding;
+WeatherBinding weatherBinding;
+InsideAQBinding insideAQBinding;
+SolarBinding solarBinding;
+StatusBinding statusBinding;
+
+// Text colour subjects, re-applied by refreshBoundColors() after something has
+// written over the label colours directly (benchmark_theme_switch())
+static const int MAX_TEXT_COLOR_SUBJECTS = 16;
+static lv_subject_t* textColorSubjects[MAX_TEXT_COLOR_SUBJECTS];
+static int textColorSubjectCount = 0;
+
+static void textColorObserver(lv_observer_t* observer, lv_subject_t* subject) {
+    lv_obj_set_style_text_color(lv_observer_get_target_obj(observer), lv_subject_get_color(subject), LV_PART_MAIN);
+}
+
+// Sets both the indicator and knob colour, as setArcColor() did
+static void arcColorObserver(lv_observer_t* observer, lv_subject_t* subject) {
+    lv_obj_t* arc = lv_observer_get_target_obj(observer);
+    lv_obj_set_style_arc_color(arc, lv_subject_get_color(subject), LV_PART_INDICATOR | LV_STATE_DEFAULT);
+    lv_obj_set_style_bg_color(arc, lv_subject_get_color(subject), LV_PART_KNOB | LV_STATE_DEFAULT);
+}
+
+// Forecast arc observes value, min and max; the range is set before the value
+// because lv_arc_set_value clamps against the current range
+static void forecastArcObserver(lv_observer_t* observer, lv_subject_t* subject) {
+    lv_obj_t* arc = lv_observer_get_target_obj(observer);
+    lv_arc_set_range(arc, lv_subject_get_int(&weatherBinding.tempMin), lv_subject_get_int(&weatherBinding.tempMax));
+    lv_arc_set_value(arc, lv_subject_get_int(&weatherBinding.tempValue));
+}
+
+// The bind helpers seed each subject from the widget's current state, so the
+// initial texts and flags set up in setup() stay on screen until data arrives.
+template <size_t N> static void bindLabel(TextSubject<N>& text, lv_obj_t* label) {
+    lv_subject_init_string(&text.subject, text.buf, nullptr, N, lv_label_get_text(label));
+    lv_label_bind_text(label, &text.subject, nullptr);
+}
+
+static void bindArcValue(lv_subject_t& subject, lv_obj_t* arc) {
+    lv_subject_init_int(&subject, lv_arc_get_value(arc));
+    lv_arc_bind_value(arc, &subject);
+}
+
+static void bindVisible(lv_subject_t& subject, lv_obj_t* obj) {
+    lv_obj_bind_flag_if_eq(obj, &subject, LV_OBJ_FLAG_HIDDEN, 0);
+}
+
+static void bindTextColor(lv_subject_t& subject, lv_obj_t* obj) {
+    lv_subject_init_color(&subject, lv_obj_get_style_text_color(obj, LV_PART_MAIN));
+    lv_subject_add_observer_obj(&subject, textColorObserver, obj, nullptr);
+    if (textColorSubjectCount < MAX_TEXT_COLOR_SUBJECTS) {
+        textColorSubjects[textColorSubjectCount++] = &subject;
+    }
+}
+
+static void bindArcColor(lv_subject_t& subject, lv_obj_t* arc) {
+    lv_subject_init_color(&subject, lv_obj_get_style_arc_color(arc, LV_PART_INDICATOR));
+    lv_subject_add_observer_obj(&subject, arcColorObserver, arc, nullptr);
+}
+
+// Creates every subject and binds it to its widget. Call once after ui_init()
+// and the initial label setup, before the first render.
+void uiBindingsInit() {
+    lv_obj_t** tempArcs[ROOM_COUNT] = TEMP_ARC_LABELS;
+    lv_obj_t** tempLabels[ROOM_COUNT] = TEMP_LABELS;
+    lv_obj_t** directionLabels[ROOM_COUNT] = DIRECTION_LABELS;
+    lv_obj_t** humidityLabels[ROOM_COUNT] = HUMIDITY_LABELS;
+    lv_obj_t** batteryLabels[ROOM_COUNT] = BATTERY_LABELS;
+    for (int i = 0; i < ROOM_COUNT; i++) {
+        RoomBinding& room = roomBindings[i];
+        bindLabel(room.temp, *tempLabels[i]);
+        bindLabel(room.direction, *directionLabels[i]);
+        bindLabel(room.humidity, *humidityLabels[i]);
+        bindLabel(room.battery, *batteryLabels[i]);
+        bindArcValue(room.tempValue, *tempArcs[i]);
+        lv_subject_init_int(&room.tempState, (int32_t)ReadingState::NO_DATA);
+        lv_obj_bind_state_if_eq(*tempLabels[i], &room.tempState, STATE_STALE, (int32_t)ReadingState::STALE);
+        bindTextColor(room.batteryColor, *batteryLabels[i]);
+        lv_subject_init_int(&room.tempVisible, !lv_obj_has_flag(*tempArcs[i], LV_OBJ_FLAG_HIDDEN));
+        bindVisible(room.tempVisible, *tempArcs[i]);
+    }
+
+    bindLabel(uvBinding.label, ui_UVLabel);
+    bindLabel(uvBinding.updateTime, ui_UVUpdateTime);
+    bindArcValue(uvBinding.value, ui_UVArc);
+    bindArcColor(uvBinding.color, ui_UVArc);
+    lv_subject_init_int(&uvBinding.visible, !lv_obj_has_flag(ui_UVArc, LV_OBJ_FLAG_HIDDEN));
+    bindVisible(uvBinding.visible, ui_UVArc);
+
+    bindLabel(weatherBinding.conditions, ui_FCConditions);
+    bindLabel(weatherBinding.updateTime, ui_FCUpdateTime);
+    bindLabel(weatherBinding.wind, ui_FCWindSpeed);
+    bindLabel(weatherBinding.aqi, ui_FCAQI);
+    bindLabel(weatherBinding.aqiUpdateTime, ui_FCAQIUpdateTime);
+    bindLabel(weatherBinding.temp, ui_TempLabelFC);
+    bindLabel(weatherBinding.min, ui_FCMin);
+    bindLabel(weatherBinding.max, ui_FCMax);
+    lv_subject_init_int(&weatherBinding.tempMin, lv_arc_get_min_value(ui_TempArcFC));
+    lv_subject_init_int(&weatherBinding.tempMax, lv_arc_get_max_value(ui_TempArcFC));
+    lv_subject_init_int(&weatherBinding.tempValue, lv_arc_get_value(ui_TempArcFC));
+    lv_subject_add_observer_obj(&weatherBinding.tempMin, forecastArcObserver, ui_TempArcFC, nullptr);
+    lv_subject_add_observer_obj(&weatherBinding.tempMax, forecastArcObserver, ui_TempArcFC, nullptr);
+    lv_subject_add_observer_obj(&weatherBinding.tempValue, forecastArcObserver, ui_TempArcFC, nullptr);
+    lv_subject_init_int(&weatherBinding.visible, !lv_obj_has_flag(ui_TempArcFC, LV_OBJ_FLAG_HIDDEN));
+    bindVisible(weatherBinding.visible, ui_TempArcFC);
+
+    bindLabel(insideAQBinding.co2, ui_InsideAirQualityCO2);
+    bindLabel(insideAQBinding.pm25, ui_InsideAirQualityPM25);
+    lv_subject_init_int(&insideAQBinding.co2State, (int32_t)ReadingState::NO_DATA);
+    lv_subject_init_int(&insideAQBinding.pm25State, (int32_t)ReadingState::NO_DATA);
+    lv_obj_bind_state_if_eq(ui_InsideAirQualityCO2, &insideAQBinding.co2State, STATE_ALERT, (int32_t)ReadingState::STALE);
+    lv_obj_bind_state_if_eq(ui_InsideAirQualityPM25, &insideAQBinding.pm25State, STATE_ALERT, (int32_t)ReadingState::STALE);
+
+    bindLabel(solarBinding.batteryLabel, ui_BatteryLabel);
+    bindLabel(solarBinding.solarLabel, ui_SolarLabel);
+    bindLabel(solarBinding.usingLabel, ui_UsingLabel);
+    bindLabel(solarBinding.chargingLabel, ui_ChargingLabel);
+    bindLabel(solarBinding.chargingTime, ui_ChargingTime);
+    bindLabel(solarBinding.minMax, ui_SolarMinMax);
+    bindLabel(solarBinding.asOf, ui_AsofTimeLabel);
+    bindLabel(solarBinding.gridTodayEnergy, ui_GridTodayEnergy);
+    bindLabel(solarBinding.gridMonthEnergy, ui_GridMonthEnergy);
+    bindLabel(solarBinding.gridTodayCost, ui_GridTodayCost);
+    bindLabel(solarBinding.gridMonthCost, ui_GridMonthCost);
+    bindLabel(solarBinding.gridTodayPercentage, ui_GridTodayPercentage);
+    bindLabel(solarBinding.gridMonthPercentage, ui_GridMonthPercentage);
+    bindLabel(solarBinding.solarTodayEnergy, ui_SolarTodayEnergy);
+    bindLabel(solarBinding.solarMonthEnergy, ui_SolarMonthEnergy);
+    bindArcValue(solarBinding.batteryValue, ui_BatteryArc);
+    bindArcValue(solarBinding.solarValue, ui_SolarArc);
+    bindArcValue(solarBinding.usingValue, ui_UsingArc);
+    bindArcColor(solarBinding.batteryArcColor, ui_BatteryArc);
+    bindArcColor(solarBinding.solarArcColor, ui_SolarArc);
+    lv_subject_init_int(&solarBinding.visible, !lv_obj_has_flag(ui_BatteryArc, LV_OBJ_FLAG_HIDDEN));
+    bindVisible(solarBinding.visible, ui_BatteryArc);
+    bindVisible(solarBinding.visible, ui_SolarArc);
+    bindVisible(solarBinding.visible, ui_UsingArc);
+
+    bindLabel(statusBinding.time, ui_Time);
+    bindLabel(statusBinding.version, ui_Version);
+    bindLabel(statusBinding.wifiIcon, ui_WiFiIcon);
+    bindLabel(statusBinding.message, ui_StatusMessage);
+    bindTextColor(statusBinding.wifiColor, ui_WiFiStatus);
+    bindTextColor(statusBinding.serverColor, ui_ServerStatus);
+    bindTextColor(statusBinding.solarColor, ui_SolarStatus);
+    bindTextColor(statusBinding.weatherColor, ui_WeatherStatus);
+    bindTextColor(statusBinding.uvTimeColor, ui_UVUpdateTime);
+    bindTextColor(statusBinding.aqiTimeColor, ui_FCAQIUpdateTime);
+    lv_subject_init_int(&statusBinding.wifiConnected, 1);
+    lv_obj_bind_state_if_eq(ui_WiFiIcon, &statusBinding.wifiConnected, STATE_ALERT, 0);
+}
+
+// Re-applies every bound text colour to its widget.
+void refreshBoundColors() {
+    for (int i = 0; i < textColorSubjectCount; i++) {
+        lv_subject_notify(textColorSubjects[i]);
+    }
+}
+
+void setBoundInt(lv_subject_t& subject, int32_t value) {
+    if (lv_subject_get_int(&subject) != value) {
+        lv_subject_set_int(&subject, value);
+    }
+}
+
+void setBoundColor(lv_subject_t& subject, lv_color_t color) {
+    if (!lv_color_eq(lv_subject_get_color(&subject), color)) {
+        lv_subject_set_color(&subject, color);
+    }
+}
@@ -0,0 +1,77 @@
+#ifndef UIBINDINGS_H
+#define UIBINDINGS_H
+
+#include "UI/ui.h"
+#include "types.h"
+#include <lvgl.h>
+
+// Displayed data as LVGL subjects. Each widget observes only the subjects it
+// shows, bound once by uiBindingsInit(). The setBound*() writers compare before
+// setting, so rewriting an unchanged value neither notifies nor invalidates.
+// All writes must be made with the LVGL lock held.
+
+// String subject with its own storage
+template <size_t N = BOUND_TEXT_LEN> struct TextSubject {
+    lv_subject_t subject;
+    char buf[N];
+};
+
+struct RoomBinding {
+    TextSubject<> temp, direction, humidity, battery;
+    lv_subject_t tempValue, tempState, tempVisible, batteryColor;
+};
+
+struct UvBinding {
+    TextSubject<> label, updateTime;
+    lv_subject_t value, color, visible;
+};
+
+struct WeatherBinding {
+    TextSubject<> conditions, updateTime, wind, aqi, aqiUpdateTime, temp, min, max;
+    lv_subject_t tempValue, tempMin, tempMax, visible;
+};
+
+struct InsideAQBinding {
+    TextSubject<> co2, pm25;
+    lv_subject_t co2State, pm25State;
+};
+
+struct SolarBinding {
+    TextSubject<> batteryLabel, solarLabel, usingLabel, chargingLabel, chargingTime, minMax, asOf;
+    TextSubject<> gridTodayEnergy, gridMonthEnergy, gridTodayCost, gridMonthCost, gridTodayPercentage, gridMonthPercentage;
+    TextSubject<> solarTodayEnergy, solarMonthEnergy;
+    lv_subject_t batteryValue, solarValue, usingValue, batteryArcColor, solarArcColor, visible;
+};
+
+struct StatusBinding {
+    TextSubject<> time, version, wifiIcon;
+    TextSubject<STATUS_TEXT_LEN + 1> message;
+    lv_subject_t wifiColor, serverColor, solarColor, weatherColor, uvTimeColor, aqiTimeColor, wifiConnected;
+};
+
+extern RoomBinding roomBindings[ROOM_COUNT];
+extern UvBinding uvBinding;
+extern WeatherBinding weatherBinding;
+extern InsideAQBinding insideAQBinding;
+extern SolarBinding solarBinding;
+extern StatusBinding statusBinding;
+
+void uiBindingsInit();
+void refreshBoundColors();
+void setBoundInt(lv_subject_t& subject, int32_t value);
+void setBoundColor(lv_subject_t& subject, lv_color_t color);
+
+template <size_t N> void setBoundText(TextSubject<N>& text, const char* value) {
+    if (strncmp(text.buf, value, N - 1) != 0) {
+        lv_subject_copy_string(&text.subject, value);
+    }
+}
+
+template <size_t N, size_t M> void setBoundText(TextSubject<N>& text, const FixedString<M>& value) {
+    setBoundText(text, value.c_str());
+}
+
+// Scratch string for composing a bound label; the subject would cut anything longer
+typedef FixedString<BOUND_TEXT_LEN - 1> BoundText;
+
+#endif // UIBINDINGS_H
@@ -1,6 +1,16 @@
 #ifndef BOARD_CONFIG_H
 #define BOARD_CONFIG_H
 
+#include <esp_arduino_version.h>
+#include <stdint.h>
+
+// How LVGL gets its pixels into the RGB panel's PSRAM framebuffer.
+enum class DisplayRenderMode : uint8_t {
+    PARTIAL,       // Render DISPLAY_BUFFER_LINES strips into a draw buffer; dispFlush copies each strip into the framebuffer
+    PARTIAL_ASYNC, // As PARTIAL with two strip buffers: a copy task on core 0 flushes one while LVGL renders the other
+    DIRECT         // Render straight into the panel framebuffer; dispFlush only writes the CPU cache back to PSRAM
+};
+
 // Per-board hardware configuration. Populated from compile-time constants and
 // selected at runtime after probing the I2C bus in setup().
 struct BoardConfig {
@@ -15,8 +25,22 @@ struct BoardConfig {
     int i2cSda, i2cScl, touchInt, touchRst, touchRawMaxY;
     // Backlight: GPIO pin for LEDC PWM, or -1 if controlled via I2C expander (Waveshare)
     int tftBl;
+    // LVGL render mode (see setupDisplayBuffers() in main.cpp)
+    DisplayRenderMode renderMode;
+    // RGB panel bounce buffers: lines of framebuffer staged in internal SRAM by the
+    // LCD driver so scan-out survives PSRAM contention; 0 = DMA straight from PSRAM.
+    // Must divide LCD_HEIGHT. Needs ESP-IDF 5 (Arduino core 3), see BOUNCE_BUFFER_LINES.
+    int bounceBufferLines;
 };
 
+// Bounce buffer lines for both boards. Arduino_ESP32RGBPanel only passes them to
+// esp_lcd on Arduino core 3; the IDF 4.4 driver has none, so 0 there.
+#if ESP_ARDUINO_VERSION_MAJOR >= 3
+#define BOUNCE_BUFFER_LINES 10
+#else
+#define BOUNCE_BUFFER_LINES 0
+#endif
+
 // Matouch ESP32-S3 4.3" board
 static const BoardConfig BOARD_CFG_MATOUCH = {
     // LCD: DE, VSYNC, HSYNC, PCLK
@@ -36,7 +60,11 @@ static const BoardConfig BOARD_CFG_MATOUCH = {
     // Touch I2C: SDA, SCL, INT, RST, raw Y max
     17, 18, -1, 38, 750,
     // TFT backlight GPIO
-    10
+    10,
+    // LVGL render mode
+    DisplayRenderMode::PARTIAL_ASYNC,
+    // Bounce buffer lines
+    BOUNCE_BUFFER_LINES
 };
 
 // Waveshare ESP32-S3-Touch-LCD-7B
@@ -58,7 +86,11 @@ static const BoardConfig BOARD_CFG_WAVESHARE = {
     // Touch I2C: SDA, SCL, INT, RST (via expander IO1), raw Y max
     8, 9, 4, -1, 600,
     // TFT backlight GPIO (-1 = controlled via I2C expander)
-    -1
+    -1,
+    // LVGL render mode
+    DisplayRenderMode::PARTIAL_ASYNC,
+    // Bounce buffer lines
+    BOUNCE_BUFFER_LINES
 };
 
 extern bool isWaveshare;
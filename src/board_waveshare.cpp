@@ -1,8 +1,21 @@
 #include "board_waveshare.h"
 #include "constants.h"
+#include "i2c_bus.h"
 #include <Arduino.h>
 #include <Wire.h>
 
+// Shadow copies of the expander's write-only view. Output and PWM changes are
+// made to the shadows and written by expander_commit() only if they differ from
+// what the chip already holds, so a bit flip costs one write instead of a
+// read-modify-write, and a batch of changes costs at most one write per register.
+static uint8_t shadowOut = 0x00;
+static uint8_t shadowPwm = 0x00;
+static uint8_t chipOut = 0x00;
+static uint8_t chipPwm = 0x00;
+static int batchDepth = 0;
+static int backlightPercent = 0;
+static QueueHandle_t fadeQueue = nullptr;
+
 // --- Internal helpers ---
 
 static void expander_write(uint8_t reg, uint8_t val) {
@@ -12,22 +25,58 @@ static void expander_write(uint8_t reg, uint8_t val) {
     Wire.endTransmission();
 }
 
-static uint8_t expander_read(uint8_t reg) {
-    Wire.beginTransmission(WS_EXPANDER_I2C_ADDR);
-    Wire.write(reg);
-    Wire.endTransmission(false);
-    Wire.requestFrom((uint8_t)WS_EXPANDER_I2C_ADDR, (uint8_t)1);
-    return Wire.available() ? Wire.read() : 0;
-}
-
 static void expander_set_bit(uint8_t io_pin, uint8_t level) {
-    uint8_t val = expander_read(WS_EXPANDER_REG_OUT);
+    waveshare_expander_begin();
     if (level) {
-        val |= (1 << io_pin);
+        shadowOut |= (1 << io_pin);
     } else {
-        val &= ~(1 << io_pin);
+        shadowOut &= ~(1 << io_pin);
+    }
+    waveshare_expander_commit();
+}
+
+// Updates the backlight shadows; written on the enclosing commit.
+static void backlight_apply(int percent) {
+    backlightPercent = percent;
+    if (percent == 0) {
+        shadowOut &= ~(1 << WS_IO_BACKLIGHT);
+        shadowPwm = 0;
+    } else {
+        // PWM register is inverted: 0 = full brightness, 97 = minimum/off
+        shadowOut |= (1 << WS_IO_BACKLIGHT);
+        shadowPwm = (uint8_t)(97 - percent);
+    }
+}
+
+static int clamp_percent(int percent) {
+    if (percent > 97) percent = 97;
+    if (percent < 0)  percent = 0;
+    return percent;
+}
+
+// FreeRTOS task: steps the backlight towards the latest target from fadeQueue,
+// one PWM register write per WS_BACKLIGHT_FADE_STEP_MS. A new target arriving
+// mid-fade restarts the ramp from the current level.
+static void backlightFade_t(void* pvParameters) {
+    int target = 0;
+    while (true) {
+        xQueueReceive(fadeQueue, &target, portMAX_DELAY);
+        bool retarget = true;
+        while (retarget) {
+            retarget = false;
+            int start = backlightPercent;
+            int steps = WS_BACKLIGHT_FADE_MS / WS_BACKLIGHT_FADE_STEP_MS;
+            for (int i = 1; i <= steps; i++) {
+                waveshare_expander_begin();
+                backlight_apply(start + (target - start) * i / steps);
+                waveshare_expander_commit();
+                if (xQueueReceive(fadeQueue, &target, pdMS_TO_TICKS(WS_BACKLIGHT_FADE_STEP_MS)) == pdTRUE) {
+                    retarget = true;
+                    break;
+                }
+            }
+        }
     }
-    expander_write(WS_EXPANDER_REG_OUT, val);
 }
 
 // --- Public API ---
@@ -38,8 +87,12 @@ void waveshare_expander_init() {
     // Set all IOs as outputs
     expander_write(WS_EXPANDER_REG_MODE, 0x00);
 
-    // Initial state: everything off / reset asserted
+    // Initial state: everything off / reset asserted. Written directly so the
+    // shadows start out matching the chip.
     expander_write(WS_EXPANDER_REG_OUT, 0x00);
+    expander_write(WS_EXPANDER_REG_PWM, 0x00);
+    shadowOut = chipOut = 0x00;
+    shadowPwm = chipPwm = 0x00;
     delay(20);
 
     // De-assert LCD reset
@@ -60,20 +113,47 @@ void waveshare_expander_init() {
     pinMode(WS_TOUCH_INT, INPUT); // Release INT — the GT911 drives it after init
 
     // Backlight starts off — caller sets brightness after display init
-    expander_set_bit(WS_IO_BACKLIGHT, 0);
-    expander_write(WS_EXPANDER_REG_PWM, 0);
+    waveshare_backlight_set(0);
+}
+
+void waveshare_expander_begin() {
+    i2c_bus_lock();
+    batchDepth++;
+}
+
+void waveshare_expander_commit() {
+    if (--batchDepth == 0) {
+        if (shadowOut != chipOut) {
+            expander_write(WS_EXPANDER_REG_OUT, shadowOut);
+            chipOut = shadowOut;
+        }
+        if (shadowPwm != chipPwm) {
+            expander_write(WS_EXPANDER_REG_PWM, shadowPwm);
+            chipPwm = shadowPwm;
+        }
+    }
+    i2c_bus_unlock();
 }
 
 void waveshare_backlight_set(int percent) {
-    if (percent > 97) percent = 97;
-    if (percent < 0)  percent = 0;
+    waveshare_expander_begin();
+    backlight_apply(clamp_percent(percent));
+    waveshare_expander_commit();
+}
 
-    if (percent == 0) {
-        expander_set_bit(WS_IO_BACKLIGHT, 0);
-        expander_write(WS_EXPANDER_REG_PWM, 0);
-    } else {
-        // PWM register is inverted: 0 = full brightness, 97 = minimum/off
-        expander_set_bit(WS_IO_BACKLIGHT, 1);
-        expander_write(WS_EXPANDER_REG_PWM, (uint8_t)(97 - percent));
+void waveshare_backlight_fade(int percent) {
+    if (!fadeQueue) {
+        fadeQueue = xQueueCreate(1, sizeof(int));
+        if (!fadeQueue || xTaskCreatePinnedToCore(backlightFade_t, "Backlight Fade", TASK_STACK_SMALL, nullptr, 1, nullptr, 0) != pdPASS) {
+            Serial.println("Error: Failed to start backlight fade task");
+            if (fadeQueue) {
+                vQueueDelete(fadeQueue);
+                fadeQueue = nullptr;
+            }
+            waveshare_backlight_set(percent);
+            return;
+        }
     }
+    int target = clamp_percent(percent);
+    xQueueOverwrite(fadeQueue, &target);
 }
@@ -30,14 +30,26 @@
 // Backlight brightness levels used in day/night mode (0–97)
 static const int WS_BACKLIGHT_DAY_PERCENT   = 97; // Maximum usable brightness
 static const int WS_BACKLIGHT_NIGHT_PERCENT = 10; // Dim night-time brightness
+static const int WS_BACKLIGHT_FADE_MS       = 1000; // Duration of a day/night backlight fade
+static const int WS_BACKLIGHT_FADE_STEP_MS  = 20;   // One PWM register write per step
 
 // Initialise the I2C expander, reset the LCD panel and GT911 touch controller.
 // Must be called before gfx->begin() and touchInit().
 void waveshare_expander_init();
 
+// Batch expander changes: between begin() and commit() bit and backlight
+// changes only update the cached registers, and commit() writes each register
+// that changed once. Holds the shared I2C bus lock throughout; calls nest.
+void waveshare_expander_begin();
+void waveshare_expander_commit();
+
 // Set backlight brightness 0–100 %.
 // Values above 97 are clamped to 97 (hardware limit).
 // 0 turns the backlight off entirely.
 void waveshare_backlight_set(int percent);
 
+// Ramp the backlight to percent over WS_BACKLIGHT_FADE_MS in a background task
+// and return at once. A later call retargets a fade in progress.
+void waveshare_backlight_fade(int percent);
+
 #endif // BOARD_WAVESHARE_H
@@ -2,7 +2,7 @@
 #include "OTA.h"
 
 extern MqttClient mqttClient;
-extern Readings readings[];
+extern const ReadingInfo readingInfo[];
 extern const int numberOfReadings;
 extern struct tm timeinfo;
 
@@ -53,8 +53,8 @@ void mqtt_connect() {
     }
     logAndPublish("Connected to the MQTT broker");
     for (int i = 0; i < numberOfReadings; i++) {
-        if (!mqttClient.subscribe(readings[i].topic)) {
-            snprintf(messageBuffer, CHAR_LEN, "MQTT subscribe failed for topic: %s", readings[i].topic);
+        if (!mqttClient.subscribe(readingInfo[i].topic)) {
+            snprintf(messageBuffer, CHAR_LEN, "MQTT subscribe failed for topic: %s", readingInfo[i].topic);
             errorPublish(messageBuffer);
         }
     }
@@ -95,9 +95,7 @@ void connectivity_manager_t(void* pvParameters) {
 
         if (millis() - lastHwmLog > HWM_LOG_INTERVAL_MS) {
             lastHwmLog = millis();
-            char hwmMsg[CHAR_LEN];
-            snprintf(hwmMsg, CHAR_LEN, "Stack HWM: Connectivity %u words", uxTaskGetStackHighWaterMark(nullptr));
-            logAndPublish(hwmMsg);
+            logStackHighWaterMark("Connectivity");
         }
 
         if (WiFi.status() != WL_CONNECTED) {
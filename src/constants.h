@@ -6,26 +6,29 @@
 
 static constexpr int STORED_READING = 6;
 static constexpr int MAX_READINGS = 20; // Safe upper bound for per-reading tracking arrays (currently 15)
+// Compile-time sensor metadata (readingInfo[] in main.cpp, kept in flash). The runtime
+// state in readings[] has the same order and count.
 // clang-format off
-#define READINGS_ARRAY                                                                                                                    \
-        {"Cave",        "cave/tempset-ambient/set",        NO_READING, 0.0, {0.0}, ReadingState::NO_DATA, false, DATA_TEMPERATURE, 0, 0}, \
-        {"Living room", "livingroom/tempset-ambient/set",  NO_READING, 0.0, {0.0}, ReadingState::NO_DATA, false, DATA_TEMPERATURE, 0, 0}, \
-        {"Playroom",    "guest/tempset-ambient/set",       NO_READING, 0.0, {0.0}, ReadingState::NO_DATA, false, DATA_TEMPERATURE, 0, 0}, \
-        {"Bedroom",     "bedroom/tempset-ambient/set",     NO_READING, 0.0, {0.0}, ReadingState::NO_DATA, false, DATA_TEMPERATURE, 0, 0}, \
-        {"Outside",     "outside/tempset-ambient/set",     NO_READING, 0.0, {0.0}, ReadingState::NO_DATA, false, DATA_TEMPERATURE, 0, 0}, \
-        {"Cave",        "cave/tempset-humidity/set",       NO_READING, 0.0, {0.0}, ReadingState::NO_DATA, false, DATA_HUMIDITY,    0, 0}, \
-        {"Living room", "livingroom/tempset-humidity/set", NO_READING, 0.0, {0.0}, ReadingState::NO_DATA, false, DATA_HUMIDITY,    0, 0}, \
-        {"Playroom",    "guest/tempset-humidity/set",      NO_READING, 0.0, {0.0}, ReadingState::NO_DATA, false, DATA_HUMIDITY,    0, 0}, \
-        {"Bedroom",     "bedroom/tempset-humidity/set",    NO_READING, 0.0, {0.0}, ReadingState::NO_DATA, false, DATA_HUMIDITY,    0, 0}, \
-        {"Outside",     "outside/tempset-humidity/set",    NO_READING, 0.0, {0.0}, ReadingState::NO_DATA, false, DATA_HUMIDITY,    0, 0}, \
-        {"Cave",        "cave/battery/set",                NO_READING, 0.0, {0.0}, ReadingState::NO_DATA, false, DATA_BATTERY,     0, 0}, \
-        {"Living room", "livingroom/battery/set",          NO_READING, 0.0, {0.0}, ReadingState::NO_DATA, false, DATA_BATTERY,     0, 0}, \
-        {"Playroom",    "guest/battery/set",               NO_READING, 0.0, {0.0}, ReadingState::NO_DATA, false, DATA_BATTERY,     0, 0}, \
-        {"Bedroom",     "bedroom/battery/set",             NO_READING, 0.0, {0.0}, ReadingState::NO_DATA, false, DATA_BATTERY,     0, 0}, \
-        {"Outside",     "outside/battery/set",             NO_READING, 0.0, {0.0}, ReadingState::NO_DATA, false, DATA_BATTERY,     0, 0}
+#define READING_INFO_ARRAY                                                                                                                \
+        {"Cave",        "cave/tempset-ambient/set",        DATA_TEMPERATURE},                                                             \
+        {"Living room", "livingroom/tempset-ambient/set",  DATA_TEMPERATURE},                                                             \
+        {"Playroom",    "guest/tempset-ambient/set",       DATA_TEMPERATURE},                                                             \
+        {"Bedroom",     "bedroom/tempset-ambient/set",     DATA_TEMPERATURE},                                                             \
+        {"Outside",     "outside/tempset-ambient/set",     DATA_TEMPERATURE},                                                             \
+        {"Cave",        "cave/tempset-humidity/set",       DATA_HUMIDITY},                                                                \
+        {"Living room", "livingroom/tempset-humidity/set", DATA_HUMIDITY},                                                                \
+        {"Playroom",    "guest/tempset-humidity/set",      DATA_HUMIDITY},                                                                \
+        {"Bedroom",     "bedroom/tempset-humidity/set",    DATA_HUMIDITY},                                                                \
+        {"Outside",     "outside/tempset-humidity/set",    DATA_HUMIDITY},                                                                \
+        {"Cave",        "cave/battery/set",                DATA_BATTERY},                                                                 \
+        {"Living room", "livingroom/battery/set",          DATA_BATTERY},                                                                 \
+        {"Playroom",    "guest/battery/set",               DATA_BATTERY},                                                                 \
+        {"Bedroom",     "bedroom/battery/set",             DATA_BATTERY},                                                                 \
+        {"Outside",     "outside/battery/set",             DATA_BATTERY}
 // clang-format on
 
 static constexpr int ROOM_COUNT = 5;
+static constexpr int READING_COUNT = 3 * ROOM_COUNT; // Temperature, humidity and battery per room (READING_INFO_ARRAY)
 #define ROOM_NAME_LABELS {&ui_RoomName1, &ui_RoomName2, &ui_RoomName3, &ui_RoomName4, &ui_RoomName5}
 #define TEMP_ARC_LABELS {&ui_TempArc1, &ui_TempArc2, &ui_TempArc3, &ui_TempArc4, &ui_TempArc5}
 #define TEMP_LABELS {&ui_TempLabel1, &ui_TempLabel2, &ui_TempLabel3, &ui_TempLabel4, &ui_TempLabel5}
@@ -33,7 +36,7 @@ static constexpr int ROOM_COUNT = 5;
 #define DIRECTION_LABELS {&ui_Direction1, &ui_Direction2, &ui_Direction3, &ui_Direction4, &ui_Direction5}
 #define HUMIDITY_LABELS {&ui_HumidLabel1, &ui_HumidLabel2, &ui_HumidLabel3, &ui_HumidLabel4, &ui_HumidLabel5}
 
-// All text labels that receive a uniform color in day/night mode (used by set_basic_text_color).
+// All text labels that receive a uniform color in day/night mode (themed by theme_init).
 // clang-format off
 #define TEXT_COLOR_LABELS { \
     &ui_TempLabelFC,      &ui_UVLabel,             &ui_UsingLabel,           &ui_SolarLabel,           &ui_BatteryLabel,     \
@@ -57,23 +60,33 @@ static const char* const LOG_TOPIC = "klaussometer/log";
 static const char* const ERROR_TOPIC = "klaussometer/error";
 
 static const int CHAR_LEN = 255;
+static const int READING_OUTPUT_LEN = 8; // Formatted reading, e.g. "-12.5" or "100%"
+// FixedString capacities (characters, excluding the terminator) per use site
+static const int TIME_STRING_LEN = 8;   // "HH:MM:SS"
+static const int WIND_DIR_LEN = 2;      // degreesToDirection(), e.g. "NW"
+static const int WEATHER_TEXT_LEN = 31; // Longest wmoToText() result is 29
+static const int STATUS_TEXT_LEN = 127; // Status bar message; longer log lines are cut on screen only
+static const int LOG_FILENAME_LEN = 23; // NORMAL_LOG_FILENAME / ERROR_LOG_FILENAME
+static const int MQTT_TOPIC_LEN = 63;   // Longest subscribed topic is 31
+static const int MQTT_PAYLOAD_LEN = 31; // Sensor payloads are single numbers
 #define NO_READING "--"
-// Character settings
-static const char CHAR_UP = 'a';   // Based on epicycles font
-static const char CHAR_DOWN = 'b'; // Based on epicycles ADF font
-static const char CHAR_BLANK = 32; // Space — blank direction glyph (epicycles font)
-static const char CHAR_BATTERY_GOOD = '.';     // Based on battery2 font
-static const char CHAR_BATTERY_OK = ';';       // Based on battery2 font
-static const char CHAR_BATTERY_BAD = ',';      // Based on battery2 font
-static const char CHAR_BATTERY_CRITICAL = '>'; // Based on battery2 font
+// Character settings. The trailing ui_font_* names are read by scripts/font_subset.py,
+// which keeps only the glyphs referenced here and in the SquareLine screen.
+static const char CHAR_UP = 'a';               // ui_font_Epicycles
+static const char CHAR_DOWN = 'b';             // ui_font_Epicycles
+static const char CHAR_BLANK = 32;             // Space — blank direction and battery glyph, ui_font_Epicycles, ui_font_Battery2
+static const char CHAR_BATTERY_GOOD = '.';     // ui_font_Battery2
+static const char CHAR_BATTERY_OK = ';';       // ui_font_Battery2
+static const char CHAR_BATTERY_BAD = ',';      // ui_font_Battery2
+static const char CHAR_BATTERY_CRITICAL = '>'; // ui_font_Battery2
 
 // Phosphor WiFi icons
-static const char* const WIFI_HIGH = "\xEE\x93\xAA";   // U+E4EA
-static const char* const WIFI_MEDIUM = "\xEE\x93\xAE"; // U+E4EE
-static const char* const WIFI_LOW = "\xEE\x93\xAC";    // U+E4EC
-static const char* const WIFI_NONE = "\xEE\x93\xB0";   // U+E4F0
-static const char* const WIFI_SLASH = "\xEE\x93\xB2";  // U+E4F2
-static const char* const WIFI_X = "\xEE\x93\xB4";      // U+E4F4
+static const char* const WIFI_HIGH = "\xEE\x93\xAA";   // U+E4EA ui_font_Phosphor48
+static const char* const WIFI_MEDIUM = "\xEE\x93\xAE"; // U+E4EE ui_font_Phosphor48
+static const char* const WIFI_LOW = "\xEE\x93\xAC";    // U+E4EC ui_font_Phosphor48
+static const char* const WIFI_NONE = "\xEE\x93\xB0";   // U+E4F0 ui_font_Phosphor48
+static const char* const WIFI_SLASH = "\xEE\x93\xB2";  // U+E4F2 ui_font_Phosphor48
+static const char* const WIFI_X = "\xEE\x93\xB4";      // U+E4F4 ui_font_Phosphor48
 
 // WiFi signal strength thresholds (RSSI in dBm)
 static const int WIFI_RSSI_HIGH = -50;   // Excellent signal
@@ -91,7 +104,7 @@ static const float BATTERY_POWER_CHARGE_THRESHOLD = -0.1f;   // Max kW (negative
 static const float BATTERY_CHARGE_FULL_THRESHOLD = 0.99f;    // SoC fraction treated as fully charged (99%)
 
 // Reading state: tracks whether a sensor has valid data and which direction it's trending.
-// Stored in the Readings struct as uint8_t so it persists to SD card with no size change.
+// Stored in the Readings struct as uint8_t to keep the runtime entries small.
 enum class ReadingState : uint8_t {
     NO_DATA = 0,       // No reading received yet, or the reading has expired
     FIRST_READING = 1, // Only one data point so far — direction is unknown
@@ -136,10 +149,10 @@ static const float PM25_THRESHOLD_YELLOW = 12.0f;   // PM2.5 µg/m³: above this
 static const float PM25_THRESHOLD_RED    = 35.0f;   // PM2.5 µg/m³: above this shows red
 
 // Inside sensor MQTT topics (full broker path)
-static const char* const MQTT_INSIDE_CO2_TOPIC  = "kitchen/co2/set";
-static const char* const MQTT_INSIDE_PM1_TOPIC  = "kitchen/pm1/set";
-static const char* const MQTT_INSIDE_PM25_TOPIC = "kitchen/pm25/set";
-static const char* const MQTT_INSIDE_PM10_TOPIC = "kitchen/pm10/set";
+static constexpr const char* MQTT_INSIDE_CO2_TOPIC  = "kitchen/co2/set";
+static constexpr const char* MQTT_INSIDE_PM1_TOPIC  = "kitchen/pm1/set";
+static constexpr const char* MQTT_INSIDE_PM25_TOPIC = "kitchen/pm25/set";
+static constexpr const char* MQTT_INSIDE_PM10_TOPIC = "kitchen/pm10/set";
 
 // Data type definition for array
 static const int DATA_TEMPERATURE = 0;
@@ -191,9 +204,11 @@ static const int WIFI_RECONNECT_CHECK_DELAY_MS = 5000; // Delay between connecti
 static const int CONNECTION_CHECK_INTERVAL_MS = 5000;  // Delay at end of connectivity_manager main loop
 static const int MQTT_RECONNECT_DELAY_MS = 1000;       // Delay after successful MQTT reconnect before re-checking
 static const int MQTT_WAIT_CONNECTED_MS = 1000;        // Delay in MQTT task when broker not yet connected
+static const int STALE_SCAN_INTERVAL_MS = 1000;        // How often the MQTT task ages out quiet readings
 
 // Main loop and periodic update timing
-static const int LOOP_DELAY_MS = 20;                      // Main loop vTaskDelay to yield CPU between LVGL frames
+static const int WEB_POLL_INTERVAL_MS = 50;               // web_server_t poll period; WebServer has no wake-up event so handleClient() is polled
+static const int RENDER_MAX_IDLE_MS = 500;                // Longest render task sleep when no LVGL timer is due
 static const int PERIODIC_STATUS_INTERVAL_MS = 1000;      // How often updatePeriodicStatus() refreshes clock/WiFi/status
 static const int STATUS_MESSAGE_QUEUE_TIMEOUT_MS = 60000; // Queue receive timeout in displayStatusMessages_t (1 min)
 static const int REMAINING_TIME_ROUND_MIN = 10;           // Round battery remaining time to nearest N minutes for display
@@ -248,6 +263,7 @@ static const char* const SOLAR_TOKEN_FILENAME = "/solar_token.bin";
 static const char* const WEATHER_DATA_FILENAME = "/weather_data.bin";
 static const char* const UV_DATA_FILENAME = "/uv_data.bin";
 static const char* const READINGS_DATA_FILENAME = "/readings_data.bin";
+static const uint8_t SAVED_READING_VERSION = 1; // Entry layout of READINGS_DATA_FILENAME, see SavedReading
 static const char* const AIR_QUALITY_DATA_FILENAME = "/air_quality_data.bin";
 static const char* const INSIDE_AIR_QUALITY_DATA_FILENAME = "/inside_aq_data.bin";
 static const char* const NORMAL_LOG_FILENAME = "/normal_log.txt";
@@ -267,9 +283,40 @@ static const int STATUS_MESSAGE_QUEUE_SIZE = 20; // Slots in the status message
 static const int SD_LOG_QUEUE_SIZE = 20;         // Slots in the SD card log write queue
 
 // Display
-static constexpr uint64_t CHIP_ID_MASK = 0xFFFF; // Lower 16 bits of eFuse MAC used as chip ID
-static const int DISPLAY_BUFFER_LINES = 10;      // Height of the LVGL draw buffer in screen lines
-static const int POWER_ARC_SCALE = 10;           // Multiplier to convert kW values to arc range (0–100)
+static constexpr uint64_t CHIP_ID_MASK = 0xFFFF;                    // Lower 16 bits of eFuse MAC used as chip ID
+static const int DISPLAY_BUFFER_LINES = 10;                         // Height of the LVGL draw buffer in screen lines until calibrated
+static constexpr int DRAW_BUF_CANDIDATE_LINES[] = {10, 20, 40, 60}; // Strip heights tried by calibrateDrawBuffers()
+static constexpr size_t DRAW_BUF_MIN_FREE_INTERNAL = 64 * 1024;     // Internal heap left for WiFi/TLS after draw buffers
+static constexpr size_t DRAW_BUF_MIN_FREE_PSRAM = 512 * 1024;       // PSRAM left for HTTP/JSON buffers after draw buffers
+static const int CALIBRATION_REDRAWS = 4;                           // Timed full redraws per candidate layout
+static const int FLUSH_COPY_TASK_PRIORITY = 3;                      // Strip copy task on core 0 (PARTIAL_ASYNC); below the WiFi/LwIP tasks
+static const int RENDER_TASK_PRIORITY = 3;                          // LVGL render task on core 1; above loop() and MQTT so web requests can't stall it
+static const int VSYNC_TIMEOUT_MS = 50;                             // Render anyway if no vsync edge arrives within this time
+static const uint32_t VSYNC_SETTLE_FRAMES = 16;                     // Frames after boot before VSYNC periods are checked
+static const uint32_t VSYNC_JITTER_DIVISOR = 20;                    // VSYNC period more than 1/20 (5%) off average counts as jitter
+static const size_t PSRAM_BENCH_BUFFER_SIZE = 256 * 1024;           // Per-buffer size for the PSRAM benchmark; well beyond the data cache
+static const uint32_t PSRAM_BENCH_DURATION_MS = 1000;               // Length of each PSRAM benchmark phase
+static const int POWER_ARC_SCALE = 10;                              // Multiplier to convert kW values to arc range (0–100)
+static const size_t BOUND_TEXT_LEN = 96;                            // Storage per bound label string (see UIBindings.h)
+static const int SCREEN_MIRROR_MAX_RECTS = 16;                      // Changed rectangles kept per /screen client poll before merging
+static const uint32_t SCREEN_MIRROR_CLIENT_TIMEOUT_MS = 5000;       // Stop tracking changes this long after the last /screen poll
+static const size_t SCREEN_MIRROR_CHUNK_BYTES = 2048;               // sendContent() chunk size for /screen/frame
+static const uint32_t SCREEN_MIRROR_HISTORY = 8;                    // Drained rect sets kept so several /screen clients each get only their changes
+static const int STATIC_LAYER_BENCH_PASSES = 10;                    // Arc redraw passes timed per mode by /benchmark?name=layer
+static const uint32_t SEQLOCK_BENCH_DURATION_MS = 2000;             // Length of each /benchmark?name=seqlock phase
+static const uint32_t SEQLOCK_BENCH_RENDER_US = 5000;               // Simulated display update per read in /benchmark?name=seqlock
+
+// Idle display: inside the nightly window, after IDLE_TIMEOUT_MIN without a touch
+// the backlight goes off and LVGL stops running until the next touch
+static const int IDLE_TIMEOUT_MIN = 10;   // Minutes without touch before idling; 0 disables idle mode
+static const int IDLE_START_HOUR = 23;    // Local hour the idle window opens
+static const int IDLE_END_HOUR = 6;       // Local hour the idle window closes (may be before IDLE_START_HOUR)
+static const int IDLE_TOUCH_POLL_MS = 30; // Touch poll period while idle when the GT911 INT line isn't used
+
+// LVGL heap (see LvglMemory.h), replacing the fixed LV_MEM_SIZE pool
+static const size_t LVGL_HOT_POOL_SIZE = 32 * 1024;      // Internal SRAM for scratch draw buffers (layers)
+static const size_t LVGL_PSRAM_POOL_SIZE = 1024 * 1024;  // PSRAM for objects, styles, caches and everything else
+static const size_t LVGL_HOT_ALLOC_MAX = 25 * 1024;      // Larger scratch buffers go straight to PSRAM (one 24 KB layer fits)
 
 // OTA
 static const int OTA_BUFFER_SIZE = 128;         // Byte buffer for OTA firmware download chunks
@@ -481,4 +481,95 @@ const char* logs_html = R"=====(
 </html>
 )=====";
 
+// Live panel mirror. Polls /screen/frame with the last sequence number it
+// applied and paints each returned rectangle (format in ScreenMirror.h).
+const char* screen_html = R"=====(
+<!DOCTYPE html>
+<html>
+<head>
+  <title>Klaussometer Screen</title>
+  <style>
+    body {
+      background-color: #1e1e1e;
+      color: #d4d4d4;
+      font-family: Arial, sans-serif;
+      margin: 0;
+      padding: 20px;
+      text-align: center;
+    }
+    canvas {
+      max-width: 100%;
+      box-shadow: 0 4px 8px rgba(0, 0, 0, 0.4);
+    }
+    #status {
+      font-size: 12px;
+      margin-top: 10px;
+    }
+  </style>
+</head>
+<body>
+  <canvas id="screen" width="1024" height="600"></canvas>
+  <div id="status">Connecting...</div>
+  <script>
+    const ctx = document.getElementById('screen').getContext('2d');
+    const status = document.getElementById('status');
+    let seq = 0;
+    let bytes = 0;
+    let started = Date.now();
+
+    function paintRect(view, pos) {
+      const x = view.getUint16(pos, true), y = view.getUint16(pos + 2, true);
+      const w = view.getUint16(pos + 4, true), h = view.getUint16(pos + 6, true);
+      pos += 8;
+      const img = ctx.createImageData(w, h);
+      const out = img.data;
+      let o = 0;
+      const end = w * h * 4;
+      const put = (p) => {
+        out[o++] = ((p >> 11) & 0x1F) * 255 / 31;
+        out[o++] = ((p >> 5) & 0x3F) * 255 / 63;
+        out[o++] = (p & 0x1F) * 255 / 31;
+        out[o++] = 255;
+      };
+      while (o < end) {
+        const n = view.getUint16(pos, true);
+        pos += 2;
+        if (n & 0x8000) {
+          const p = view.getUint16(pos, true);
+          pos += 2;
+          for (let i = 0; i < (n & 0x7FFF); i++) put(p);
+        } else {
+          for (let i = 0; i < n; i++, pos += 2) put(view.getUint16(pos, true));
+        }
+      }
+      ctx.putImageData(img, x, y);
+      return pos;
+    }
+
+    async function poll() {
+      let delay = 250;
+      try {
+        const res = await fetch('/screen/frame?since=' + seq, { cache: 'no-store' });
+        const buf = await res.arrayBuffer();
+        const view = new DataView(buf);
+        bytes += buf.byteLength;
+        seq = view.getUint32(0, true);
+        const count = view.getUint16(4, true);
+        let pos = 6;
+        for (let i = 0; i < count; i++) pos = paintRect(view, pos);
+        if (count > 0) delay = 100;
+        const secs = (Date.now() - started) / 1000;
+        status.textContent = 'Frame ' + seq + ', ' + count + ' rects, ' + (bytes / 1024 / secs).toFixed(1) + ' KB/s average';
+      } catch (e) {
+        status.textContent = 'Disconnected - retrying';
+        delay = 2000;
+      }
+      setTimeout(poll, delay);
+    }
+    poll();
+  </script>
+</body>
+</html>
+)=====";
+
 #endif // HTML_H
\ No newline at end of file
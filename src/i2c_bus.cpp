@@ -0,0 +1,23 @@
+#include "i2c_bus.h"
+#include <Arduino.h>
+
+static SemaphoreHandle_t i2cBusMutex = nullptr;
+
+void i2c_bus_init() {
+    if (!i2cBusMutex) {
+        i2cBusMutex = xSemaphoreCreateRecursiveMutex();
+    }
+}
+
+// Before i2c_bus_init() setup() is single-threaded, so the lock is a no-op.
+void i2c_bus_lock() {
+    if (i2cBusMutex) {
+        xSemaphoreTakeRecursive(i2cBusMutex, portMAX_DELAY);
+    }
+}
+
+void i2c_bus_unlock() {
+    if (i2cBusMutex) {
+        xSemaphoreGiveRecursive(i2cBusMutex);
+    }
+}
@@ -0,0 +1,16 @@
+#ifndef I2C_BUS_H
+#define I2C_BUS_H
+
+// Arbiter for the shared Wire bus. The GT911 touch controller is read from the
+// LVGL render task, while the Waveshare IO expander is written from loop() and
+// the backlight fade task; each transaction sequence must hold the bus so one
+// task's register pointer write isn't interleaved with another's read.
+// The lock is recursive, so a helper that locks can be called under the lock.
+
+// Create the bus mutex. Call once in setup() before any task uses Wire.
+void i2c_bus_init();
+
+void i2c_bus_lock();
+void i2c_bus_unlock();
+
+#endif // I2C_BUS_H
@@ -16,8 +16,8 @@ static void publishMessageInternal(const char* messageBuffer, const char* filena
     // Queue SD card write (non-blocking)
     if (sdLogQueue != nullptr) {
         SDLogMessage logMsg;
-        snprintf(logMsg.message, CHAR_LEN, "%s", messageBuffer);
-        snprintf(logMsg.filename, sizeof(logMsg.filename), "%s", filename);
+        logMsg.message = messageBuffer;
+        logMsg.filename = filename;
         xQueueSend(sdLogQueue, &logMsg, 0); // Don't block if queue is full
     }
 
@@ -38,7 +38,7 @@ void logAndPublish(const char* messageBuffer) {
     publishMessageInternal(messageBuffer, NORMAL_LOG_FILENAME, logTopic, false);
 
     StatusMessage msg;
-    snprintf(msg.text, CHAR_LEN, "%s", messageBuffer);
+    msg.text = messageBuffer;
     msg.durationSec = STATUS_MESSAGE_TIME;
     xQueueSend(statusMessageQueue, &msg, 0); // Don't block if queue is full
 }
@@ -46,3 +46,11 @@ void logAndPublish(const char* messageBuffer) {
 void errorPublish(const char* messageBuffer) {
     publishMessageInternal(messageBuffer, ERROR_LOG_FILENAME, errorTopic, true);
 }
+
+// Logs the calling task's stack high-water mark: the least free stack it has
+// had. ESP-IDF counts stack in bytes, not the words of vanilla FreeRTOS.
+void logStackHighWaterMark(const char* taskName) {
+    FixedString<63> message;
+    message.format("Stack HWM: %s %u bytes", taskName, uxTaskGetStackHighWaterMark(nullptr));
+    logAndPublish(message.c_str());
+}
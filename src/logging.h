@@ -3,5 +3,6 @@
 
 void logAndPublish(const char* messageBuffer);
 void errorPublish(const char* messageBuffer);
+void logStackHighWaterMark(const char* taskName);
 
 #endif // LOGGING_H
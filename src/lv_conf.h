@@ -40,7 +40,11 @@
  * - LV_STDLIB_RTTHREAD:    RT-Thread implementation
  * - LV_STDLIB_CUSTOM:      Implement the functions externally
  */
-#define LV_USE_STDLIB_MALLOC    LV_STDLIB_BUILTIN
+#ifdef KLAUSSOMETER_HOST
+    #define LV_USE_STDLIB_MALLOC    LV_STDLIB_BUILTIN
+#else
+    #define LV_USE_STDLIB_MALLOC    LV_STDLIB_CUSTOM    /*Internal + PSRAM pools, see src/LvglMemory.cpp*/
+#endif
 #define LV_USE_STDLIB_STRING    LV_STDLIB_BUILTIN
 #define LV_USE_STDLIB_SPRINTF   LV_STDLIB_BUILTIN
 
@@ -83,7 +87,11 @@
  * - LV_OS_RTTHREAD
  * - LV_OS_WINDOWS
  * - LV_OS_CUSTOM */
-#define LV_USE_OS   LV_OS_FREERTOS
+#ifdef KLAUSSOMETER_HOST
+    #define LV_USE_OS   LV_OS_NONE      /*Single-threaded host build (see host/)*/
+#else
+    #define LV_USE_OS   LV_OS_FREERTOS
+#endif
 
 #if LV_USE_OS == LV_OS_CUSTOM
     #define LV_OS_CUSTOM_INCLUDE <stdint.h>
@@ -111,8 +119,24 @@
 #if LV_USE_DRAW_SW == 1
     /* Set the number of draw unit.
      * > 1 requires an operating system enabled in `LV_USE_OS`
-     * > 1 means multiply threads will render the screen in parallel */
-    #define LV_DRAW_SW_DRAW_UNIT_CNT    1
+     * > 1 means multiply threads will render the screen in parallel
+     * 1 until two are measured on the panel. LVGL's FreeRTOS port creates draw threads with
+     * xTaskCreate, which takes no core, and IDF 4.4 can't pin a task after creation, so two threads
+     * may both land on core 1 and gain nothing. To compare, build with -DLVGL_DRAW_UNITS=2 and read
+     * the "redraw ... ms (N draw units)" lines logged at boot and on each theme swap */
+    #if LV_USE_OS && defined(LVGL_DRAW_UNITS)
+        #define LV_DRAW_SW_DRAW_UNIT_CNT    LVGL_DRAW_UNITS
+    #else
+        #define LV_DRAW_SW_DRAW_UNIT_CNT    1
+    #endif
+
+    #if LV_USE_OS
+        /* Stack size of each draw thread */
+        #define LV_DRAW_THREAD_STACK_SIZE    (8 * 1024)   /*[bytes]*/
+
+        /* Priority of the draw threads; HIGH matches the LVGL render task in main.cpp */
+        #define LV_DRAW_THREAD_PRIO LV_THREAD_PRIO_HIGH
+    #endif
 
     /* Use Arm-2D to accelerate the sw render */
     #define LV_USE_DRAW_ARM2D_SYNC      0
@@ -134,13 +158,14 @@
         * The circumference of 1/4 circle are saved for anti-aliasing
         * radius * 4 bytes are used per circle (the most often used radiuses are saved)
         * 0: to disable caching */
-        #define LV_DRAW_SW_CIRCLE_CACHE_SIZE 4
+        #define LV_DRAW_SW_CIRCLE_CACHE_SIZE 16
     #endif
 
-    #define  LV_USE_DRAW_SW_ASM     LV_DRAW_SW_ASM_NONE
+    /*RGB565 fill, opacity fill and image copy go through src/PixelKernels.cpp*/
+    #define  LV_USE_DRAW_SW_ASM     LV_DRAW_SW_ASM_CUSTOM
 
     #if LV_USE_DRAW_SW_ASM == LV_DRAW_SW_ASM_CUSTOM
-        #define  LV_DRAW_SW_ASM_CUSTOM_INCLUDE ""
+        #define  LV_DRAW_SW_ASM_CUSTOM_INCLUDE "PixelKernels.h"
     #endif
 #endif
 
@@ -743,7 +768,7 @@
  *==================*/
 
 /*1: Enable API to take snapshot for object*/
-#define LV_USE_SNAPSHOT 0
+#define LV_USE_SNAPSHOT 1
 
 /*1: Enable system monitor component*/
 #define LV_USE_SYSMON   0
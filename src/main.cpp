@@ -16,16 +16,24 @@ Arduino Core 0
 #include "board_config.h"
 #include "board_waveshare.h"
 #include "APIs.h"
+#include "LvglMemory.h"
 #include "OTA.h"
+#include "PixelKernels.h"
+#include "RenderProfiler.h"
 #include "SDCard.h"
+#include "ScreenMirror.h"
 #include "ScreenUpdates.h"
+#include "UIBindings.h"
 #include "connections.h"
+#include "i2c_bus.h"
 #include "mqtt.h"
 #include "types.h"
 #include <Arduino_GFX_Library.h>
 #include <SPI.h>
 #include <TAMC_GT911.h>
 #include <Wire.h>
+#include <esp32s3/rom/cache.h>
+#include <esp_timer.h>
 
 // Create network objects
 WiFiClient espClient;
@@ -34,7 +42,6 @@ WebServer webServer(80);
 HTTPClient http;
 static const int HTTP_TIMEOUT_MS = 10000; // 10 second timeout for API calls
 SemaphoreHandle_t mqttMutex;
-SemaphoreHandle_t dataMutex;
 
 // Forward declarations for functions defined later in this file
 void pinInit();
@@ -43,18 +50,34 @@ void dispFlush(lv_display_t* disp, const lv_area_t* area, uint8_t* px_map);
 void touchRead(lv_indev_t* indev, lv_indev_data_t* data);
 bool detectWaveshare();
 void setBacklight(bool day);
-void getBatteryStatus(float batteryValue, int readingIndex, char* iconChar, lv_color_t* colorPtr);
-void invalidateOldReadings();
-void invalidateInsideAirQuality();
-void invalidateStaleApiData();
+void setBacklightOff();
 static void onTimeTouched(lv_event_t* e);
-static void setStatusColor(lv_obj_t* label, time_t updateTime, int maxAgeSec);
-static void updateRoomDisplay();
-static void updateUVDisplay();
-static void updateWeatherDisplay();
-static void updateInsideAQDisplay();
-static void updatePeriodicStatus(unsigned long currentMillis);
+static void IRAM_ATTR onTouchInt();
+void setTouchInterruptMode(bool enable);
+static void setStatusColor(lv_subject_t& colorSubject, time_t updateTime, int maxAgeSec);
+static void updatePeriodicStatus();
 static void adjustDayNightMode();
+static void setupDisplayBuffers();
+static bool allocDrawBuffers(int lines, bool internal);
+void calibrateDrawBuffers(char* report, size_t reportLen);
+static uint32_t timedFullRedraw();
+static void drainAsyncFlush();
+static const char* renderModeName(DisplayRenderMode mode);
+static void copyToFramebuffer(const lv_area_t* area, uint8_t* px_map);
+static void dispFlushWait(lv_display_t* disp);
+static void flushCopy_t(void* pvParameters);
+static void setupVsync();
+static void IRAM_ATTR onVsync();
+static uint32_t lvglTick();
+static void onRenderEvent(lv_event_t* e);
+static void lvglRender_t(void* pvParameters);
+static uint32_t measurePsramCopy(uint8_t* src, uint8_t* dst, uint32_t durationMs);
+static void psramBurst_t(void* pvParameters);
+void runPsramBenchmark(char* report, size_t reportLen);
+static bool idleDue();
+static void enterIdleMode();
+static bool touchedWhileIdle();
+static void exitIdleMode();
 
 // Global variables
 struct tm timeinfo;
@@ -64,9 +87,12 @@ Solar solar = {0, 0, 0, 0.0, 0.0, 0.0, 0.0, 0.0, "--:--:--", 100, 0, false, 0.0,
 SolarToken solarToken = {};
 AirQuality airQuality = {0.0, 0.0, 0.0, 0, 0, "--:--:--"};
 InsideAirQuality insideAirQuality = {};
-Readings readings[]{READINGS_ARRAY};
+extern const ReadingInfo readingInfo[]{READING_INFO_ARRAY};
+Readings readings[READING_COUNT];
 Preferences storage;
 extern const int numberOfReadings = sizeof(readings) / sizeof(readings[0]);
+static_assert(sizeof(readingInfo) / sizeof(readingInfo[0]) == READING_COUNT, "READING_COUNT doesn't match READING_INFO_ARRAY");
+static_assert(sizeof(readings) / sizeof(readings[0]) <= MAX_READINGS, "MAX_READINGS is too small for READING_INFO_ARRAY");
 QueueHandle_t statusMessageQueue;
 char logTopic[CHAR_LEN];
 char errorTopic[CHAR_LEN];
@@ -74,18 +100,31 @@ char chipId[CHAR_LEN];
 char macAddress[18]; // "AA:BB:CC:DD:EE:FF" + null
 
 // Status messages
-char statusMessageValue[CHAR_LEN];
+FixedString<STATUS_TEXT_LEN> statusMessageValue;
 
-// Dirty flags for display update groups (set by producers, cleared by loop)
+SeqLock<Readings[READING_COUNT]> roomsLock(readings);
+SeqLock<Weather> weatherLock(weather);
+SeqLock<UV> uvLock(uv);
+SeqLock<AirQuality> airQualityLock(airQuality);
+SeqLock<InsideAirQuality> insideAirQualityLock(insideAirQuality);
+SeqLock<Solar> solarLock(solar);
+SeqLock<FixedString<STATUS_TEXT_LEN>> statusLock(statusMessageValue);
+
+// Dirty flags for display update groups (set by producers via markDirty, cleared by loop)
 std::atomic<bool> dirtyRooms(true);
 std::atomic<bool> dirtySolar(true);
 std::atomic<bool> dirtyWeather(true);
 std::atomic<bool> dirtyUv(true);
 std::atomic<bool> dirtyInsideAQ(false);
+std::atomic<bool> dirtyStatusMessage(true);
+static TaskHandle_t loopTaskHandle = nullptr;
+static TaskHandle_t renderTaskHandle = nullptr;
+static volatile bool framePending = true; // Set on invalidation, cleared when LVGL finishes rendering
+static std::atomic<bool> displayIdle(false); // Backlight off and LVGL suspended (see enterIdleMode)
 
 const int MAX_DUTY_CYCLE = (int)(pow(2, PWMResolution) - 1);
-const float DAYTIME_DUTY = MAX_DUTY_CYCLE * (1.0 - MAX_BRIGHTNESS);
-const float NIGHTTIME_DUTY = MAX_DUTY_CYCLE * (1.0 - MIN_BRIGHTNESS);
+const int DAYTIME_DUTY = backlightDuty(MAX_BRIGHTNESS, MAX_DUTY_CYCLE);
+const int NIGHTTIME_DUTY = backlightDuty(MIN_BRIGHTNESS, MAX_DUTY_CYCLE);
 
 // Board detection — set in setup() before any hardware init
 bool isWaveshare = false;
@@ -100,6 +139,15 @@ TAMC_GT911* ts = nullptr;
 int touchLastX = 0;
 int touchLastY = 0;
 static bool touchAvailable = false; // set true only if GT911 responds on I2C
+static bool touchPressed = false;   // state reported to LVGL by the last touchRead
+static lv_indev_t* touchIndev = nullptr;
+static volatile uint32_t lastTouchMs = 0; // millis() of the last press, for idle mode
+// Interrupt mode: onTouchInt flags each GT911 report and touchRead only goes to
+// I2C when one is pending (or a finger is down). The ISR stays attached in
+// polling mode too, so latency can be measured in both.
+static volatile bool touchIrqPending = false;
+static volatile int64_t touchIrqUs = 0; // time of the first INT edge since the last read
+TouchStats touchStats = {};
 static bool showDate = false;       // when true, ui_Time shows date instead of time
 
 // Screen setting
@@ -107,6 +155,32 @@ static uint32_t screenWidth = LCD_WIDTH;
 static uint32_t screenHeight = LCD_HEIGHT;
 static lv_display_t* disp = nullptr;
 static lv_color_t* dispDrawBuf;
+static lv_color_t* dispDrawBuf2;                                          // second strip buffer, PARTIAL_ASYNC only
+static DisplayRenderMode activeRenderMode = DisplayRenderMode::PARTIAL; // board->renderMode after any fallback
+static int drawBufLines = DISPLAY_BUFFER_LINES;                          // strip height in use (PARTIAL modes)
+static bool drawBufInternal = false;                                      // strips in internal SRAM rather than PSRAM
+static bool drawBufCalibrated = false;                                    // NVS holds a calibrateDrawBuffers() result
+
+// Asynchronous flush (PARTIAL_ASYNC): dispFlush hands each strip to flushCopy_t
+// on core 0 and returns at once; LVGL blocks in dispFlushWait only when it needs
+// the buffer that is still being copied.
+struct FlushJob {
+    lv_area_t area;
+    uint8_t* pxMap;
+};
+static QueueHandle_t flushQueue = nullptr;
+static SemaphoreHandle_t flushDoneSem = nullptr;
+static bool flushInFlight = false; // A strip is queued or being copied; LVGL lock holders only
+
+// Render task: lvglRender_t owns lv_timer_handler() and starts each pass on the
+// panel's vsync edge. Everything else that touches LVGL holds lv_lock().
+static SemaphoreHandle_t vsyncSem = nullptr;
+static volatile uint32_t renderStartVsyncs = 0; // displayStats.vsyncs at LV_EVENT_RENDER_START
+static int64_t renderStartUs = 0;
+static int64_t lastVsyncUs = 0;
+static uint32_t vsyncPeriodUs = 0; // Running average of the VSYNC interval
+static std::atomic<bool> psramBurstRunning(false);
+DisplayStats displayStats = {};
 
 // Arrays of UI objects
 static lv_obj_t** roomNames[ROOM_COUNT] = ROOM_NAME_LABELS;
@@ -116,38 +190,59 @@ static lv_obj_t** batteryLabels[ROOM_COUNT] = BATTERY_LABELS;
 static lv_obj_t** directionLabels[ROOM_COUNT] = DIRECTION_LABELS;
 static lv_obj_t** humidityLabels[ROOM_COUNT] = HUMIDITY_LABELS;
 
-// Restores persisted sensor state from SD without touching the compiled-in
-// description/topic/dataType fields (they are const, and blindly overwriting
-// them would resurrect renamed topics from an old firmware's save file).
-// Loads into a temporary buffer, then copies only the runtime fields across,
-// and only for entries whose saved topic still matches the compiled-in one.
-static bool restoreReadings() {
-    Readings* temp = (Readings*)heap_caps_malloc(sizeof(readings), MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
-    if (!temp) {
-        temp = (Readings*)malloc(sizeof(readings));
+// Restores persisted sensor state from SD. Each saved entry carries the hash
+// of its topic and is only restored if that still matches the compiled-in
+// topic, so a renamed topic starts fresh instead of showing another sensor's
+// history. A file in the layout used before metadata and state were split is
+// migrated once and rewritten in the current layout.
+static bool restoreLegacyReadings() {
+    size_t size = sizeof(LegacyReadings) * numberOfReadings;
+    LegacyReadings* legacy = (LegacyReadings*)heap_caps_malloc(size, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+    if (!legacy) {
+        legacy = (LegacyReadings*)malloc(size);
     }
-    if (!temp) {
+    if (!legacy) {
         return false;
     }
-    bool ok = loadDataBlock(READINGS_DATA_FILENAME, temp, sizeof(readings));
+    bool ok = loadDataBlock(READINGS_DATA_FILENAME, legacy, size);
     if (ok) {
         for (int i = 0; i < numberOfReadings; i++) {
-            if (strncmp(temp[i].topic, readings[i].topic, CHAR_LEN) != 0) {
+            if (strncmp(legacy[i].topic, readingInfo[i].topic, CHAR_LEN) != 0) {
                 continue; // Topic changed since this file was saved — keep the fresh NO_DATA entry
             }
-            memcpy(readings[i].output, temp[i].output, sizeof(readings[i].output));
-            readings[i].currentValue = temp[i].currentValue;
-            memcpy(readings[i].lastValue, temp[i].lastValue, sizeof(readings[i].lastValue));
-            readings[i].readingState = temp[i].readingState;
-            readings[i].hasEnoughData = temp[i].hasEnoughData;
-            readings[i].readingIndex = temp[i].readingIndex;
-            readings[i].lastMessageTime = temp[i].lastMessageTime;
+            readings[i].lastMessageTime = legacy[i].lastMessageTime;
+            readings[i].currentValue = legacy[i].currentValue;
+            readings[i].history.clear();
+            for (int j = 0; j < constrain(legacy[i].readingIndex, 0, STORED_READING); j++) {
+                readings[i].history.push(legacy[i].lastValue[j]);
+            }
+            readings[i].readingState = legacy[i].readingState;
+            snprintf(readings[i].output, sizeof(readings[i].output), "%s", legacy[i].output);
         }
     }
-    free(temp);
+    free(legacy);
+    if (ok) {
+        logAndPublish(saveReadings() ? "Readings file migrated to the compact layout" : "Readings file migration not saved");
+    }
     return ok;
 }
 
+static bool restoreReadings() {
+    if (dataBlockSize(READINGS_DATA_FILENAME) == sizeof(LegacyReadings) * numberOfReadings) {
+        return restoreLegacyReadings();
+    }
+    static SavedReading saved[MAX_READINGS];
+    if (!loadDataBlock(READINGS_DATA_FILENAME, saved, sizeof(SavedReading) * numberOfReadings)) {
+        return false;
+    }
+    for (int i = 0; i < numberOfReadings; i++) {
+        if (saved[i].topicHash == topicHash(readingInfo[i].topic)) {
+            unpackSavedReading(saved[i], readings[i]);
+        }
+    }
+    return true;
+}
+
 // Probes GPIO 8/9 for the Waveshare TCA9554 I2C expander at address 0x24.
 // Returns true if found (Waveshare board), false otherwise (Matouch board).
 // GPIO 8/9 are safe to probe at boot — they are LCD data pins on Matouch but
@@ -160,17 +255,30 @@ bool detectWaveshare() {
     return found;
 }
 
-// Sets screen backlight to day (full) or night (dim) brightness.
-void setBacklight(bool day) {
-    if (isWaveshare) {
-        waveshare_backlight_set(day ? WS_BACKLIGHT_DAY_PERCENT : WS_BACKLIGHT_NIGHT_PERCENT);
-    } else {
-        float duty = day ? DAYTIME_DUTY : NIGHTTIME_DUTY;
+static void writeMatouchBacklight(int duty) {
 #if ESP_ARDUINO_VERSION_MAJOR >= 3
-        ledcWrite(board->tftBl, duty);
+    ledcWrite(board->tftBl, duty);
 #else
-        ledcWrite(PWMChannel, duty);
+    ledcWrite(PWMChannel, duty);
 #endif
+}
+
+// Sets screen backlight to day (full) or night (dim) brightness. On Waveshare
+// the expander PWM is ramped in the background so loop() isn't held up.
+void setBacklight(bool day) {
+    if (isWaveshare) {
+        waveshare_backlight_fade(day ? WS_BACKLIGHT_DAY_PERCENT : WS_BACKLIGHT_NIGHT_PERCENT);
+    } else {
+        writeMatouchBacklight(day ? DAYTIME_DUTY : NIGHTTIME_DUTY);
+    }
+}
+
+// Turns the backlight off (idle mode); setBacklight() brings it back
+void setBacklightOff() {
+    if (isWaveshare) {
+        waveshare_backlight_fade(0);
+    } else {
+        writeMatouchBacklight(backlightDuty(0.0f, MAX_DUTY_CYCLE));
     }
 }
 
@@ -192,6 +300,7 @@ void shutdownHandler(void) {
 }
 
 void setup() {
+    loopTaskHandle = xTaskGetCurrentTaskHandle(); // setup() and loop() share the Arduino loop task
     Serial.begin(115200);
     // Serial is the native USB CDC port (ARDUINO_USB_CDC_ON_BOOT=1); Serial0 is
     // the hardware UART, which the application log is mirrored to so messages
@@ -201,6 +310,7 @@ void setup() {
     // Auto-detect board type by probing I2C on GPIO 8/9 for the Waveshare expander at 0x24
     isWaveshare = detectWaveshare();
     board = isWaveshare ? &BOARD_CFG_WAVESHARE : &BOARD_CFG_MATOUCH;
+    i2c_bus_init();
     Serial.printf("Board: %s\n", isWaveshare ? "Waveshare" : "Matouch");
 
     if (isWaveshare) {
@@ -256,13 +366,12 @@ void setup() {
     // Setup queues and mutexes
     statusMessageQueue = xQueueCreate(STATUS_MESSAGE_QUEUE_SIZE, sizeof(StatusMessage));
     mqttMutex = xSemaphoreCreateMutex();
-    dataMutex = xSemaphoreCreateMutex();
     sdcard_init();
 
     if (statusMessageQueue == nullptr) {
         Serial.println("Error: Failed to create status message queue");
     }
-    if (mqttMutex == nullptr || dataMutex == nullptr) {
+    if (mqttMutex == nullptr) {
         Serial.println("Error: Failed to create mutex! Restarting...");
         delay(1000);
         esp_restart();
@@ -318,7 +427,7 @@ void setup() {
         if (loadDataBlock(INSIDE_AIR_QUALITY_DATA_FILENAME, &insideAirQuality, sizeof(insideAirQuality))) {
             logAndPublish("Inside air quality state restored OK");
             invalidateInsideAirQuality(); // Mark stale if data is old
-            dirtyInsideAQ = true;         // Trigger display update with restored values
+            markDirty(dirtyInsideAQ);     // Trigger display update with restored values
         } else {
             logAndPublish("Inside air quality state restore failed");
         }
@@ -337,7 +446,7 @@ void setup() {
         board->lcdB[0], board->lcdB[1], board->lcdB[2], board->lcdB[3], board->lcdB[4],
         board->hsyncPolarity, board->hsyncFront, board->hsyncPulse, board->hsyncBack,
         board->vsyncPolarity, board->vsyncFront, board->vsyncPulse, board->vsyncBack,
-        board->pclkActiveNeg, board->preferSpeed);
+        board->pclkActiveNeg, board->preferSpeed, false, 0, 0, board->bounceBufferLines * LCD_WIDTH);
     gfx = new Arduino_RGB_Display(LCD_WIDTH, LCD_HEIGHT, rgbpanel);
     ts = new TAMC_GT911(board->i2cSda, board->i2cScl, board->touchInt, board->touchRst, LCD_WIDTH, LCD_HEIGHT);
 
@@ -348,29 +457,14 @@ void setup() {
 
     // Init Display Hardware
     gfx->begin();
-#if ESP_ARDUINO_VERSION_MAJOR >= 3
-    gfx->fillScreen(RGB565_BLACK);
-#else
-    gfx->fillScreen(BLACK);
-#endif
+    size_t framebufferPixels = (size_t)gfx->width() * gfx->height();
+    pixelFill565(gfx->getFramebuffer(), 0x0000, framebufferPixels);
+    Cache_WriteBack_Addr((uint32_t)gfx->getFramebuffer(), framebufferPixels * sizeof(uint16_t));
     lv_init();
+    lvglMemoryUseScratchPool();
     screenWidth = gfx->width();
     screenHeight = gfx->height();
 
-    // Allocate display buffer
-    size_t bufferSize = sizeof(lv_color_t) * screenWidth * DISPLAY_BUFFER_LINES;
-
-    dispDrawBuf = (lv_color_t*)heap_caps_malloc(bufferSize, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
-    if (!dispDrawBuf) {
-        dispDrawBuf = (lv_color_t*)heap_caps_malloc(bufferSize, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
-    }
-
-    if (!dispDrawBuf) {
-        Serial.println("ERROR: Display buffer allocation FAILED! Restarting...");
-        delay(1000);
-        esp_restart();
-    }
-
     // Create LVGL display
     disp = lv_display_create(screenWidth, screenHeight);
     if (!disp) {
@@ -379,13 +473,20 @@ void setup() {
         esp_restart();
     }
     lv_display_set_flush_cb(disp, dispFlush);
-    lv_display_set_buffers(disp, dispDrawBuf, nullptr, bufferSize, LV_DISPLAY_RENDER_MODE_PARTIAL);
+    lv_tick_set_cb(lvglTick);
+    setupDisplayBuffers();
+    lv_display_add_event_cb(disp, onRenderEvent, LV_EVENT_RENDER_START, nullptr);
+    lv_display_add_event_cb(disp, onRenderEvent, LV_EVENT_RENDER_READY, nullptr);
+    lv_display_add_event_cb(disp, onRenderEvent, LV_EVENT_INVALIDATE_AREA, nullptr);
+    renderProfilerInit(disp);
+    screenMirrorInit(gfx->getFramebuffer(), LCD_WIDTH, LCD_HEIGHT);
+    setupVsync();
     ui_init();
 
     // Register touch input device with LVGL
-    lv_indev_t* indev = lv_indev_create();
-    lv_indev_set_type(indev, LV_INDEV_TYPE_POINTER);
-    lv_indev_set_read_cb(indev, touchRead);
+    touchIndev = lv_indev_create();
+    lv_indev_set_type(touchIndev, LV_INDEV_TYPE_POINTER);
+    lv_indev_set_read_cb(touchIndev, touchRead);
 
     // Tap the time label to toggle between time and date
     lv_obj_add_flag(ui_Time, LV_OBJ_FLAG_CLICKABLE);
@@ -395,7 +496,7 @@ void setup() {
     lv_label_set_text(ui_Version, "");
 
     for (unsigned char i = 0; i < ROOM_COUNT; ++i) {
-        lv_label_set_text(*roomNames[i], readings[i].description);
+        lv_label_set_text(*roomNames[i], readingInfo[i].description);
         lv_arc_set_value(*tempArcs[i], readings[i].currentValue);
         lv_obj_add_flag(*tempArcs[i], LV_OBJ_FLAG_HIDDEN);
         lv_label_set_text(*tempLabels[i], readings[i].output);
@@ -441,11 +542,8 @@ void setup() {
 
     // Set to night settings at first (until we determine if it's daytime)
     setBacklight(false);
-    set_basic_text_color(lv_color_hex(COLOR_WHITE));
-    set_arc_night_mode(true);
-    lv_obj_set_style_bg_color(lv_scr_act(), lv_color_hex(COLOR_BLACK), LV_STATE_DEFAULT);
-    lv_obj_set_style_border_color(ui_Container1, lv_color_hex(COLOR_WHITE), LV_STATE_DEFAULT);
-    lv_obj_set_style_border_color(ui_Container2, lv_color_hex(COLOR_WHITE), LV_STATE_DEFAULT);
+    theme_init();
+    apply_theme(true);
 
     lv_label_set_text(ui_GridBought, "\nToday:\nThis month:");
     lv_label_set_text(ui_GridTodayEnergy, "Pending");
@@ -457,6 +555,15 @@ void setup() {
     lv_label_set_text(ui_GridTodayPercentage, "");
     lv_label_set_text(ui_GridMonthPercentage, "");
 
+    uiBindingsInit();
+    static_layer_init(); // After the static labels above have their text
+
+    if (!drawBufCalibrated && activeRenderMode != DisplayRenderMode::DIRECT) {
+        char calibrationReport[CHAR_LEN];
+        calibrateDrawBuffers(calibrationReport, CHAR_LEN);
+    }
+    Serial.printf("Display: initial full-screen render %lu ms (%s mode, %d draw units)\n", (unsigned long)(timedFullRedraw() / 1000),
+                  renderModeName(activeRenderMode), LV_DRAW_SW_DRAW_UNIT_CNT);
     lv_timer_handler();
 
     // Get old battery min and max
@@ -496,30 +603,46 @@ void setup() {
     // Start tasks
     // Priority guide: Arduino loop() runs at priority 1 on core 1 (loopTask)
     // Keep background tasks at low priority to avoid starving the display loop
+    xTaskCreatePinnedToCore(lvglRender_t, "LVGL Render", TASK_STACK_MEDIUM, nullptr, RENDER_TASK_PRIORITY, &renderTaskHandle, 1);
     xTaskCreatePinnedToCore(sdcard_logger_t, "SD Logger", TASK_STACK_SMALL, nullptr, 0, nullptr, 1); // Core 1, priority 0 (lowest)
     xTaskCreatePinnedToCore(receive_mqtt_messages_t, "Receive Mqtt", TASK_STACK_MEDIUM, nullptr, 2, nullptr,
                             1); // Core 1, priority 2 - MEDIUM needed: update_readings() has deep call chain + multiple char[255] buffers
     xTaskCreatePinnedToCore(displayStatusMessages_t, "Display Status", TASK_STACK_SMALL, nullptr, 1, nullptr, 1);
     xTaskCreatePinnedToCore(connectivity_manager_t, "Connectivity", TASK_STACK_SMALL, nullptr, 1, nullptr, 1);
     xTaskCreatePinnedToCore(api_manager_t, "API Manager", TASK_STACK_MEDIUM, nullptr, 1, nullptr, 1); // HTTPS - replaces 7 API tasks + OTA check
-    
+    xTaskCreatePinnedToCore(web_server_t, "Web Server", TASK_STACK_MEDIUM, nullptr, 1, nullptr, 1); // Handlers ran on loopTask's 8 KB stack before
 }
 
+// Runs whenever a producer marks data dirty or the next periodic status update
+// is due; in between it blocks on its task notification, so an idle screen
+// costs no CPU. Web requests are served by web_server_t.
 void loop() {
     esp_task_wdt_reset();
 
-    static unsigned long lastTick = 0;
-    unsigned long currentMillis = millis();
-    unsigned long elapsed = currentMillis - lastTick;
-    if (elapsed > 0) {
-        lv_tick_inc(elapsed);
-        lastTick = currentMillis;
+    static unsigned long lastPeriodicMs = 0;
+    bool periodicDue = millis() - lastPeriodicMs >= PERIODIC_STATUS_INTERVAL_MS;
+    if (periodicDue) {
+        lastPeriodicMs = millis();
     }
 
-    lv_timer_handler(); // Run GUI - do this BEFORE delays
-    webServer.handleClient();
-    vTaskDelay(pdMS_TO_TICKS(LOOP_DELAY_MS));
+    // While idle the dirty flags just accumulate; the first pass after a touch
+    // wakes the display applies everything that changed, clock included.
+    static bool wasIdle = false;
+    if (!displayIdle && periodicDue && idleDue()) {
+        enterIdleMode();
+    }
+    if (displayIdle) {
+        wasIdle = true;
+        ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(PERIODIC_STATUS_INTERVAL_MS));
+        return;
+    }
+    bool woken = wasIdle;
+    if (woken) {
+        wasIdle = false;
+        periodicDue = true;
+    }
 
+    lv_lock();
     updateRoomDisplay();
     updateUVDisplay();
     updateWeatherDisplay();
@@ -530,201 +653,77 @@ void loop() {
         set_solar_values();
     }
 
-    updatePeriodicStatus(currentMillis);
+    if (periodicDue) {
+        updatePeriodicStatus();
+    }
     adjustDayNightMode();
 
-    char statusCopy[CHAR_LEN];
-    xSemaphoreTake(dataMutex, portMAX_DELAY);
-    snprintf(statusCopy, CHAR_LEN, "%s", statusMessageValue);
-    xSemaphoreGive(dataMutex);
-    lv_label_set_text(ui_StatusMessage, statusCopy);
-    invalidateOldReadings();
-    invalidateInsideAirQuality();
-    invalidateStaleApiData();
-}
-
-// Colors a status indicator green if data is fresh, red if it exceeds maxAgeSec.
-static void setStatusColor(lv_obj_t* label, time_t updateTime, int maxAgeSec) {
-    bool stale = (time(nullptr) - updateTime) > maxAgeSec;
-    lv_obj_set_style_text_color(label, lv_color_hex(stale ? COLOR_RED : COLOR_GREEN), LV_PART_MAIN);
-}
-
-// Updates room temperature, humidity, trend arrows and sensor battery icons.
-static void updateRoomDisplay() {
-    if (!dirtyRooms)
-        return;
-    dirtyRooms = false;
-    char tempString[CHAR_LEN];
-    char batteryIcon;
-    lv_color_t batteryColor;
-    xSemaphoreTake(dataMutex, portMAX_DELAY);
-    for (unsigned char i = 0; i < ROOM_COUNT; ++i) {
-        lv_arc_set_value(*tempArcs[i], readings[i].currentValue);
-        lv_label_set_text(*tempLabels[i], readings[i].output);
-        if (readings[i].readingState == ReadingState::STALE) {
-            lv_obj_set_style_text_color(*tempLabels[i], lv_color_hex(COLOR_STALE), LV_PART_MAIN);
-            lv_obj_clear_flag(*tempArcs[i], LV_OBJ_FLAG_HIDDEN);
-        } else if (readings[i].readingState != ReadingState::NO_DATA) {
-            lv_color_t normalColor = weather.isDay ? lv_color_hex(COLOR_BLACK) : lv_color_hex(COLOR_WHITE);
-            lv_obj_set_style_text_color(*tempLabels[i], normalColor, LV_PART_MAIN);
-            lv_obj_clear_flag(*tempArcs[i], LV_OBJ_FLAG_HIDDEN);
-        } else {
-            lv_obj_add_flag(*tempArcs[i], LV_OBJ_FLAG_HIDDEN);
-        }
-        snprintf(tempString, CHAR_LEN, "%c", readingStateGlyph(readings[i].readingState));
-        lv_label_set_text(*directionLabels[i], tempString);
-        lv_label_set_text(*humidityLabels[i], readings[i + ROOM_COUNT].output);
+    if (dirtyStatusMessage) {
+        dirtyStatusMessage = false;
+        FixedString<STATUS_TEXT_LEN> statusCopy;
+        statusLock.read(statusCopy);
+        setBoundText(statusBinding.message, statusCopy);
     }
-    for (unsigned char i = 0; i < ROOM_COUNT; ++i) {
-        getBatteryStatus(readings[i + 2 * ROOM_COUNT].currentValue, readings[i + 2 * ROOM_COUNT].readingIndex, &batteryIcon, &batteryColor);
-        snprintf(tempString, CHAR_LEN, "%c", batteryIcon);
-        lv_label_set_text(*batteryLabels[i], tempString);
-        lv_obj_set_style_text_color(*batteryLabels[i], batteryColor, LV_PART_MAIN);
+    lv_unlock();
+    if (woken) {
+        logAndPublish("Display woken by touch"); // Here rather than in exitIdleMode(), which runs on the render task
     }
-    xSemaphoreGive(dataMutex);
-}
 
-// Updates the UV arc, label and update-time label.
-static void updateUVDisplay() {
-    if (!dirtyUv)
-        return;
-    dirtyUv = false;
-    char tempString[CHAR_LEN];
-    xSemaphoreTake(dataMutex, portMAX_DELAY);
-    if (uv.updateTime > 0) {
-        lv_obj_clear_flag(ui_UVArc, LV_OBJ_FLAG_HIDDEN);
-        if (weather.isDay) {
-            snprintf(tempString, CHAR_LEN, "Updated %s", uv.timeString);
-        } else {
-            tempString[0] = '\0';
-        }
-        lv_label_set_text(ui_UVUpdateTime, tempString);
-        snprintf(tempString, CHAR_LEN, "%i", uv.index);
-        lv_label_set_text(ui_UVLabel, tempString);
-        lv_arc_set_value(ui_UVArc, uv.index * 10);
-        lv_obj_set_style_arc_color(ui_UVArc, lv_color_hex(uvColor(uv.index)), LV_PART_INDICATOR | LV_STATE_DEFAULT);
-        lv_obj_set_style_bg_color(ui_UVArc, lv_color_hex(uvColor(uv.index)), LV_PART_KNOB | LV_STATE_DEFAULT);
-    } else {
-        lv_obj_add_flag(ui_UVArc, LV_OBJ_FLAG_HIDDEN);
-        lv_label_set_text(ui_UVLabel, "--");
-        lv_label_set_text(ui_UVUpdateTime, "");
-    }
-    xSemaphoreGive(dataMutex);
+    unsigned long sincePeriodic = millis() - lastPeriodicMs;
+    unsigned long untilPeriodic = sincePeriodic < PERIODIC_STATUS_INTERVAL_MS ? PERIODIC_STATUS_INTERVAL_MS - sincePeriodic : 0;
+    ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(untilPeriodic));
 }
 
-// Updates weather forecast labels, the temperature arc and the AQI display.
-static void updateWeatherDisplay() {
-    if (!dirtyWeather)
-        return;
-    dirtyWeather = false;
-    char tempString[CHAR_LEN];
-    xSemaphoreTake(dataMutex, portMAX_DELAY);
-    if (weather.updateTime > 0) {
-        lv_label_set_text(ui_FCConditions, weather.description);
-        snprintf(tempString, CHAR_LEN, "Updated %s", weather.timeString);
-        lv_label_set_text(ui_FCUpdateTime, tempString);
-        snprintf(tempString, CHAR_LEN, "Wind %2.0f km/h %s", weather.windSpeed, weather.windDir);
-        lv_label_set_text(ui_FCWindSpeed, tempString);
-        if (airQuality.updateTime > 0) {
-            const char* aqiRating = getAQIRating(airQuality.europeanAqi);
-            snprintf(tempString, CHAR_LEN, "AQI %d - %s", airQuality.europeanAqi, aqiRating);
-            lv_label_set_text(ui_FCAQI, tempString);
-            snprintf(tempString, CHAR_LEN, "AQI Updated %s", airQuality.timeString);
-            lv_label_set_text(ui_FCAQIUpdateTime, tempString);
-        } else {
-            lv_label_set_text(ui_FCAQI, "AQI --");
-            lv_label_set_text(ui_FCAQIUpdateTime, "");
-        }
-        if (weather.temperature < weather.minTemp) {
-            weather.minTemp = weather.temperature;
-        }
-        if (weather.temperature > weather.maxTemp) {
-            weather.maxTemp = weather.temperature;
-        }
-        // Set the range before the value — lv_arc_set_value clamps against the current range
-        lv_arc_set_range(ui_TempArcFC, weather.minTemp, weather.maxTemp);
-        lv_arc_set_value(ui_TempArcFC, weather.temperature);
-        snprintf(tempString, CHAR_LEN, "%2.0f", weather.temperature);
-        lv_label_set_text(ui_TempLabelFC, tempString);
-        snprintf(tempString, CHAR_LEN, "%2.0f°C", weather.minTemp);
-        lv_label_set_text(ui_FCMin, tempString);
-        snprintf(tempString, CHAR_LEN, "%2.0f°C", weather.maxTemp);
-        lv_label_set_text(ui_FCMax, tempString);
-        lv_obj_clear_flag(ui_TempArcFC, LV_OBJ_FLAG_HIDDEN);
-    }
-    xSemaphoreGive(dataMutex);
-}
-
-// Updates CO2 and PM2.5 labels; red when stale, default text colour otherwise.
-static void updateInsideAQDisplay() {
-    if (!dirtyInsideAQ)
-        return;
-    dirtyInsideAQ = false;
-
-    char tempString[CHAR_LEN];
-    lv_color_t defaultColor = weather.isDay ? lv_color_hex(COLOR_BLACK) : lv_color_hex(COLOR_WHITE);
-    xSemaphoreTake(dataMutex, portMAX_DELAY);
-
-    // CO2 label
-    if (insideAirQuality.co2State == ReadingState::NO_DATA) {
-        lv_label_set_text(ui_InsideAirQualityCO2, "CO2: --");
-    } else {
-        char co2Buf[32];
-        formatIntegerWithCommas((long long)insideAirQuality.co2, co2Buf, sizeof(co2Buf));
-        snprintf(tempString, CHAR_LEN, "CO2: %s", co2Buf);
-        lv_label_set_text(ui_InsideAirQualityCO2, tempString);
-    }
-    lv_obj_set_style_text_color(ui_InsideAirQualityCO2, insideAirQuality.co2State == ReadingState::STALE ? lv_color_hex(COLOR_RED) : defaultColor, LV_PART_MAIN);
-
-    // PM2.5 label
-    if (insideAirQuality.pm25State == ReadingState::NO_DATA) {
-        lv_label_set_text(ui_InsideAirQualityPM25, "PM2.5: --");
-    } else {
-        snprintf(tempString, CHAR_LEN, "PM2.5: %.1f", insideAirQuality.pm25);
-        lv_label_set_text(ui_InsideAirQualityPM25, tempString);
+// Sets a display dirty flag and wakes loop() to apply it. Safe from any task.
+void markDirty(std::atomic<bool>& flag) {
+    flag = true;
+    if (loopTaskHandle) {
+        xTaskNotifyGive(loopTaskHandle);
     }
-    lv_obj_set_style_text_color(ui_InsideAirQualityPM25, insideAirQuality.pm25State == ReadingState::STALE ? lv_color_hex(COLOR_RED) : defaultColor, LV_PART_MAIN);
-    xSemaphoreGive(dataMutex);
 }
 
-// Updates status indicators, clock, WiFi icon and version string once per second.
-static void updatePeriodicStatus(unsigned long currentMillis) {
-    static unsigned long lastPeriodicMs = 0;
-    if (currentMillis - lastPeriodicMs < PERIODIC_STATUS_INTERVAL_MS)
-        return;
-    lastPeriodicMs = currentMillis;
+// Sets a status indicator's colour subject green if data is fresh, red if it exceeds maxAgeSec.
+static void setStatusColor(lv_subject_t& colorSubject, time_t updateTime, int maxAgeSec) {
+    bool stale = (time(nullptr) - updateTime) > maxAgeSec;
+    setBoundColor(colorSubject, lv_color_hex(stale ? COLOR_RED : COLOR_GREEN));
+}
 
+// Updates status indicators, clock, WiFi icon and version string; called from loop() once per second.
+static void updatePeriodicStatus() {
     char tempString[CHAR_LEN];
 
-    setStatusColor(ui_SolarStatus, solar.currentUpdateTime, 2 * SOLAR_CURRENT_UPDATE_INTERVAL_SEC);
-    setStatusColor(ui_WeatherStatus, weather.updateTime, 2 * WEATHER_UPDATE_INTERVAL_SEC);
-    setStatusColor(ui_UVUpdateTime, uv.updateTime, 2 * UV_UPDATE_INTERVAL_SEC);
-    setStatusColor(ui_FCAQIUpdateTime, airQuality.updateTime, 2 * AIR_QUALITY_UPDATE_INTERVAL_SEC);
+    Solar solarNow;
+    Weather weatherNow;
+    UV uvNow;
+    AirQuality airQualityNow;
+    solarLock.read(solarNow);
+    weatherLock.read(weatherNow);
+    uvLock.read(uvNow);
+    airQualityLock.read(airQualityNow);
+    setStatusColor(statusBinding.solarColor, solarNow.currentUpdateTime, 2 * SOLAR_CURRENT_UPDATE_INTERVAL_SEC);
+    setStatusColor(statusBinding.weatherColor, weatherNow.updateTime, 2 * WEATHER_UPDATE_INTERVAL_SEC);
+    setStatusColor(statusBinding.uvTimeColor, uvNow.updateTime, 2 * UV_UPDATE_INTERVAL_SEC);
+    setStatusColor(statusBinding.aqiTimeColor, airQualityNow.updateTime, 2 * AIR_QUALITY_UPDATE_INTERVAL_SEC);
 
     if (WiFi.status() == WL_CONNECTED) {
-        lv_obj_set_style_text_color(ui_WiFiStatus, lv_color_hex(COLOR_GREEN), LV_PART_MAIN);
-        lv_color_t wifiIconColor = weather.isDay ? lv_color_hex(COLOR_BLACK) : lv_color_hex(COLOR_WHITE);
+        setBoundColor(statusBinding.wifiColor, lv_color_hex(COLOR_GREEN));
         int rssi = WiFi.RSSI();
-        lv_label_set_text(ui_WiFiIcon, getWiFiIcon(rssi));
-        lv_obj_set_style_text_color(ui_WiFiIcon, wifiIconColor, LV_PART_MAIN);
+        setBoundText(statusBinding.wifiIcon, getWiFiIcon(rssi));
+        setBoundInt(statusBinding.wifiConnected, 1);
     } else {
-        lv_obj_set_style_text_color(ui_WiFiStatus, lv_color_hex(COLOR_RED), LV_PART_MAIN);
-        lv_label_set_text(ui_WiFiIcon, WIFI_X);
-        lv_obj_set_style_text_color(ui_WiFiIcon, lv_color_hex(COLOR_RED), LV_PART_MAIN);
+        setBoundColor(statusBinding.wifiColor, lv_color_hex(COLOR_RED));
+        setBoundText(statusBinding.wifiIcon, WIFI_X);
+        setBoundInt(statusBinding.wifiConnected, 0);
     }
 
-    if (mqttClient.connected()) {
-        lv_obj_set_style_text_color(ui_ServerStatus, lv_color_hex(COLOR_GREEN), LV_PART_MAIN);
-    } else {
-        lv_obj_set_style_text_color(ui_ServerStatus, lv_color_hex(COLOR_RED), LV_PART_MAIN);
-    }
+    setBoundColor(statusBinding.serverColor, lv_color_hex(mqttClient.connected() ? COLOR_GREEN : COLOR_RED));
 
     if (!getLocalTime(&timeinfo)) {
-        lv_label_set_text(ui_Time, "Syncing");
+        setBoundText(statusBinding.time, "Syncing");
     } else {
-        char timeString[CHAR_LEN];
+        char timeString[sizeof("Wed 31 Dec 2025")];
         strftime(timeString, sizeof(timeString), showDate ? "%a %d %b %Y" : "%H:%M:%S", &timeinfo);
-        lv_label_set_text(ui_Time, timeString);
+        setBoundText(statusBinding.time, timeString);
     }
 
     if (WiFi.status() == WL_CONNECTED) {
@@ -732,154 +731,459 @@ static void updatePeriodicStatus(unsigned long currentMillis) {
     } else {
         snprintf(tempString, CHAR_LEN, "Chip ID: %s | Firmware: V%s", chipId, FIRMWARE_VERSION);
     }
-    lv_label_set_text(ui_Version, tempString);
+    setBoundText(statusBinding.version, tempString);
 }
 
 // Adjusts screen brightness and text/arc colours when the day/night state changes.
 static void adjustDayNightMode() {
     static bool lastIsDay = false;
-    if (weather.isDay == lastIsDay)
+    bool isDay = weatherIsDay();
+    if (isDay == lastIsDay)
         return;
-    lastIsDay = weather.isDay;
-    dirtyRooms = true;    // Re-apply stale label colours after set_basic_text_color resets them
-    dirtyInsideAQ = true; // Re-apply stale/default colour with new day/night defaultColor
-    if (!weather.isDay) {
-        setBacklight(false);
-        set_basic_text_color(lv_color_hex(COLOR_WHITE));
-        set_arc_night_mode(true);
-        lv_obj_set_style_bg_color(lv_scr_act(), lv_color_hex(COLOR_BLACK), LV_STATE_DEFAULT);
-        lv_obj_set_style_border_color(ui_Container1, lv_color_hex(COLOR_WHITE), LV_STATE_DEFAULT);
-        lv_obj_set_style_border_color(ui_Container2, lv_color_hex(COLOR_WHITE), LV_STATE_DEFAULT);
-    } else {
-        setBacklight(true);
-        set_basic_text_color(lv_color_hex(COLOR_BLACK));
-        set_arc_night_mode(false);
-        lv_obj_set_style_bg_color(lv_scr_act(), lv_color_hex(COLOR_WHITE), LV_STATE_DEFAULT);
-        lv_obj_set_style_border_color(ui_Container1, lv_color_hex(COLOR_BLACK), LV_STATE_DEFAULT);
-        lv_obj_set_style_border_color(ui_Container2, lv_color_hex(COLOR_BLACK), LV_STATE_DEFAULT);
-    }
+    lastIsDay = isDay;
+    setBacklight(isDay);
+    int64_t themeStart = esp_timer_get_time();
+    apply_theme(!isDay);
+    uint32_t themeUs = (uint32_t)(esp_timer_get_time() - themeStart);
+
+    // The theme change invalidates the whole screen — render it now so the
+    // cost of a full redraw in the current render mode shows up in the log.
+    char logMessage[CHAR_LEN];
+    snprintf(logMessage, CHAR_LEN, "%s mode: theme %lu us, redraw %lu ms (%s render, %d draw units)", isDay ? "Day" : "Night",
+             (unsigned long)themeUs, (unsigned long)(timedFullRedraw() / 1000), renderModeName(activeRenderMode), LV_DRAW_SW_DRAW_UNIT_CNT);
+    logAndPublish(logMessage);
 }
 
-void invalidateOldReadings() {
-    if (time(nullptr) > TIME_SYNC_THRESHOLD) {
-        time_t now = time(nullptr);
-        xSemaphoreTake(dataMutex, portMAX_DELAY);
-        for (unsigned char i = 0; i < sizeof(readings) / sizeof(readings[0]); i++) {
-            time_t age = now - readings[i].lastMessageTime;
-            if (age > MAX_NO_MESSAGE_BLANK_SEC && readings[i].readingState != ReadingState::NO_DATA) {
-                readings[i].readingState = ReadingState::NO_DATA;
-                snprintf(readings[i].output, sizeof(readings[i].output), NO_READING);
-                readings[i].currentValue = 0.0;
-                dirtyRooms = true;
-            } else if (age > MAX_NO_MESSAGE_STALE_SEC && readings[i].readingState != ReadingState::STALE && readings[i].readingState != ReadingState::NO_DATA) {
-                readings[i].readingState = ReadingState::STALE;
-                dirtyRooms = true;
-            }
+// Sets up the LVGL draw buffers for the board's render mode and registers them.
+// DIRECT hands LVGL the RGB panel framebuffer itself, so widgets render in place
+// and every pixel is written once. PARTIAL renders into a strip buffer that
+// dispFlush copies across; PARTIAL_ASYNC adds a second strip so rendering and
+// copying overlap. Strip height and heap come from the last calibrateDrawBuffers()
+// run stored in NVS, or DISPLAY_BUFFER_LINES in PSRAM (internal RAM as fallback)
+// until one has been made. A mode whose resources can't be set up falls back to PARTIAL.
+static void setupDisplayBuffers() {
+    if (board->renderMode == DisplayRenderMode::DIRECT) {
+        uint16_t* framebuffer = gfx->getFramebuffer();
+        if (framebuffer) {
+            activeRenderMode = DisplayRenderMode::DIRECT;
+            size_t frameSize = sizeof(uint16_t) * screenWidth * screenHeight;
+            lv_display_set_buffers(disp, framebuffer, nullptr, frameSize, LV_DISPLAY_RENDER_MODE_DIRECT);
+            return;
+        }
+        Serial.println("Display: panel framebuffer unavailable, falling back to partial rendering");
+    }
+
+    activeRenderMode = DisplayRenderMode::PARTIAL;
+    if (board->renderMode == DisplayRenderMode::PARTIAL_ASYNC) {
+        flushQueue = xQueueCreate(1, sizeof(FlushJob));
+        flushDoneSem = xSemaphoreCreateBinary();
+        if (flushQueue && flushDoneSem &&
+            xTaskCreatePinnedToCore(flushCopy_t, "Flush Copy", TASK_STACK_SMALL, nullptr, FLUSH_COPY_TASK_PRIORITY, nullptr, 0) == pdPASS) {
+            activeRenderMode = DisplayRenderMode::PARTIAL_ASYNC;
+            lv_display_set_flush_wait_cb(disp, dispFlushWait);
+        } else {
+            Serial.println("Display: async flush setup failed, falling back to a single draw buffer");
         }
-        xSemaphoreGive(dataMutex);
     }
+
+    storage.begin("KO", true);
+    int savedLines = storage.getUShort("drawlines", 0);
+    bool savedInternal = storage.getBool("drawinternal", false);
+    storage.end();
+    drawBufCalibrated = savedLines > 0;
+
+    if (drawBufCalibrated && allocDrawBuffers(savedLines, savedInternal)) {
+        return;
+    }
+    if (allocDrawBuffers(DISPLAY_BUFFER_LINES, false) || allocDrawBuffers(DISPLAY_BUFFER_LINES, true)) {
+        return;
+    }
+    Serial.println("ERROR: Display buffer allocation FAILED! Restarting...");
+    delay(1000);
+    esp_restart();
 }
 
-void invalidateInsideAirQuality() {
-    if (time(nullptr) <= TIME_SYNC_THRESHOLD)
+// Allocates strip buffers of `lines` screen lines (two for PARTIAL_ASYNC) in internal
+// SRAM or PSRAM and hands them to LVGL, releasing the previous ones. Fails, leaving
+// the current buffers in place, if the heap can't supply them or would be left below
+// its DRAW_BUF_MIN_FREE_* reserve. Call with the LVGL lock held.
+static bool allocDrawBuffers(int lines, bool internal) {
+    size_t bufferSize = sizeof(lv_color_t) * screenWidth * lines;
+    uint32_t caps = (internal ? MALLOC_CAP_INTERNAL : MALLOC_CAP_SPIRAM) | MALLOC_CAP_8BIT;
+    bool twoBuffers = activeRenderMode == DisplayRenderMode::PARTIAL_ASYNC;
+
+    lv_color_t* buf1 = (lv_color_t*)heap_caps_malloc(bufferSize, caps);
+    lv_color_t* buf2 = twoBuffers ? (lv_color_t*)heap_caps_malloc(bufferSize, caps) : nullptr;
+    size_t reserve = internal ? DRAW_BUF_MIN_FREE_INTERNAL : DRAW_BUF_MIN_FREE_PSRAM;
+    if (!buf1 || (twoBuffers && !buf2) || heap_caps_get_free_size(caps) < reserve) {
+        free(buf1);
+        free(buf2);
+        return false;
+    }
+
+    drainAsyncFlush(); // The flush task may still be reading the old strip
+    lv_display_set_buffers(disp, buf1, buf2, bufferSize, LV_DISPLAY_RENDER_MODE_PARTIAL);
+    free(dispDrawBuf);
+    free(dispDrawBuf2);
+    dispDrawBuf = buf1;
+    dispDrawBuf2 = buf2;
+    drawBufLines = lines;
+    drawBufInternal = internal;
+    return true;
+}
+
+// Renders the current screen CALIBRATION_REDRAWS times with each candidate strip
+// height in internal SRAM and in PSRAM, keeps the fastest layout that fits the
+// heap reserves and stores it in NVS so later boots use it directly. Each result
+// is logged; a summary is written to report. Runs at first boot and from the
+// /calibrate-display web endpoint. Does nothing in DIRECT mode, which has no strip buffers.
+void calibrateDrawBuffers(char* report, size_t reportLen) {
+    if (activeRenderMode == DisplayRenderMode::DIRECT) {
+        snprintf(report, reportLen, "Display calibration skipped: direct render mode has no draw buffers");
+        logAndPublish(report);
         return;
-    time_t now = time(nullptr);
-    xSemaphoreTake(dataMutex, portMAX_DELAY);
-
-    // SCD41 — CO2 sensor
-    if (insideAirQuality.co2LastMessageTime != 0) {
-        time_t age = now - insideAirQuality.co2LastMessageTime;
-        if (age > MAX_NO_MESSAGE_BLANK_SEC) {
-            if (insideAirQuality.co2State != ReadingState::NO_DATA) {
-                insideAirQuality.co2State = ReadingState::NO_DATA;
-                insideAirQuality.co2 = 0.0f;
-                dirtyInsideAQ = true;
-            }
-        } else if (age > MAX_NO_MESSAGE_STALE_SEC) {
-            if (insideAirQuality.co2State != ReadingState::STALE && insideAirQuality.co2State != ReadingState::NO_DATA) {
-                insideAirQuality.co2State = ReadingState::STALE;
-                dirtyInsideAQ = true;
-            }
-        }
     }
 
-    // PMS5003 — particulate sensor
-    if (insideAirQuality.pmLastMessageTime != 0) {
-        time_t age = now - insideAirQuality.pmLastMessageTime;
-        if (age > MAX_NO_MESSAGE_BLANK_SEC) {
-            if (insideAirQuality.pm1State != ReadingState::NO_DATA) {
-                insideAirQuality.pm1State = ReadingState::NO_DATA;
-                insideAirQuality.pm1 = 0.0f;
-                dirtyInsideAQ = true;
-            }
-            if (insideAirQuality.pm25State != ReadingState::NO_DATA) {
-                insideAirQuality.pm25State = ReadingState::NO_DATA;
-                insideAirQuality.pm25 = 0.0f;
-                dirtyInsideAQ = true;
-            }
-            if (insideAirQuality.pm10State != ReadingState::NO_DATA) {
-                insideAirQuality.pm10State = ReadingState::NO_DATA;
-                insideAirQuality.pm10 = 0.0f;
-                dirtyInsideAQ = true;
+    char logMessage[CHAR_LEN];
+    int bestLines = 0;
+    bool bestInternal = false;
+    uint32_t bestUs = UINT32_MAX;
+
+    lv_lock();
+    for (int heap = 0; heap < 2; heap++) {
+        bool internal = (heap == 0);
+        for (int lines : DRAW_BUF_CANDIDATE_LINES) {
+            if (!allocDrawBuffers(lines, internal)) {
+                snprintf(logMessage, CHAR_LEN, "Display calibration: %d lines %s - does not fit", lines, internal ? "SRAM" : "PSRAM");
+                logAndPublish(logMessage);
+                continue;
             }
-        } else if (age > MAX_NO_MESSAGE_STALE_SEC) {
-            if (insideAirQuality.pm1State != ReadingState::STALE && insideAirQuality.pm1State != ReadingState::NO_DATA) {
-                insideAirQuality.pm1State = ReadingState::STALE;
-                dirtyInsideAQ = true;
+            timedFullRedraw(); // Warm the caches before timing
+            uint32_t totalUs = 0;
+            for (int i = 0; i < CALIBRATION_REDRAWS; i++) {
+                totalUs += timedFullRedraw();
             }
-            if (insideAirQuality.pm25State != ReadingState::STALE && insideAirQuality.pm25State != ReadingState::NO_DATA) {
-                insideAirQuality.pm25State = ReadingState::STALE;
-                dirtyInsideAQ = true;
-            }
-            if (insideAirQuality.pm10State != ReadingState::STALE && insideAirQuality.pm10State != ReadingState::NO_DATA) {
-                insideAirQuality.pm10State = ReadingState::STALE;
-                dirtyInsideAQ = true;
+            uint32_t avgUs = totalUs / CALIBRATION_REDRAWS;
+            snprintf(logMessage, CHAR_LEN, "Display calibration: %d lines %s - %lu us per full redraw", lines, internal ? "SRAM" : "PSRAM",
+                     (unsigned long)avgUs);
+            logAndPublish(logMessage);
+            if (avgUs < bestUs) {
+                bestUs = avgUs;
+                bestLines = lines;
+                bestInternal = internal;
             }
+            esp_task_wdt_reset();
         }
     }
-    xSemaphoreGive(dataMutex);
-}
 
-// Clears API-sourced data (weather, UV, outdoor AQ) if it exceeds MAX_API_DATA_AGE_SEC.
-// Handles old SD card restores and prolonged API outages — mirrors invalidateOldReadings()
-// for MQTT sensors. The display functions' updateTime > 0 checks then show "--"/hidden.
-void invalidateStaleApiData() {
-    if (time(nullptr) <= TIME_SYNC_THRESHOLD)
+    if (bestLines == 0 || !allocDrawBuffers(bestLines, bestInternal)) {
+        // Nothing fitted, or the winner no longer does: return to the boot default
+        if (!allocDrawBuffers(DISPLAY_BUFFER_LINES, false)) {
+            allocDrawBuffers(DISPLAY_BUFFER_LINES, true);
+        }
+        lv_unlock();
+        snprintf(report, reportLen, "Display calibration failed, using %d lines %s", drawBufLines, drawBufInternal ? "SRAM" : "PSRAM");
+        logAndPublish(report);
         return;
-    time_t now = time(nullptr);
-
-    xSemaphoreTake(dataMutex, portMAX_DELAY);
-    if (weather.updateTime > 0 && (now - weather.updateTime) > MAX_API_DATA_AGE_SEC) {
-        weather.updateTime = 0;
-        dirtyWeather = true;
-    }
-    if (uv.updateTime > 0 && (now - uv.updateTime) > MAX_API_DATA_AGE_SEC) {
-        uv.updateTime = 0;
-        dirtyUv = true;
     }
-    if (airQuality.updateTime > 0 && (now - airQuality.updateTime) > MAX_API_DATA_AGE_SEC) {
-        airQuality.updateTime = 0;
-        dirtyWeather = true;
+    lv_unlock();
+
+    storage.begin("KO");
+    storage.putUShort("drawlines", bestLines);
+    storage.putBool("drawinternal", bestInternal);
+    storage.end();
+    drawBufCalibrated = true;
+
+    snprintf(report, reportLen, "Display calibration: using %d lines %s (%lu us per full redraw)", bestLines, bestInternal ? "SRAM" : "PSRAM",
+             (unsigned long)bestUs);
+    logAndPublish(report);
+}
+
+// Invalidates the whole screen, renders it synchronously and returns the time taken in µs,
+// up to the last strip reaching the framebuffer.
+static uint32_t timedFullRedraw() {
+    lv_obj_invalidate(lv_scr_act());
+    int64_t start = esp_timer_get_time();
+    lv_refr_now(disp);
+    drainAsyncFlush();
+    return (uint32_t)(esp_timer_get_time() - start);
+}
+
+static const char* renderModeName(DisplayRenderMode mode) {
+    switch (mode) {
+    case DisplayRenderMode::DIRECT:
+        return "direct";
+    case DisplayRenderMode::PARTIAL_ASYNC:
+        return "partial async";
+    case DisplayRenderMode::PARTIAL:
+    default:
+        return "partial";
     }
-    xSemaphoreGive(dataMutex);
 }
 
-// Flush function for LVGL
-void dispFlush(lv_display_t* disp, const lv_area_t* area, uint8_t* px_map) {
+// Copies a rendered strip into the panel framebuffer with the pixel kernels,
+// writes it back from the CPU cache for the LCD DMA and tells the screen
+// mirror the area now holds new pixels.
+static void copyToFramebuffer(const lv_area_t* area, uint8_t* px_map) {
     uint32_t w = (area->x2 - area->x1 + 1);
     uint32_t h = (area->y2 - area->y1 + 1);
 
-    lv_color_t* colorPtr = (lv_color_t*)px_map;
-
+    uint16_t* rowStart = gfx->getFramebuffer() + area->y1 * screenWidth;
+    uint16_t* dst = rowStart + area->x1;
+    const uint16_t* src = (const uint16_t*)px_map;
+    // A full-width strip is one contiguous run
+    uint32_t runs = w == screenWidth ? 1 : h;
+    uint32_t runLength = w == screenWidth ? w * h : w;
+    for (uint32_t run = 0; run < runs; run++, dst += screenWidth, src += w) {
 #if (LV_COLOR_16_SWAP != 0)
-    gfx->draw16bitBeRGBBitmap(area->x1, area->y1, (uint16_t*)colorPtr, w, h);
+        pixelSwap565(dst, src, runLength);
 #else
-    gfx->draw16bitRGBBitmap(area->x1, area->y1, (uint16_t*)colorPtr, w, h);
+        pixelCopy565(dst, src, runLength);
 #endif
+    }
+    Cache_WriteBack_Addr((uint32_t)rowStart, h * screenWidth * sizeof(uint16_t));
+    screenMirrorOnFlush(area);
+}
+
+// Flush function for LVGL
+void dispFlush(lv_display_t* disp, const lv_area_t* area, uint8_t* px_map) {
+    renderProfilerOnFlush(area);
+    switch (activeRenderMode) {
+    case DisplayRenderMode::DIRECT: {
+        // LVGL has already drawn into the framebuffer. Write the touched rows back
+        // from the CPU cache so the LCD DMA, which reads PSRAM directly, sees them.
+        uint16_t* rowStart = gfx->getFramebuffer() + area->y1 * screenWidth;
+        Cache_WriteBack_Addr((uint32_t)rowStart, (area->y2 - area->y1 + 1) * screenWidth * sizeof(uint16_t));
+        screenMirrorOnFlush(area);
+        lv_display_flush_ready(disp);
+        break;
+    }
+    case DisplayRenderMode::PARTIAL_ASYNC: {
+        // Completion is reported through dispFlushWait, not here
+        FlushJob job = {*area, px_map};
+        flushInFlight = true;
+        xQueueSend(flushQueue, &job, portMAX_DELAY);
+        break;
+    }
+    case DisplayRenderMode::PARTIAL:
+    default:
+        copyToFramebuffer(area, px_map);
+        lv_display_flush_ready(disp);
+        break;
+    }
+}
 
+// LVGL flush-wait callback (PARTIAL_ASYNC): called once per flush, before LVGL
+// reuses that flush's buffer. Blocking on the semaphore instead of letting LVGL
+// spin on its flushing flag frees core 1 while the copy finishes.
+static void dispFlushWait(lv_display_t* disp) {
+    xSemaphoreTake(flushDoneSem, portMAX_DELAY);
+    flushInFlight = false;
     lv_display_flush_ready(disp);
 }
 
+// Waits for the strip handed to flushCopy_t last, if it is still outstanding.
+// LVGL only waits before reusing a buffer, so after a refresh the final strip
+// can still be queued or mid-copy. Marking it ready here also stops LVGL
+// waiting for it again. Call with the LVGL lock held.
+static void drainAsyncFlush() {
+    if (flushInFlight) {
+        dispFlushWait(disp);
+    }
+}
+
+// FreeRTOS task (core 0): copies queued strips into the framebuffer and signals
+// dispFlushWait as each one completes.
+static void flushCopy_t(void* pvParameters) {
+    FlushJob job;
+    while (true) {
+        if (xQueueReceive(flushQueue, &job, portMAX_DELAY) == pdTRUE) {
+            copyToFramebuffer(&job.area, job.pxMap);
+            xSemaphoreGive(flushDoneSem);
+        }
+    }
+}
+
+// Attaches onVsync to the panel's VSYNC pin. The pin is driven by the LCD
+// peripheral, but the GPIO input path still sees it, so an edge interrupt fires
+// once per frame at the start of vertical blanking.
+static void setupVsync() {
+    vsyncSem = xSemaphoreCreateBinary();
+    if (!vsyncSem || board->lcdVsync < 0) {
+        Serial.println("Display: vsync unavailable, render task will free-run");
+        return;
+    }
+    // vsyncPolarity 0 idles low, so the pulse starts on a rising edge
+    attachInterrupt(board->lcdVsync, onVsync, board->vsyncPolarity ? FALLING : RISING);
+}
+
+static void IRAM_ATTR onVsync() {
+    BaseType_t higherPriorityTaskWoken = pdFALSE;
+    int64_t now = esp_timer_get_time();
+    if (lastVsyncUs) {
+        uint32_t interval = (uint32_t)(now - lastVsyncUs);
+        if (displayStats.vsyncs < VSYNC_SETTLE_FRAMES) {
+            vsyncPeriodUs = interval;
+        } else {
+            uint32_t tolerance = vsyncPeriodUs / VSYNC_JITTER_DIVISOR;
+            if (interval > vsyncPeriodUs + tolerance || interval + tolerance < vsyncPeriodUs) {
+                displayStats.vsyncJitter++;
+            }
+            vsyncPeriodUs = (vsyncPeriodUs * 15 + interval) / 16;
+        }
+    }
+    lastVsyncUs = now;
+    displayStats.vsyncs++;
+    xSemaphoreGiveFromISR(vsyncSem, &higherPriorityTaskWoken);
+    if (higherPriorityTaskWoken) {
+        portYIELD_FROM_ISR();
+    }
+}
+
+static uint32_t lvglTick() {
+    return millis();
+}
+
+// Times each LVGL render pass (first dirty area to last flush) and counts the
+// vsyncs that went past while it ran: each one is a scan-out of a part-drawn frame.
+// Invalidations flag a pending frame and wake the render task.
+static void onRenderEvent(lv_event_t* e) {
+    if (lv_event_get_code(e) == LV_EVENT_INVALIDATE_AREA) {
+        framePending = true;
+        if (renderTaskHandle) {
+            xTaskNotifyGive(renderTaskHandle);
+        }
+        return;
+    }
+    if (lv_event_get_code(e) == LV_EVENT_RENDER_START) {
+        renderStartUs = esp_timer_get_time();
+        renderStartVsyncs = displayStats.vsyncs;
+        return;
+    }
+    uint32_t frameUs = (uint32_t)(esp_timer_get_time() - renderStartUs);
+    displayStats.frames++;
+    displayStats.lastFrameUs = frameUs;
+    displayStats.avgFrameUs = displayStats.avgFrameUs ? (displayStats.avgFrameUs * 7 + frameUs) / 8 : frameUs;
+    if (frameUs > displayStats.maxFrameUs) {
+        displayStats.maxFrameUs = frameUs;
+    }
+    displayStats.missedVsyncs += displayStats.vsyncs - renderStartVsyncs;
+    framePending = false;
+}
+
+// FreeRTOS task (core 1): runs LVGL timers, input and rendering. Between passes
+// it sleeps until the next LVGL timer is due (as reported by lv_timer_handler)
+// or an invalidation notifies it. When a frame is pending it first waits for a
+// fresh vsync so flushing starts as the panel begins a new scan-out rather than
+// partway down the screen; if no vsync arrives within VSYNC_TIMEOUT_MS (pin not
+// wired or interrupt unavailable) it renders anyway.
+// While the display is idle LVGL isn't run at all; the task only watches for
+// the touch that wakes it, then renders on the same pass.
+static void lvglRender_t(void* pvParameters) {
+    uint32_t idleMs = 0;
+    while (true) {
+        if (displayIdle) {
+            ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(touchStats.interruptMode ? RENDER_MAX_IDLE_MS : IDLE_TOUCH_POLL_MS));
+            if (!touchedWhileIdle()) {
+                continue;
+            }
+            exitIdleMode();
+        } else {
+            ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(min(idleMs, (uint32_t)RENDER_MAX_IDLE_MS)));
+        }
+        if (framePending) {
+            xSemaphoreTake(vsyncSem, 0); // Discard an edge that fired during the last pass
+            xSemaphoreTake(vsyncSem, pdMS_TO_TICKS(VSYNC_TIMEOUT_MS));
+        }
+        lv_lock();
+        idleMs = lv_timer_handler();
+        lv_unlock();
+    }
+}
+
+// Copies between two PSRAM buffers for durationMs and returns the throughput in
+// MB/s. The buffers are far larger than the data cache, so every pass goes to PSRAM.
+static uint32_t measurePsramCopy(uint8_t* src, uint8_t* dst, uint32_t durationMs) {
+    uint64_t bytes = 0;
+    int64_t start = esp_timer_get_time();
+    int64_t end = start + (int64_t)durationMs * 1000;
+    int64_t now = start;
+    while (now < end) {
+        memcpy(dst, src, PSRAM_BENCH_BUFFER_SIZE);
+        bytes += PSRAM_BENCH_BUFFER_SIZE;
+        now = esp_timer_get_time();
+    }
+    return (uint32_t)(bytes / (uint64_t)(now - start)); // bytes per µs == MB/s
+}
+
+// FreeRTOS task (core 0): synthetic API download burst. Streams a response-sized
+// block through PSRAM the way the HTTPS client and JsonDocument do (receive
+// buffer -> String -> parse tree) until psramBurstRunning is cleared.
+static void psramBurst_t(void* pvParameters) {
+    uint8_t* rx = (uint8_t*)heap_caps_malloc(PSRAM_BENCH_BUFFER_SIZE, MALLOC_CAP_SPIRAM);
+    uint8_t* doc = (uint8_t*)heap_caps_malloc(PSRAM_BENCH_BUFFER_SIZE, MALLOC_CAP_SPIRAM);
+    uint8_t seed = 0;
+    while (rx && doc && psramBurstRunning) {
+        memset(rx, seed++, PSRAM_BENCH_BUFFER_SIZE);
+        memcpy(doc, rx, PSRAM_BENCH_BUFFER_SIZE);
+        taskYIELD();
+    }
+    free(rx);
+    free(doc);
+    xSemaphoreGive((SemaphoreHandle_t)pvParameters);
+    vTaskDelete(nullptr);
+}
+
+// Measures PSRAM copy throughput and VSYNC jitter, first idle and then during a
+// synthetic API download burst on core 0. Jitter counts VSYNC periods more than
+// 1/VSYNC_JITTER_DIVISOR off the running average; that catches a late VSYNC ISR,
+// not a scan-out underrun. VSYNC is timed by the LCD_CAM pixel clock, which keeps
+// running when the GDMA fetch from PSRAM falls behind, so an underrun shifts the
+// image without changing the period, and esp_lcd does not report one.
+// Run from the /benchmark?name=psram web endpoint to compare bounce-buffer settings.
+void runPsramBenchmark(char* report, size_t reportLen) {
+    uint8_t* src = (uint8_t*)heap_caps_malloc(PSRAM_BENCH_BUFFER_SIZE, MALLOC_CAP_SPIRAM);
+    uint8_t* dst = (uint8_t*)heap_caps_malloc(PSRAM_BENCH_BUFFER_SIZE, MALLOC_CAP_SPIRAM);
+    SemaphoreHandle_t burstDone = xSemaphoreCreateBinary();
+    if (!src || !dst || !burstDone) {
+        free(src);
+        free(dst);
+        if (burstDone) {
+            vSemaphoreDelete(burstDone);
+        }
+        snprintf(report, reportLen, "PSRAM benchmark: not enough memory");
+        logAndPublish(report);
+        return;
+    }
+    memset(src, 0xA5, PSRAM_BENCH_BUFFER_SIZE);
+
+    uint32_t jitterBefore = displayStats.vsyncJitter;
+    uint32_t idleMBs = measurePsramCopy(src, dst, PSRAM_BENCH_DURATION_MS);
+    uint32_t idleJitter = displayStats.vsyncJitter - jitterBefore;
+    esp_task_wdt_reset();
+
+    psramBurstRunning = true;
+    uint32_t loadMBs = 0;
+    uint32_t loadJitter = 0;
+    if (xTaskCreatePinnedToCore(psramBurst_t, "PSRAM Burst", TASK_STACK_SMALL, burstDone, 1, nullptr, 0) == pdPASS) {
+        jitterBefore = displayStats.vsyncJitter;
+        loadMBs = measurePsramCopy(src, dst, PSRAM_BENCH_DURATION_MS);
+        loadJitter = displayStats.vsyncJitter - jitterBefore;
+        psramBurstRunning = false;
+        xSemaphoreTake(burstDone, portMAX_DELAY);
+    }
+    psramBurstRunning = false;
+    esp_task_wdt_reset();
+
+    free(src);
+    free(dst);
+    vSemaphoreDelete(burstDone);
+
+    snprintf(report, reportLen, "PSRAM benchmark (bounce buffer %d lines): %lu MB/s idle, %lu MB/s under load; VSYNC jitter %lu idle, %lu under load",
+             board->bounceBufferLines, (unsigned long)idleMBs, (unsigned long)loadMBs, (unsigned long)idleJitter, (unsigned long)loadJitter);
+    logAndPublish(report);
+}
+
 // Initialise pins for touch and backlight
 void pinInit() {
     if (isWaveshare) {
@@ -945,15 +1249,82 @@ void touchInit(void) {
     }
     Serial.printf("Touch: GT911 found at 0x%02X\n", addr);
     ts->setRotation(ROTATION_INVERTED);
+
+    if (board->touchInt >= 0) {
+        // The GT911 pulses INT once per report while a finger is down. Trigger on
+        // both edges so it works whichever pulse polarity the chip's config holds.
+        pinMode(board->touchInt, INPUT);
+        attachInterrupt(board->touchInt, onTouchInt, CHANGE);
+    }
+    // Runs before lv_init(), so set the mode directly rather than via setTouchInterruptMode()
+    touchStats.interruptMode = board->touchInt >= 0;
+    touchStats.sinceMs = millis();
+    Serial.printf("Touch: %s mode\n", touchStats.interruptMode ? "interrupt" : "polling");
+}
+
+static void IRAM_ATTR onTouchInt() {
+    if (!touchIrqPending) {
+        touchIrqUs = esp_timer_get_time();
+        touchIrqPending = true;
+    }
+    touchStats.interrupts++;
+    // Wake the render task so LVGL reads the touch now rather than on its next indev poll
+    if (renderTaskHandle) {
+        BaseType_t higherPriorityTaskWoken = pdFALSE;
+        vTaskNotifyGiveFromISR(renderTaskHandle, &higherPriorityTaskWoken);
+        if (higherPriorityTaskWoken) {
+            portYIELD_FROM_ISR();
+        }
+    }
+}
+
+// Switches touchRead between interrupt-gated and polled I2C reads and restarts
+// the counters, so /touch-mode can compare both on the same board. Falls back
+// to polling when the board has no INT line.
+void setTouchInterruptMode(bool enable) {
+    lv_lock();
+    touchStats = {};
+    touchStats.interruptMode = enable && board->touchInt >= 0;
+    touchStats.sinceMs = millis();
+    lv_unlock();
+    Serial.printf("Touch: %s mode\n", touchStats.interruptMode ? "interrupt" : "polling");
 }
 
+// LVGL indev callback. In interrupt mode an idle screen costs no I2C traffic:
+// the GT911 is only read after INT fires, and on every poll while pressed so a
+// missed release edge can't leave a finger stuck down.
 void touchRead(lv_indev_t* indev, lv_indev_data_t* data) {
     if (!touchAvailable) {
         data->state = LV_INDEV_STATE_RELEASED;
         return;
     }
+    bool irq = touchIrqPending;
+    if (touchStats.interruptMode && !irq && !touchPressed) {
+        data->point.x = touchLastX;
+        data->point.y = touchLastY;
+        data->state = LV_INDEV_STATE_RELEASED;
+        return;
+    }
+    int64_t irqUs = touchIrqUs;
+    touchIrqPending = false;
+    i2c_bus_lock();
     ts->read();
+    i2c_bus_unlock();
+    touchStats.i2cReads++;
     if (ts->isTouched) {
+        lastTouchMs = millis();
+        if (!touchPressed) {
+            touchStats.touches++;
+            if (irq) {
+                uint32_t latencyUs = (uint32_t)(esp_timer_get_time() - irqUs);
+                touchStats.lastLatencyUs = latencyUs;
+                touchStats.avgLatencyUs = touchStats.touches == 1 ? latencyUs : (touchStats.avgLatencyUs * 7 + latencyUs) / 8;
+                if (latencyUs > touchStats.maxLatencyUs) {
+                    touchStats.maxLatencyUs = latencyUs;
+                }
+            }
+        }
+        touchPressed = true;
         touchLastX = map(ts->points[0].x, 0, 1024, 0, LCD_WIDTH);
         touchLastY = map(ts->points[0].y, 0, board->touchRawMaxY, 0, LCD_HEIGHT);
         data->point.x = touchLastX;
@@ -961,40 +1332,77 @@ void touchRead(lv_indev_t* indev, lv_indev_data_t* data) {
         data->state = LV_INDEV_STATE_PRESSED;
         ts->isTouched = false;
     } else {
+        touchPressed = false;
         data->point.x = touchLastX;
         data->state = LV_INDEV_STATE_RELEASED;
     }
 }
 
+// True once IDLE_TIMEOUT_MIN has passed without a touch inside the nightly
+// IDLE_START_HOUR..IDLE_END_HOUR window. Never idles before NTP sync.
+static bool idleDue() {
+    if (IDLE_TIMEOUT_MIN <= 0 || millis() - lastTouchMs < (uint32_t)IDLE_TIMEOUT_MIN * 60000UL) {
+        return false;
+    }
+    struct tm now;
+    if (!getLocalTime(&now, 0)) {
+        return false;
+    }
+    if (IDLE_START_HOUR <= IDLE_END_HOUR) {
+        return now.tm_hour >= IDLE_START_HOUR && now.tm_hour < IDLE_END_HOUR;
+    }
+    return now.tm_hour >= IDLE_START_HOUR || now.tm_hour < IDLE_END_HOUR;
+}
+
+// Turns the backlight off and pauses LVGL's display refresh timer; the render
+// task then stops calling lv_timer_handler(). Data collection carries on.
+static void enterIdleMode() {
+    lv_lock();
+    displayIdle = true;
+    lv_timer_pause(lv_display_get_refr_timer(disp));
+    lv_unlock();
+    setBacklightOff();
+    logAndPublish("Display idle");
+}
+
+// Checks for the touch that ends idle mode. With the INT line in use only an
+// interrupt leads to an I2C read; otherwise the controller is polled.
+static bool touchedWhileIdle() {
+    if (!touchAvailable || (touchStats.interruptMode && !touchIrqPending)) {
+        return false;
+    }
+    touchIrqPending = false;
+    i2c_bus_lock();
+    ts->read();
+    i2c_bus_unlock();
+    touchStats.i2cReads++;
+    bool touched = ts->isTouched;
+    ts->isTouched = false;
+    touchPressed = touched; // Keeps touchRead reading until the finger lifts
+    return touched;
+}
+
+// Resumes LVGL and the backlight. The waking press is swallowed so it doesn't
+// also act as a click, and loop() is woken to apply the data that arrived
+// while idle and log the wake. Runs on the render task just before it redraws,
+// so it does nothing slow itself.
+static void exitIdleMode() {
+    lv_lock();
+    lastTouchMs = millis();
+    displayIdle = false;
+    lv_timer_resume(lv_display_get_refr_timer(disp));
+    lv_indev_wait_release(touchIndev);
+    lv_unlock();
+    setBacklight(weatherIsDay());
+    xTaskNotifyGive(loopTaskHandle);
+}
+
 // Tap the time label to toggle between HH:MM:SS and day/date display.
 static void onTimeTouched(lv_event_t* e) {
     showDate = !showDate;
     if (getLocalTime(&timeinfo)) {
         char buf[CHAR_LEN];
         strftime(buf, sizeof(buf), showDate ? "%a %d %b %Y" : "%H:%M:%S", &timeinfo);
-        lv_label_set_text(ui_Time, buf);
-    }
-}
-
-void getBatteryStatus(float batteryValue, int readingIndex, char* iconChar, lv_color_t* colorPtr) {
-    if (batteryValue > BATTERY_OK) {
-        // Battery is ok
-        *iconChar = CHAR_BATTERY_GOOD;
-        *colorPtr = lv_color_hex(COLOR_GREEN);
-    } else if (batteryValue > BATTERY_BAD) {
-        // Battery is ok
-        *iconChar = CHAR_BATTERY_OK;
-        *colorPtr = lv_color_hex(COLOR_GREEN);
-    } else if (batteryValue > BATTERY_CRITICAL) {
-        // Battery is low, but not critical
-        *iconChar = CHAR_BATTERY_BAD;
-        *colorPtr = lv_color_hex(COLOR_YELLOW);
-    } else if (batteryValue > 0.0) {
-        // Battery is critical
-        *iconChar = CHAR_BATTERY_CRITICAL;
-        *colorPtr = lv_color_hex(COLOR_RED);
-    } else {
-        *iconChar = CHAR_BLANK;
-        *colorPtr = lv_color_hex(COLOR_GREEN);
+        setBoundText(statusBinding.time, buf);
     }
 }
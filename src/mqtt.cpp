@@ -3,6 +3,7 @@
 
 extern MqttClient mqttClient;
 extern SemaphoreHandle_t mqttMutex;
+extern const ReadingInfo readingInfo[];
 extern Readings readings[];
 extern const int numberOfReadings;
 extern InsideAirQuality insideAirQuality;
@@ -34,20 +35,26 @@ void receive_mqtt_messages_t(void* pvParameters) {
     esp_task_wdt_add(nullptr);
 
     int messageSize = 0;
-    char topicBuffer[CHAR_LEN];
-    char recMessage[CHAR_LEN]; // Remove = {0} here
-    int index;
+    char topicBuffer[MQTT_TOPIC_LEN + 1];
+    char recMessage[MQTT_PAYLOAD_LEN + 1];
     unsigned long lastHwmLog = 0;
+    unsigned long lastStaleScan = 0;
 
     while (true) {
         // Reset watchdog at the start of each loop iteration
         esp_task_wdt_reset();
 
+        // This task is the only writer of readings and insideAirQuality (see
+        // SeqLock.h), so it also ages them out, whether or not MQTT is connected
+        if (millis() - lastStaleScan >= STALE_SCAN_INTERVAL_MS) {
+            lastStaleScan = millis();
+            invalidateOldReadings();
+            invalidateInsideAirQuality();
+        }
+
         if (millis() - lastHwmLog > HWM_LOG_INTERVAL_MS) {
             lastHwmLog = millis();
-            char hwmMsg[CHAR_LEN];
-            snprintf(hwmMsg, CHAR_LEN, "Stack HWM: MQTT Receive %u words", uxTaskGetStackHighWaterMark(nullptr));
-            logAndPublish(hwmMsg);
+            logStackHighWaterMark("MQTT Receive");
         }
 
         // Reconnect if necessary
@@ -64,7 +71,7 @@ void receive_mqtt_messages_t(void* pvParameters) {
                 memset(recMessage, 0, sizeof(recMessage));
 
                 int topicLength = mqttClient.messageTopic().length();
-                if (topicLength >= CHAR_LEN) {
+                if (topicLength > MQTT_TOPIC_LEN) {
                     xSemaphoreGive(mqttMutex);
                     logAndPublish("MQTT topic exceeds buffer size");
                     continue;
@@ -72,7 +79,7 @@ void receive_mqtt_messages_t(void* pvParameters) {
                 mqttClient.messageTopic().toCharArray(topicBuffer, topicLength + 1);
 
                 // Check message size before reading
-                if (messageSize >= CHAR_LEN) {
+                if (messageSize > MQTT_PAYLOAD_LEN) {
                     xSemaphoreGive(mqttMutex);
                     logAndPublish("MQTT message exceeds buffer size");
                     continue;
@@ -97,33 +104,21 @@ void receive_mqtt_messages_t(void* pvParameters) {
                     continue;
                 }
 
-                bool messageProcessed = false;
-                for (int i = 0; i < numberOfReadings; i++) {
-                    if (strcmp(topicBuffer, readings[i].topic) == 0) {
-                        index = i;
-                        if (readings[i].dataType == DATA_TEMPERATURE || readings[i].dataType == DATA_HUMIDITY || readings[i].dataType == DATA_BATTERY) {
-                            updateReadings(recMessage, index, readings[i].dataType);
-                            messageProcessed = true;
-                        }
-                        break; // Found matching topic, no need to continue loop
-                    }
-                }
-
-                if (messageProcessed) {
-                    // Throttle persistence: saving ~15 KB on every sensor message wears the
+                // One hash and one strcmp whatever the number of topics (TopicTable.h)
+                const TopicEntry* entry = findTopic(topicBuffer);
+                if (entry && entry->route == TopicRoute::READING) {
+                    updateReadings(recMessage, entry->index, readingInfo[entry->index].dataType);
+                    // Throttle persistence: saving on every sensor message wears the
                     // SD card out. Readings expire after an hour anyway, so losing up to
                     // READINGS_SAVE_INTERVAL_SEC of state across a reboot is acceptable.
                     static time_t lastReadingsSave = 0;
                     time_t now = time(nullptr);
                     if (now - lastReadingsSave >= READINGS_SAVE_INTERVAL_SEC) {
                         lastReadingsSave = now;
-                        saveDataBlock(READINGS_DATA_FILENAME, readings, sizeof(Readings) * numberOfReadings);
+                        saveReadings();
                     }
-                } else if (strcmp(topicBuffer, MQTT_INSIDE_CO2_TOPIC) == 0 ||
-                           strcmp(topicBuffer, MQTT_INSIDE_PM1_TOPIC) == 0 ||
-                           strcmp(topicBuffer, MQTT_INSIDE_PM25_TOPIC) == 0 ||
-                           strcmp(topicBuffer, MQTT_INSIDE_PM10_TOPIC) == 0) {
-                    updateInsideAirQuality(topicBuffer, recMessage);
+                } else if (entry) {
+                    updateInsideAirQuality(*entry, recMessage);
                 }
             } else {
                 // No message
@@ -134,9 +129,139 @@ void receive_mqtt_messages_t(void* pvParameters) {
     }
 }
 
+// Blanks or marks stale any reading whose sensor has gone quiet
+void invalidateOldReadings() {
+    if (time(nullptr) > TIME_SYNC_THRESHOLD) {
+        time_t now = time(nullptr);
+        bool changed = false;
+        roomsLock.beginWrite();
+        for (unsigned char i = 0; i < READING_COUNT; i++) {
+            time_t age = now - readings[i].lastMessageTime;
+            if (age > MAX_NO_MESSAGE_BLANK_SEC && readings[i].readingState != ReadingState::NO_DATA) {
+                readings[i].readingState = ReadingState::NO_DATA;
+                snprintf(readings[i].output, sizeof(readings[i].output), NO_READING);
+                readings[i].currentValue = 0.0;
+                changed = true;
+            } else if (age > MAX_NO_MESSAGE_STALE_SEC && readings[i].readingState != ReadingState::STALE && readings[i].readingState != ReadingState::NO_DATA) {
+                readings[i].readingState = ReadingState::STALE;
+                changed = true;
+            }
+        }
+        roomsLock.endWrite();
+        if (changed) {
+            markDirty(dirtyRooms);
+        }
+    }
+}
+
+// Same for the kitchen CO2 and particulate sensors
+void invalidateInsideAirQuality() {
+    if (time(nullptr) <= TIME_SYNC_THRESHOLD)
+        return;
+    time_t now = time(nullptr);
+    bool changed = false;
+    insideAirQualityLock.beginWrite();
+
+    // SCD41 — CO2 sensor
+    if (insideAirQuality.co2LastMessageTime != 0) {
+        time_t age = now - insideAirQuality.co2LastMessageTime;
+        if (age > MAX_NO_MESSAGE_BLANK_SEC) {
+            if (insideAirQuality.co2State != ReadingState::NO_DATA) {
+                insideAirQuality.co2State = ReadingState::NO_DATA;
+                insideAirQuality.co2 = 0.0f;
+                changed = true;
+            }
+        } else if (age > MAX_NO_MESSAGE_STALE_SEC) {
+            if (insideAirQuality.co2State != ReadingState::STALE && insideAirQuality.co2State != ReadingState::NO_DATA) {
+                insideAirQuality.co2State = ReadingState::STALE;
+                changed = true;
+            }
+        }
+    }
+
+    // PMS5003 — particulate sensor
+    if (insideAirQuality.pmLastMessageTime != 0) {
+        time_t age = now - insideAirQuality.pmLastMessageTime;
+        if (age > MAX_NO_MESSAGE_BLANK_SEC) {
+            if (insideAirQuality.pm1State != ReadingState::NO_DATA) {
+                insideAirQuality.pm1State = ReadingState::NO_DATA;
+                insideAirQuality.pm1 = 0.0f;
+                changed = true;
+            }
+            if (insideAirQuality.pm25State != ReadingState::NO_DATA) {
+                insideAirQuality.pm25State = ReadingState::NO_DATA;
+                insideAirQuality.pm25 = 0.0f;
+                changed = true;
+            }
+            if (insideAirQuality.pm10State != ReadingState::NO_DATA) {
+                insideAirQuality.pm10State = ReadingState::NO_DATA;
+                insideAirQuality.pm10 = 0.0f;
+                changed = true;
+            }
+        } else if (age > MAX_NO_MESSAGE_STALE_SEC) {
+            if (insideAirQuality.pm1State != ReadingState::STALE && insideAirQuality.pm1State != ReadingState::NO_DATA) {
+                insideAirQuality.pm1State = ReadingState::STALE;
+                changed = true;
+            }
+            if (insideAirQuality.pm25State != ReadingState::STALE && insideAirQuality.pm25State != ReadingState::NO_DATA) {
+                insideAirQuality.pm25State = ReadingState::STALE;
+                changed = true;
+            }
+            if (insideAirQuality.pm10State != ReadingState::STALE && insideAirQuality.pm10State != ReadingState::NO_DATA) {
+                insideAirQuality.pm10State = ReadingState::STALE;
+                changed = true;
+            }
+        }
+    }
+    insideAirQualityLock.endWrite();
+    if (changed) {
+        markDirty(dirtyInsideAQ);
+    }
+}
+
+static void packSavedReading(const Readings& reading, uint32_t hash, SavedReading& saved) {
+    saved = {};
+    saved.version = SAVED_READING_VERSION;
+    saved.topicHash = hash;
+    saved.lastMessageTime = reading.lastMessageTime;
+    saved.currentValue = reading.currentValue;
+    saved.historyCount = (uint8_t)reading.history.size();
+    for (size_t i = 0; i < reading.history.size(); i++) {
+        saved.history[i] = reading.history.at(i);
+    }
+    saved.readingState = (uint8_t)reading.readingState;
+    memcpy(saved.output, reading.output, sizeof(saved.output));
+}
+
+bool unpackSavedReading(const SavedReading& saved, Readings& reading) {
+    if (saved.version != SAVED_READING_VERSION) {
+        return false;
+    }
+    reading.lastMessageTime = (time_t)saved.lastMessageTime;
+    reading.currentValue = saved.currentValue;
+    reading.history.clear();
+    for (int i = 0; i < constrain((int)saved.historyCount, 0, STORED_READING); i++) {
+        reading.history.push(saved.history[i]);
+    }
+    reading.readingState = (ReadingState)saved.readingState;
+    snprintf(reading.output, sizeof(reading.output), "%.*s", (int)sizeof(saved.output), saved.output);
+    return true;
+}
+
+// Writes the runtime state of every reading to SD, each tagged with its topic
+// hash. Works from a roomsLock snapshot so a concurrent update can't tear an
+// entry and the MQTT task is never held up by the SD write.
+bool saveReadings() {
+    static Readings current[READING_COUNT];
+    static SavedReading snapshot[MAX_READINGS];
+    roomsLock.read(current);
+    for (int i = 0; i < numberOfReadings; i++) {
+        packSavedReading(current[i], topicHash(readingInfo[i].topic), snapshot[i]);
+    }
+    return saveDataBlock(READINGS_DATA_FILENAME, snapshot, sizeof(SavedReading) * numberOfReadings);
+}
+
 void updateReadings(char* recMessage, int index, int dataType) {
-    float averageHistory;
-    float totalHistory = 0.0;
     const char* logMessageSuffix;
     const char* formatString;
 
@@ -150,7 +275,7 @@ void updateReadings(char* recMessage, int index, int dataType) {
     // so the range checks below would not catch NaN either.
     if (endptr == recMessage || *endptr != '\0' || isnan(parsedValue) || isinf(parsedValue)) {
         char logMsg[CHAR_LEN];
-        snprintf(logMsg, CHAR_LEN, "Invalid numeric value received: '%s' for %s", recMessage, readings[index].description);
+        snprintf(logMsg, CHAR_LEN, "Invalid numeric value received: '%s' for %s", recMessage, readingInfo[index].description);
         logAndPublish(logMsg);
         return;
     }
@@ -158,19 +283,19 @@ void updateReadings(char* recMessage, int index, int dataType) {
     // Sanity check for reasonable sensor values
     if (dataType == DATA_TEMPERATURE && (parsedValue < TEMP_MIN_VALID || parsedValue > TEMP_MAX_VALID)) {
         char logMsg[CHAR_LEN];
-        snprintf(logMsg, CHAR_LEN, "Temperature out of range: %.1f for %s", parsedValue, readings[index].description);
+        snprintf(logMsg, CHAR_LEN, "Temperature out of range: %.1f for %s", parsedValue, readingInfo[index].description);
         logAndPublish(logMsg);
         return;
     }
     if (dataType == DATA_HUMIDITY && (parsedValue < 0.0f || parsedValue > HUMIDITY_MAX_VALID)) {
         char logMsg[CHAR_LEN];
-        snprintf(logMsg, CHAR_LEN, "Humidity out of range: %.1f for %s", parsedValue, readings[index].description);
+        snprintf(logMsg, CHAR_LEN, "Humidity out of range: %.1f for %s", parsedValue, readingInfo[index].description);
         logAndPublish(logMsg);
         return;
     }
     if (dataType == DATA_BATTERY && (parsedValue < 0.0f || parsedValue > BATTERY_MAX_VALID_V)) {
         char logMsg[CHAR_LEN];
-        snprintf(logMsg, CHAR_LEN, "Battery voltage out of range: %.2f for %s", parsedValue, readings[index].description);
+        snprintf(logMsg, CHAR_LEN, "Battery voltage out of range: %.2f for %s", parsedValue, readingInfo[index].description);
         logAndPublish(logMsg);
         return;
     }
@@ -197,11 +322,6 @@ void updateReadings(char* recMessage, int index, int dataType) {
         }
     }
 
-    // Hold dataMutex while mutating the reading — the display loop reads these
-    // fields and a preemption mid-snprintf would show a torn string.
-    xSemaphoreTake(dataMutex, portMAX_DELAY);
-    readings[index].currentValue = parsedValue;
-
     // Set format string and log suffix based on data type
     switch (dataType) {
     case DATA_TEMPERATURE:
@@ -218,69 +338,55 @@ void updateReadings(char* recMessage, int index, int dataType) {
         break;
     default:
         // Handle unknown data type
-        xSemaphoreGive(dataMutex);
         return;
     }
 
+    // The display loop snapshots readings through roomsLock; a preemption
+    // mid-snprintf makes it retry rather than show a torn string.
+    roomsLock.beginWrite();
+    readings[index].currentValue = parsedValue;
+
     if (dataType == DATA_HUMIDITY) {
         snprintf(readings[index].output, sizeof(readings[index].output), formatString, readings[index].currentValue, "%");
     } else {
         snprintf(readings[index].output, sizeof(readings[index].output), formatString, readings[index].currentValue);
     }
 
-    if (readings[index].readingIndex == 0) {
+    if (readings[index].history.empty()) {
         readings[index].readingState = ReadingState::FIRST_READING;
-        readings[index].lastValue[0] = readings[index].currentValue;
-    } else {
-        for (int i = 0; i < readings[index].readingIndex; i++) {
-            totalHistory += readings[index].lastValue[i];
-        }
-        averageHistory = totalHistory / readings[index].readingIndex;
-
+    } else if (dataType == DATA_TEMPERATURE || dataType == DATA_HUMIDITY) {
         // Only update trend state for temperature and humidity
-        if (dataType == DATA_TEMPERATURE || dataType == DATA_HUMIDITY) {
-            if (readings[index].currentValue > averageHistory) {
-                readings[index].readingState = ReadingState::TRENDING_UP;
-            } else if (readings[index].currentValue < averageHistory) {
-                readings[index].readingState = ReadingState::TRENDING_DOWN;
-            } else {
-                readings[index].readingState = ReadingState::STABLE;
-            }
-        }
-    }
-
-    if (readings[index].readingIndex == STORED_READING) {
-        readings[index].readingIndex--;
-        readings[index].hasEnoughData = true;
-        for (int i = 0; i < STORED_READING - 1; i++) {
-            readings[index].lastValue[i] = readings[index].lastValue[i + 1];
+        float averageHistory = readings[index].history.mean();
+        if (readings[index].currentValue > averageHistory) {
+            readings[index].readingState = ReadingState::TRENDING_UP;
+        } else if (readings[index].currentValue < averageHistory) {
+            readings[index].readingState = ReadingState::TRENDING_DOWN;
+        } else {
+            readings[index].readingState = ReadingState::STABLE;
         }
-    } else {
-        readings[index].hasEnoughData = false;
     }
 
-    readings[index].lastValue[readings[index].readingIndex] = readings[index].currentValue;
-    readings[index].readingIndex++;
+    readings[index].history.push(readings[index].currentValue);
     readings[index].lastMessageTime = time(nullptr);
-    xSemaphoreGive(dataMutex);
-    dirtyRooms = true;
+    roomsLock.endWrite();
+    markDirty(dirtyRooms);
 
     if (valueChanged) {
         char logMessage[CHAR_LEN];
-        snprintf(logMessage, CHAR_LEN, "%s %s updated: %.1f", readings[index].description, logMessageSuffix, parsedValue);
+        snprintf(logMessage, CHAR_LEN, "%s %s updated: %.1f", readingInfo[index].description, logMessageSuffix, parsedValue);
         logAndPublish(logMessage);
         lastLoggedValue[index] = parsedValue;
         hasLoggedBefore[index] = true;
     }
 }
 
-void updateInsideAirQuality(const char* topic, char* recMessage) {
+void updateInsideAirQuality(const TopicEntry& entry, char* recMessage) {
     char* endptr;
     float parsedValue = strtof(recMessage, &endptr);
 
     if (endptr == recMessage || *endptr != '\0' || isnan(parsedValue) || isinf(parsedValue)) {
         char logMsg[CHAR_LEN];
-        snprintf(logMsg, CHAR_LEN, "Invalid inside AQ value: '%s' on %s", recMessage, topic);
+        snprintf(logMsg, CHAR_LEN, "Invalid inside AQ value: '%s' on %s", recMessage, entry.topic);
         logAndPublish(logMsg);
         return;
     }
@@ -289,56 +395,56 @@ void updateInsideAirQuality(const char* topic, char* recMessage) {
     char logMsg[CHAR_LEN];
     bool valueChanged = false;
 
-    if (strcmp(topic, MQTT_INSIDE_CO2_TOPIC) == 0) {
+    if (entry.route == TopicRoute::INSIDE_CO2) {
         if (parsedValue < CO2_MIN_VALID || parsedValue > CO2_MAX_VALID) {
             snprintf(logMsg, CHAR_LEN, "Inside CO2 out of range: %.0f ppm", parsedValue);
             logAndPublish(logMsg);
             return;
         }
-        xSemaphoreTake(dataMutex, portMAX_DELAY);
+        insideAirQualityLock.beginWrite();
         insideAirQuality.co2 = parsedValue;
         insideAirQuality.co2State = ReadingState::FIRST_READING;
         insideAirQuality.co2LastMessageTime = now;
-        xSemaphoreGive(dataMutex);
+        insideAirQualityLock.endWrite();
         snprintf(logMsg, CHAR_LEN, "Inside CO2: %.0f ppm", parsedValue);
         valueChanged = updateInsideTracking(parsedValue, &lastLoggedInsideCO2, &hasLoggedInsideCO2, LOG_CHANGE_THRESHOLD_CO2);
-    } else if (strcmp(topic, MQTT_INSIDE_PM1_TOPIC) == 0) {
+    } else if (entry.route == TopicRoute::INSIDE_PM1) {
         if (parsedValue < 0.0f || parsedValue > PM_MAX_VALID) {
             snprintf(logMsg, CHAR_LEN, "Inside PM1 out of range: %.1f ug/m3", parsedValue);
             logAndPublish(logMsg);
             return;
         }
-        xSemaphoreTake(dataMutex, portMAX_DELAY);
+        insideAirQualityLock.beginWrite();
         insideAirQuality.pm1 = parsedValue;
         insideAirQuality.pm1State = ReadingState::FIRST_READING;
         insideAirQuality.pmLastMessageTime = now;
-        xSemaphoreGive(dataMutex);
+        insideAirQualityLock.endWrite();
         snprintf(logMsg, CHAR_LEN, "Inside PM1: %.1f ug/m3", parsedValue);
         valueChanged = updateInsideTracking(parsedValue, &lastLoggedInsidePM1, &hasLoggedInsidePM1, LOG_CHANGE_THRESHOLD_PM);
-    } else if (strcmp(topic, MQTT_INSIDE_PM25_TOPIC) == 0) {
+    } else if (entry.route == TopicRoute::INSIDE_PM25) {
         if (parsedValue < 0.0f || parsedValue > PM_MAX_VALID) {
             snprintf(logMsg, CHAR_LEN, "Inside PM2.5 out of range: %.1f ug/m3", parsedValue);
             logAndPublish(logMsg);
             return;
         }
-        xSemaphoreTake(dataMutex, portMAX_DELAY);
+        insideAirQualityLock.beginWrite();
         insideAirQuality.pm25 = parsedValue;
         insideAirQuality.pm25State = ReadingState::FIRST_READING;
         insideAirQuality.pmLastMessageTime = now;
-        xSemaphoreGive(dataMutex);
+        insideAirQualityLock.endWrite();
         snprintf(logMsg, CHAR_LEN, "Inside PM2.5: %.1f ug/m3", parsedValue);
         valueChanged = updateInsideTracking(parsedValue, &lastLoggedInsidePM25, &hasLoggedInsidePM25, LOG_CHANGE_THRESHOLD_PM);
-    } else if (strcmp(topic, MQTT_INSIDE_PM10_TOPIC) == 0) {
+    } else if (entry.route == TopicRoute::INSIDE_PM10) {
         if (parsedValue < 0.0f || parsedValue > PM_MAX_VALID) {
             snprintf(logMsg, CHAR_LEN, "Inside PM10 out of range: %.1f ug/m3", parsedValue);
             logAndPublish(logMsg);
             return;
         }
-        xSemaphoreTake(dataMutex, portMAX_DELAY);
+        insideAirQualityLock.beginWrite();
         insideAirQuality.pm10 = parsedValue;
         insideAirQuality.pm10State = ReadingState::FIRST_READING;
         insideAirQuality.pmLastMessageTime = now;
-        xSemaphoreGive(dataMutex);
+        insideAirQualityLock.endWrite();
         snprintf(logMsg, CHAR_LEN, "Inside PM10: %.1f ug/m3", parsedValue);
         valueChanged = updateInsideTracking(parsedValue, &lastLoggedInsidePM10, &hasLoggedInsidePM10, LOG_CHANGE_THRESHOLD_PM);
     } else {
@@ -347,7 +453,7 @@ void updateInsideAirQuality(const char* topic, char* recMessage) {
     if (valueChanged) {
         logAndPublish(logMsg);
     }
-    dirtyInsideAQ = true;
+    markDirty(dirtyInsideAQ);
     // Throttled for the same SD-wear reason as the readings save above
     static time_t lastInsideAQSave = 0;
     if (now - lastInsideAQSave >= READINGS_SAVE_INTERVAL_SEC) {
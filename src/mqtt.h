@@ -1,12 +1,19 @@
 #ifndef MQTT_H
 #define MQTT_H
 
+#include "TopicTable.h"
 #include "types.h"
 #include <ArduinoMqttClient.h>
 #include <WiFi.h>
 
 void receive_mqtt_messages_t(void* pvParameters);
 void updateReadings(char* recMessage, int index, int dataType);
-void updateInsideAirQuality(const char* topic, char* recMessage);
+void updateInsideAirQuality(const TopicEntry& entry, char* recMessage);
+bool saveReadings();
+// Copies a READINGS_DATA_FILENAME entry into reading; false if it is another layout version
+bool unpackSavedReading(const SavedReading& saved, Readings& reading);
+// Staleness scans; run from receive_mqtt_messages_t, or before it starts
+void invalidateOldReadings();
+void invalidateInsideAirQuality();
 
 #endif // MQTT_H
@@ -2,6 +2,9 @@
 #define TYPES_H
 
 // Lightweight universal headers - safe to include everywhere
+#include "FixedString.h"
+#include "RingHistory.h"
+#include "SeqLock.h"
 #include "config.h"
 #include "constants.h"
 #include "logging.h"
@@ -19,9 +22,46 @@
 #include <stdint.h>
 #include <time.h>
 
-struct __attribute__((packed)) Readings {
-    const char description[CHAR_LEN];
-    const char topic[CHAR_LEN];
+// Sensor metadata, fixed at compile time (READING_INFO_ARRAY) and kept in flash
+struct ReadingInfo {
+    const char* description;
+    const char* topic;
+    int dataType;
+};
+
+// Runtime state of one sensor reading: the only part locked, scanned and saved
+// to SD. Its layout depends on the ABI, so it is saved through SavedReading.
+struct Readings {
+    time_t lastMessageTime;
+    float currentValue;
+    RingHistory<float, STORED_READING> history; // Earlier values, for the trend against their mean
+    ReadingState readingState = ReadingState::NO_DATA;
+    char output[READING_OUTPUT_LEN] = NO_READING;
+};
+
+// One entry of READINGS_DATA_FILENAME. Fields are written one by one with
+// fixed widths (Readings itself has padding and a time_t whose size depends
+// on the IDF), so the file doesn't change with the compiler or core version.
+// The topic hash lets restoreReadings skip entries whose topic changed since
+// the file was written; the version lets it skip entries of another layout.
+// Changing a field means bumping SAVED_READING_VERSION and the size below.
+struct __attribute__((packed)) SavedReading {
+    uint8_t version;
+    uint32_t topicHash;
+    int64_t lastMessageTime;
+    float currentValue;
+    float history[STORED_READING]; // Oldest first
+    uint8_t historyCount;
+    uint8_t readingState;
+    char output[READING_OUTPUT_LEN];
+};
+static_assert(sizeof(SavedReading) == 19 + 4 * STORED_READING + READING_OUTPUT_LEN, "SavedReading layout changed; bump SAVED_READING_VERSION");
+
+// Entry layout of READINGS_DATA_FILENAME before metadata and state were split;
+// only read, to migrate an old file on the first boot of a newer firmware.
+struct __attribute__((packed)) LegacyReadings {
+    char description[CHAR_LEN];
+    char topic[CHAR_LEN];
     char output[CHAR_LEN];
     float currentValue;
     float lastValue[STORED_READING];
@@ -39,15 +79,15 @@ struct __attribute__((packed)) Weather {
     float minTemp;
     bool isDay;
     time_t updateTime;
-    char windDir[CHAR_LEN];
-    char description[CHAR_LEN];
-    char timeString[CHAR_LEN];
+    FixedString<WIND_DIR_LEN> windDir;
+    FixedString<WEATHER_TEXT_LEN> description;
+    FixedString<TIME_STRING_LEN> timeString;
 };
 
 struct __attribute__((packed)) UV {
     int index;
     time_t updateTime;
-    char timeString[CHAR_LEN];
+    FixedString<TIME_STRING_LEN> timeString;
 };
 
 struct __attribute__((packed)) AirQuality {
@@ -56,7 +96,7 @@ struct __attribute__((packed)) AirQuality {
     float ozone;
     int europeanAqi;
     time_t updateTime;
-    char timeString[CHAR_LEN];
+    FixedString<TIME_STRING_LEN> timeString;
 };
 
 // Indoor air quality from inside sensor (SCD41 CO2 + PMS5003 particulates)
@@ -82,7 +122,7 @@ struct __attribute__((packed)) Solar {
     float gridPower;
     float batteryPower;
     float solarPower;
-    char time[CHAR_LEN];
+    FixedString<TIME_STRING_LEN> time;
     float todayBatteryMin;
     float todayBatteryMax;
     bool isMinMaxReset;
@@ -106,13 +146,13 @@ struct __attribute__((packed)) DataHeader {
 };
 
 struct StatusMessage {
-    char text[CHAR_LEN];
+    FixedString<STATUS_TEXT_LEN> text;
     int durationSec;
 };
 
 struct SDLogMessage {
-    char message[CHAR_LEN];
-    char filename[50];
+    FixedString<CHAR_LEN> message;
+    FixedString<LOG_FILENAME_LEN> filename;
 };
 
 struct LogEntry {
@@ -120,17 +160,51 @@ struct LogEntry {
     time_t timestamp;
 };
 
-// Guards the shared data structs (readings, weather, uv, solar, airQuality,
-// insideAirQuality, statusMessageValue) against torn reads between the producer
-// tasks (MQTT, API, status) and the display loop. Hold only around the actual
-// struct reads/writes — never across HTTP or SD card operations.
-extern SemaphoreHandle_t dataMutex;
+// One sequence lock per shared data group, so the producer tasks (MQTT, API,
+// status) never wait on the display loop. Each group has a single producer task,
+// which wraps its field updates in beginWrite()/endWrite(); every other task
+// takes a snapshot with read() and works from the copy. Keep HTTP, SD card,
+// logging and markDirty() outside a write.
+extern SeqLock<Readings[READING_COUNT]> roomsLock;
+extern SeqLock<Weather> weatherLock;
+extern SeqLock<UV> uvLock;
+extern SeqLock<AirQuality> airQualityLock;
+extern SeqLock<InsideAirQuality> insideAirQualityLock;
+extern SeqLock<Solar> solarLock;
+extern SeqLock<FixedString<STATUS_TEXT_LEN>> statusLock;
 
-// Dirty flags for display update groups (set by data producers, cleared by loop)
+// Dirty flags for display update groups (set by data producers via markDirty, cleared by loop)
 extern std::atomic<bool> dirtyRooms;
 extern std::atomic<bool> dirtySolar;
 extern std::atomic<bool> dirtyWeather;
 extern std::atomic<bool> dirtyUv;
 extern std::atomic<bool> dirtyInsideAQ;
+extern std::atomic<bool> dirtyStatusMessage;
+void markDirty(std::atomic<bool>& flag);
+
+// Render task counters (written by lvglRender_t and the vsync ISR, read by the web server)
+struct DisplayStats {
+    volatile uint32_t vsyncs;        // VSYNC edges seen since boot
+    volatile uint32_t missedVsyncs;  // VSYNC edges that fell inside a render pass
+    volatile uint32_t vsyncJitter;   // VSYNC periods well off the running average (late ISRs, not PSRAM underruns)
+    uint32_t frames;                 // Completed LVGL render passes
+    uint32_t lastFrameUs;            // Duration of the most recent render pass
+    uint32_t avgFrameUs;             // Moving average, 1/8 weight per frame
+    uint32_t maxFrameUs;             // Longest render pass since boot
+};
+extern DisplayStats displayStats;
+
+// Touch input counters, reset whenever the touch mode changes
+struct TouchStats {
+    bool interruptMode;           // true: read the GT911 only after INT; false: read on every LVGL poll
+    uint32_t sinceMs;             // millis() when the current mode started
+    volatile uint32_t interrupts; // GT911 INT edges
+    uint32_t i2cReads;            // GT911 register reads issued by touchRead
+    uint32_t touches;             // Released-to-pressed transitions
+    uint32_t lastLatencyUs;       // INT edge to LVGL seeing the press, most recent touch
+    uint32_t avgLatencyUs;        // Moving average, 1/8 weight per touch
+    uint32_t maxLatencyUs;        // Worst latency in the current mode
+};
+extern TouchStats touchStats;
 
 #endif // TYPES_H
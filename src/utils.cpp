@@ -207,6 +207,11 @@ uint8_t calculateChecksum(const void* dataPtr, size_t size) {
     return sum;
 }
 
+int backlightDuty(float brightness, int maxDuty) {
+    brightness = brightness < 0.0f ? 0.0f : (brightness > 1.0f ? 1.0f : brightness);
+    return (int)(maxDuty * (1.0f - brightness));
+}
+
 // Compares two semantic version strings (e.g. "4.1.35" vs "4.1.36").
 // Returns 1 if v1 > v2, -1 if v1 < v2, 0 if equal.
 // Parses each dotted component as a decimal integer and compares left to right,
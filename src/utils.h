@@ -2,6 +2,7 @@
 #define UTILS_H
 
 // Pure utility functions - no hardware dependencies, fully unit-testable on native builds
+#include "FixedString.h"
 #include <cmath>
 #include <cstdio>
 #include <cstring>
@@ -24,6 +25,22 @@ void formatIntegerWithCommas(long long num, char* out, size_t outSize);
 // XOR checksum over a byte range
 uint8_t calculateChecksum(const void* dataPtr, size_t size);
 
+// 32-bit FNV-1a of a NUL-terminated string. Identifies a topic in the readings
+// file without storing the string (a collision only means an old entry is
+// restored for a renamed topic) and indexes the MQTT dispatch table, which is
+// built from it at compile time (TopicTable.h).
+constexpr uint32_t topicHash(const char* topic) {
+    uint32_t hash = 2166136261u;
+    for (; *topic; ++topic) {
+        hash = (hash ^ (uint8_t)*topic) * 16777619u;
+    }
+    return hash;
+}
+
+// PWM duty for a backlight brightness (0.0 off .. 1.0 full) on the Matouch,
+// whose backlight input is active-low: full brightness is duty 0
+int backlightDuty(float brightness, int maxDuty);
+
 // Semantic version comparison ("major.minor.patch"); returns 1, 0, or -1
 int compareVersionsStr(const char* v1, const char* v2);
 
@@ -35,5 +52,10 @@ const char* getWiFiIcon(int rssi);
 
 // Format a time_t as "HH:MM:SS" into buf
 void formatTimeHMS(time_t t, char* buf, size_t bufSize);
+template <size_t N> void formatTimeHMS(time_t t, FixedString<N>& out) {
+    char buf[sizeof("HH:MM:SS")];
+    formatTimeHMS(t, buf, sizeof(buf));
+    out = buf;
+}
 
 #endif // UTILS_H
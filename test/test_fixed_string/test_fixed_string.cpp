@@ -0,0 +1,103 @@
+#include <unity.h>
+#include "FixedString.h"
+#include <type_traits>
+
+void setUp(void) {}
+void tearDown(void) {}
+
+// Byte-aligned and copyable with memcpy, so it can sit in packed SD structs and queue items
+static_assert(sizeof(FixedString<8>) == 10, "8 characters, terminator and length");
+static_assert(alignof(FixedString<8>) == 1, "no padding in packed structs");
+static_assert(std::is_trivially_copyable<FixedString<8>>::value, "safe to memcpy and queue");
+
+// --- assign / append ---
+void test_starts_empty() {
+    FixedString<8> s;
+    TEST_ASSERT_TRUE(s.empty());
+    TEST_ASSERT_EQUAL_STRING("", s.c_str());
+}
+void test_assign_fits() {
+    FixedString<8> s;
+    TEST_ASSERT_TRUE(s.assign("12:34:56"));
+    TEST_ASSERT_EQUAL_STRING("12:34:56", s.c_str());
+    TEST_ASSERT_EQUAL(8, s.length());
+}
+void test_assign_truncates() {
+    FixedString<4> s("Overcast");
+    TEST_ASSERT_EQUAL_STRING("Over", s.c_str());
+    TEST_ASSERT_FALSE(s.assign("Overcast"));
+}
+void test_append_truncates() {
+    FixedString<6> s("abc");
+    TEST_ASSERT_TRUE(s.append("de"));
+    TEST_ASSERT_FALSE(s.append("fgh"));
+    TEST_ASSERT_EQUAL_STRING("abcdef", s.c_str());
+    TEST_ASSERT_EQUAL(6, s.length());
+    TEST_ASSERT_FALSE(s.append("x"));
+    TEST_ASSERT_EQUAL_STRING("abcdef", s.c_str());
+}
+
+// --- format / appendf ---
+void test_format_replaces() {
+    FixedString<16> s("old text");
+    TEST_ASSERT_TRUE(s.format("UV %d", 7));
+    TEST_ASSERT_EQUAL_STRING("UV 7", s.c_str());
+    TEST_ASSERT_EQUAL(4, s.length());
+}
+void test_appendf_keeps_length() {
+    FixedString<16> s("Wind");
+    TEST_ASSERT_TRUE(s.appendf(" %2.0f km/h", 12.0));
+    TEST_ASSERT_TRUE(s.appendf(" %s", "NW"));
+    TEST_ASSERT_EQUAL_STRING("Wind 12 km/h NW", s.c_str());
+    TEST_ASSERT_EQUAL(15, s.length());
+}
+void test_format_truncates() {
+    FixedString<5> s;
+    TEST_ASSERT_FALSE(s.format("%d", 1234567));
+    TEST_ASSERT_EQUAL_STRING("12345", s.c_str());
+    TEST_ASSERT_EQUAL(5, s.length());
+}
+
+// --- UTF-8 ---
+void test_truncation_drops_cut_character() {
+    FixedString<3> s;
+    TEST_ASSERT_FALSE(s.format("%2.0f°C", 21.0)); // Room for "21" and half of the two-byte °
+    TEST_ASSERT_EQUAL_STRING("21", s.c_str());
+    TEST_ASSERT_EQUAL(2, s.length());
+}
+void test_truncation_keeps_whole_character() {
+    FixedString<4> s;
+    TEST_ASSERT_FALSE(s.assign("21°CX"));
+    TEST_ASSERT_EQUAL_STRING("21°", s.c_str());
+}
+
+// --- comparison / copy ---
+void test_compare_and_copy() {
+    FixedString<8> a("SE");
+    FixedString<8> b = a;
+    TEST_ASSERT_TRUE(b == "SE");
+    TEST_ASSERT_TRUE(b != "S");
+    a.clear();
+    TEST_ASSERT_TRUE(a.empty());
+    TEST_ASSERT_EQUAL_STRING("SE", b.c_str());
+}
+
+int main() {
+    UNITY_BEGIN();
+
+    RUN_TEST(test_starts_empty);
+    RUN_TEST(test_assign_fits);
+    RUN_TEST(test_assign_truncates);
+    RUN_TEST(test_append_truncates);
+
+    RUN_TEST(test_format_replaces);
+    RUN_TEST(test_appendf_keeps_length);
+    RUN_TEST(test_format_truncates);
+
+    RUN_TEST(test_truncation_drops_cut_character);
+    RUN_TEST(test_truncation_keeps_whole_character);
+
+    RUN_TEST(test_compare_and_copy);
+
+    return UNITY_END();
+}
@@ -0,0 +1,191 @@
+#include <unity.h>
+#include "PixelKernels.h"
+#include <cstring>
+
+void setUp(void) {}
+void tearDown(void) {}
+
+// Per-pixel references. Each kernel runs over every length up to MAX_LEN and
+// every start offset up to 15 pixels, so word and 16-byte heads and tails are
+// all covered; guard pixels either side must be left alone.
+static const size_t MAX_LEN = 70;
+static const size_t MAX_OFFSET = 16;
+static const size_t BUF_LEN = MAX_LEN + MAX_OFFSET + 2;
+static const uint16_t GUARD = 0xDEAD;
+
+alignas(16) static uint16_t src[BUF_LEN];
+alignas(16) static uint16_t expected[BUF_LEN];
+alignas(16) static uint16_t actual[BUF_LEN];
+
+static uint16_t refSwap(uint16_t c) {
+    return (uint16_t)(c << 8 | c >> 8);
+}
+
+// lv_color_16_16_mix() from LVGL, which the blend kernel must reproduce exactly
+static uint16_t refMix(uint16_t c1, uint16_t c2, uint8_t mix) {
+    if (mix == 255) return c1;
+    if (mix == 0) return c2;
+    if (c1 == c2) return c1;
+    mix = (uint32_t)((uint32_t)mix + 4) >> 3;
+    uint32_t bg = (uint32_t)(c2 | ((uint32_t)c2 << 16)) & 0x7E0F81F;
+    uint32_t fg = (uint32_t)(c1 | ((uint32_t)c1 << 16)) & 0x7E0F81F;
+    uint32_t result = ((((fg - bg) * mix) >> 5) + bg) & 0x7E0F81F;
+    return (uint16_t)(result >> 16) | result;
+}
+
+static void fillSource() {
+    for (size_t i = 0; i < BUF_LEN; i++) {
+        src[i] = (uint16_t)(i * 40503u + 0x1234);
+    }
+}
+
+static void resetBuffers() {
+    for (size_t i = 0; i < BUF_LEN; i++) {
+        expected[i] = actual[i] = (uint16_t)(GUARD ^ i);
+    }
+}
+
+// --- swap / copy ---
+void test_swap_matches_reference() {
+    fillSource();
+    for (size_t offset = 0; offset < MAX_OFFSET; offset++) {
+        for (size_t len = 0; len <= MAX_LEN; len++) {
+            resetBuffers();
+            for (size_t i = 0; i < len; i++) expected[1 + offset + i] = refSwap(src[offset + i]);
+            pixelSwap565(actual + 1 + offset, src + offset, len);
+            TEST_ASSERT_EQUAL_HEX16_ARRAY(expected, actual, BUF_LEN);
+        }
+    }
+}
+
+void test_swap_portable_matches_reference() {
+    fillSource();
+    for (size_t offset = 0; offset < 4; offset++) {
+        for (size_t len = 0; len <= MAX_LEN; len++) {
+            resetBuffers();
+            for (size_t i = 0; i < len; i++) expected[offset + i] = refSwap(src[offset + i]);
+            pixelSwap565Portable(actual + offset, src + offset, len);
+            TEST_ASSERT_EQUAL_HEX16_ARRAY(expected, actual, BUF_LEN);
+        }
+    }
+}
+
+void test_copy_matches_reference() {
+    fillSource();
+    for (size_t srcOffset = 0; srcOffset < MAX_OFFSET; srcOffset += 3) {
+        for (size_t offset = 0; offset < MAX_OFFSET; offset++) {
+            for (size_t len = 0; len <= MAX_LEN; len++) {
+                resetBuffers();
+                for (size_t i = 0; i < len; i++) expected[1 + offset + i] = src[srcOffset + i];
+                pixelCopy565(actual + 1 + offset, src + srcOffset, len);
+                TEST_ASSERT_EQUAL_HEX16_ARRAY(expected, actual, BUF_LEN);
+            }
+        }
+    }
+}
+
+void test_copy_vector_matches_reference() {
+    // Equal misalignment takes the block path, the rest fall back to memcpy
+    fillSource();
+    for (size_t srcOffset = 0; srcOffset < MAX_OFFSET; srcOffset++) {
+        for (size_t offset = 0; offset < MAX_OFFSET; offset++) {
+            for (size_t len = 0; len <= MAX_LEN; len++) {
+                resetBuffers();
+                for (size_t i = 0; i < len; i++) expected[offset + i] = src[srcOffset + i];
+                pixelCopy565Vector(actual + offset, src + srcOffset, len);
+                TEST_ASSERT_EQUAL_HEX16_ARRAY(expected, actual, BUF_LEN);
+            }
+        }
+    }
+}
+
+// --- fill ---
+void test_fill_matches_reference() {
+    for (size_t offset = 0; offset < MAX_OFFSET; offset++) {
+        for (size_t len = 0; len <= MAX_LEN; len++) {
+            resetBuffers();
+            for (size_t i = 0; i < len; i++) expected[1 + offset + i] = 0xF81F;
+            pixelFill565(actual + 1 + offset, 0xF81F, len);
+            TEST_ASSERT_EQUAL_HEX16_ARRAY(expected, actual, BUF_LEN);
+        }
+    }
+}
+
+void test_fill_portable_matches_reference() {
+    for (size_t offset = 0; offset < 4; offset++) {
+        for (size_t len = 0; len <= MAX_LEN; len++) {
+            resetBuffers();
+            for (size_t i = 0; i < len; i++) expected[offset + i] = 0x07E0;
+            pixelFill565Portable(actual + offset, 0x07E0, len);
+            TEST_ASSERT_EQUAL_HEX16_ARRAY(expected, actual, BUF_LEN);
+        }
+    }
+}
+
+void test_fill_vector_matches_reference() {
+    for (size_t offset = 0; offset < MAX_OFFSET; offset++) {
+        for (size_t len = 0; len <= MAX_LEN; len++) {
+            resetBuffers();
+            for (size_t i = 0; i < len; i++) expected[offset + i] = 0x001F;
+            pixelFill565Vector(actual + offset, 0x001F, len);
+            TEST_ASSERT_EQUAL_HEX16_ARRAY(expected, actual, BUF_LEN);
+        }
+    }
+}
+
+// --- blend ---
+void test_blend_matches_lvgl_mix() {
+    static const uint8_t opacities[] = {0, 1, 3, 4, 64, 127, 128, 200, 251, 252, 254, 255};
+    static const uint16_t colors[] = {0x0000, 0xFFFF, 0xF800, 0x07E0, 0x001F, 0x8410, 0x1234};
+    fillSource();
+    for (uint8_t opa : opacities) {
+        for (uint16_t color : colors) {
+            memcpy(expected, src, sizeof(src));
+            memcpy(actual, src, sizeof(src));
+            expected[5] = actual[5] = color; // Same colour as the fill is left as is
+            for (size_t i = 1; i < BUF_LEN - 1; i++) expected[i] = refMix(color, expected[i], opa);
+            pixelBlend565(actual + 1, color, opa, BUF_LEN - 2);
+            TEST_ASSERT_EQUAL_HEX16_ARRAY(expected, actual, BUF_LEN);
+        }
+    }
+}
+
+// --- rectangles ---
+void test_fill_rect_respects_stride() {
+    const int32_t w = 5, h = 4, stridePixels = 9;
+    resetBuffers();
+    for (int32_t y = 0; y < h; y++)
+        for (int32_t x = 0; x < w; x++) expected[y * stridePixels + x] = 0xABCD;
+    pixelFillRect565(actual, w, h, stridePixels * sizeof(uint16_t), 0xABCD);
+    TEST_ASSERT_EQUAL_HEX16_ARRAY(expected, actual, BUF_LEN);
+}
+
+void test_copy_rect_respects_strides() {
+    const int32_t w = 6, h = 3, srcStridePixels = 11, dstStridePixels = 8;
+    fillSource();
+    resetBuffers();
+    for (int32_t y = 0; y < h; y++)
+        for (int32_t x = 0; x < w; x++) expected[y * dstStridePixels + x] = src[y * srcStridePixels + x];
+    pixelCopyRect565(actual, dstStridePixels * sizeof(uint16_t), src, srcStridePixels * sizeof(uint16_t), w, h);
+    TEST_ASSERT_EQUAL_HEX16_ARRAY(expected, actual, BUF_LEN);
+}
+
+int main() {
+    UNITY_BEGIN();
+
+    RUN_TEST(test_swap_matches_reference);
+    RUN_TEST(test_swap_portable_matches_reference);
+    RUN_TEST(test_copy_matches_reference);
+    RUN_TEST(test_copy_vector_matches_reference);
+
+    RUN_TEST(test_fill_matches_reference);
+    RUN_TEST(test_fill_portable_matches_reference);
+    RUN_TEST(test_fill_vector_matches_reference);
+
+    RUN_TEST(test_blend_matches_lvgl_mix);
+
+    RUN_TEST(test_fill_rect_respects_stride);
+    RUN_TEST(test_copy_rect_respects_strides);
+
+    return UNITY_END();
+}
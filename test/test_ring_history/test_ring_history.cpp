@@ -0,0 +1,136 @@
+#include <unity.h>
+#include "RingHistory.h"
+#include <cmath>
+#include <type_traits>
+
+void setUp(void) {}
+void tearDown(void) {}
+
+// Lives in Readings, which is saved to SD and copied whole by roomsLock
+static_assert(std::is_trivially_copyable<RingHistory<float, 6>>::value, "safe to memcpy and save");
+
+// --- fill / wrap ---
+void test_starts_empty() {
+    RingHistory<float, 4> h;
+    TEST_ASSERT_TRUE(h.empty());
+    TEST_ASSERT_FALSE(h.full());
+    TEST_ASSERT_EQUAL(0, h.size());
+    TEST_ASSERT_EQUAL(4, h.capacity());
+}
+void test_partial_mean() {
+    RingHistory<float, 4> h;
+    h.push(1.0f);
+    h.push(2.0f);
+    h.push(6.0f);
+    TEST_ASSERT_EQUAL(3, h.size());
+    TEST_ASSERT_FALSE(h.full());
+    TEST_ASSERT_EQUAL_FLOAT(9.0f, h.total());
+    TEST_ASSERT_EQUAL_FLOAT(3.0f, h.mean());
+}
+void test_wrap_drops_oldest() {
+    RingHistory<float, 3> h;
+    for (int i = 1; i <= 5; i++) {
+        h.push((float)i);
+    }
+    TEST_ASSERT_TRUE(h.full());
+    TEST_ASSERT_EQUAL(3, h.size());
+    TEST_ASSERT_EQUAL_FLOAT(12.0f, h.total()); // 3 + 4 + 5
+    TEST_ASSERT_EQUAL_FLOAT(4.0f, h.mean());
+}
+void test_clear() {
+    RingHistory<float, 3> h;
+    h.push(7.0f);
+    h.push(8.0f);
+    h.clear();
+    TEST_ASSERT_TRUE(h.empty());
+    h.push(2.0f);
+    TEST_ASSERT_EQUAL_FLOAT(2.0f, h.mean());
+}
+void test_at_oldest_first() {
+    RingHistory<int, 3> h;
+    h.push(1);
+    h.push(2);
+    TEST_ASSERT_EQUAL(1, h.at(0));
+    TEST_ASSERT_EQUAL(2, h.at(1));
+    h.push(3);
+    h.push(4); // Wraps over 1
+    TEST_ASSERT_EQUAL(2, h.at(0));
+    TEST_ASSERT_EQUAL(3, h.at(1));
+    TEST_ASSERT_EQUAL(4, h.at(2));
+}
+
+// --- min / max ---
+void test_min_max_partial() {
+    RingHistory<float, 5> h;
+    h.push(21.5f);
+    h.push(19.0f);
+    h.push(22.0f);
+    TEST_ASSERT_EQUAL_FLOAT(19.0f, h.min());
+    TEST_ASSERT_EQUAL_FLOAT(22.0f, h.max());
+}
+void test_min_max_after_wrap() {
+    RingHistory<int, 3> h;
+    h.push(-4); // Pushed out below
+    h.push(10);
+    h.push(3);
+    h.push(5);
+    TEST_ASSERT_EQUAL(3, h.min());
+    TEST_ASSERT_EQUAL(10, h.max());
+    h.push(4);
+    TEST_ASSERT_EQUAL(3, h.min());
+    TEST_ASSERT_EQUAL(5, h.max());
+}
+
+// --- matches the shift-based history it replaced ---
+void test_matches_shift_mean() {
+    const int N = 6;
+    float shifted[N];
+    int count = 0;
+    RingHistory<float, N> h;
+    for (int i = 0; i < 50; i++) {
+        float value = 18.0f + (float)((i * 7) % 11) * 0.5f;
+        if (count > 0) {
+            float total = 0.0f;
+            for (int j = 0; j < count; j++) {
+                total += shifted[j];
+            }
+            TEST_ASSERT_TRUE(fabsf(total / count - h.mean()) < 1e-4f);
+        }
+        if (count == N) {
+            count--;
+            for (int j = 0; j < N - 1; j++) {
+                shifted[j] = shifted[j + 1];
+            }
+        }
+        shifted[count++] = value;
+        h.push(value);
+    }
+}
+void test_running_sum_stays_exact() {
+    // Many wraps of values that don't sum exactly in float; resumming on wrap
+    // keeps the running total from drifting away from the window's real sum
+    RingHistory<float, 4> h;
+    for (int i = 0; i < 100001; i++) {
+        h.push(i % 2 ? 1000.1f : 0.3f);
+    }
+    float exact = 1000.1f + 0.3f + 1000.1f + 0.3f;
+    TEST_ASSERT_TRUE(fabsf(h.total() - exact) < 1e-3f);
+}
+
+int main() {
+    UNITY_BEGIN();
+
+    RUN_TEST(test_starts_empty);
+    RUN_TEST(test_partial_mean);
+    RUN_TEST(test_wrap_drops_oldest);
+    RUN_TEST(test_clear);
+    RUN_TEST(test_at_oldest_first);
+
+    RUN_TEST(test_min_max_partial);
+    RUN_TEST(test_min_max_after_wrap);
+
+    RUN_TEST(test_matches_shift_mean);
+    RUN_TEST(test_running_sum_stays_exact);
+
+    return UNITY_END();
+}
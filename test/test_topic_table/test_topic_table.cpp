@@ -0,0 +1,84 @@
+#include <unity.h>
+#include "TopicTable.h"
+
+void setUp(void) {}
+void tearDown(void) {}
+
+static constexpr ReadingInfo liveReadings[]{READING_INFO_ARRAY};
+static constexpr TopicEntry noOthers[]{{"klaussometer/test", TopicRoute::INSIDE_CO2, 0}};
+
+// Two topics that can't be told apart never make a table
+static constexpr TopicEntry duplicated[]{
+    {"kitchen/co2/set", TopicRoute::INSIDE_CO2, 0},
+    {"kitchen/co2/set", TopicRoute::INSIDE_PM1, 0},
+};
+static_assert(!TopicTable<2>(duplicated).valid(), "duplicate topics are rejected");
+
+// Sizing keeps slots at most half full
+static_assert(TopicTable<19>::SLOTS == 64, "19 topics in 64 slots");
+static_assert(TopicTable<1>::SLOTS == 2 && TopicTable<1>::BUCKETS == 1, "single topic");
+
+// --- live topics ---
+void test_every_reading_topic_found() {
+    for (int i = 0; i < READING_COUNT; i++) {
+        const TopicEntry* entry = findTopic(liveReadings[i].topic);
+        TEST_ASSERT_TRUE(entry != nullptr);
+        TEST_ASSERT_TRUE(entry->route == TopicRoute::READING);
+        TEST_ASSERT_EQUAL(i, entry->index);
+    }
+}
+void test_inside_topics_routed() {
+    TEST_ASSERT_TRUE(findTopic(MQTT_INSIDE_CO2_TOPIC)->route == TopicRoute::INSIDE_CO2);
+    TEST_ASSERT_TRUE(findTopic(MQTT_INSIDE_PM1_TOPIC)->route == TopicRoute::INSIDE_PM1);
+    TEST_ASSERT_TRUE(findTopic(MQTT_INSIDE_PM25_TOPIC)->route == TopicRoute::INSIDE_PM25);
+    TEST_ASSERT_TRUE(findTopic(MQTT_INSIDE_PM10_TOPIC)->route == TopicRoute::INSIDE_PM10);
+}
+void test_unknown_topics_miss() {
+    TEST_ASSERT_TRUE(findTopic("") == nullptr);
+    TEST_ASSERT_TRUE(findTopic("klaussometer/log") == nullptr);
+    TEST_ASSERT_TRUE(findTopic("kitchen/co2/se") == nullptr);     // Prefix of a topic
+    TEST_ASSERT_TRUE(findTopic("kitchen/co2/set/x") == nullptr);  // Topic plus more
+    TEST_ASSERT_TRUE(findTopic("Kitchen/co2/set") == nullptr);    // Case matters
+}
+
+// --- building ---
+void test_make_topic_table_appends_others() {
+    static constexpr auto table = makeTopicTable(liveReadings, noOthers);
+    static_assert(table.valid(), "live readings plus one more");
+    const TopicEntry* entry = table.find("klaussometer/test");
+    TEST_ASSERT_TRUE(entry != nullptr);
+    TEST_ASSERT_TRUE(entry->route == TopicRoute::INSIDE_CO2);
+    TEST_ASSERT_TRUE(table.find(MQTT_INSIDE_CO2_TOPIC) == nullptr);
+    TEST_ASSERT_EQUAL(2, table.find("guest/tempset-ambient/set")->index);
+}
+void test_many_topics() {
+    // Built at runtime here (same code as the compile-time path) with 500
+    // generated topics, to show the displacement search copes with hundreds
+    static char names[500][24];
+    static TopicEntry entries[500];
+    for (int i = 0; i < 500; i++) {
+        snprintf(names[i], sizeof(names[i]), "room%d/sensor/set", i);
+        entries[i] = {names[i], TopicRoute::READING, (uint16_t)i};
+    }
+    static TopicTable<500> table(entries);
+    TEST_ASSERT_TRUE(table.valid());
+    for (int i = 0; i < 500; i++) {
+        const TopicEntry* entry = table.find(names[i]);
+        TEST_ASSERT_TRUE(entry != nullptr);
+        TEST_ASSERT_EQUAL(i, entry->index);
+    }
+    TEST_ASSERT_TRUE(table.find("room500/sensor/set") == nullptr);
+}
+
+int main() {
+    UNITY_BEGIN();
+
+    RUN_TEST(test_every_reading_topic_found);
+    RUN_TEST(test_inside_topics_routed);
+    RUN_TEST(test_unknown_topics_miss);
+
+    RUN_TEST(test_make_topic_table_appends_others);
+    RUN_TEST(test_many_topics);
+
+    return UNITY_END();
+}
@@ -4,12 +4,12 @@
 void setUp(void) {}
 void tearDown(void) {}
 
-// --- uv_color ---
-void test_uv_below_1()      { TEST_ASSERT_EQUAL_HEX(0x658D1B, uv_color(0.0f)); }
-void test_uv_boundary_1()   { TEST_ASSERT_EQUAL_HEX(0x84BD00, uv_color(1.0f)); }
-void test_uv_boundary_5()   { TEST_ASSERT_EQUAL_HEX(0xFFCD00, uv_color(5.0f)); }
-void test_uv_extreme()      { TEST_ASSERT_EQUAL_HEX(0x4B1E88, uv_color(11.0f)); }
-void test_uv_very_high()    { TEST_ASSERT_EQUAL_HEX(0x4B1E88, uv_color(15.0f)); }
+// --- uvColor ---
+void test_uv_below_1()      { TEST_ASSERT_EQUAL_HEX(0x658D1B, uvColor(0.0f)); }
+void test_uv_boundary_1()   { TEST_ASSERT_EQUAL_HEX(0x84BD00, uvColor(1.0f)); }
+void test_uv_boundary_5()   { TEST_ASSERT_EQUAL_HEX(0xFFCD00, uvColor(5.0f)); }
+void test_uv_extreme()      { TEST_ASSERT_EQUAL_HEX(0x4B1E88, uvColor(11.0f)); }
+void test_uv_very_high()    { TEST_ASSERT_EQUAL_HEX(0x4B1E88, uvColor(15.0f)); }
 
 // --- degreesToDirection ---
 void test_dir_north()       { TEST_ASSERT_EQUAL_STRING("N",  degreesToDirection(0.0)); }
@@ -51,30 +51,41 @@ void test_csum_self_cancels() {
     TEST_ASSERT_EQUAL_HEX(0x00, calculateChecksum(d, 2));
 }
 
-// --- format_integer_with_commas ---
+// --- topicHash ---
+void test_hash_empty()      { TEST_ASSERT_EQUAL_HEX32(0x811C9DC5, topicHash("")); }
+void test_hash_known()      { TEST_ASSERT_EQUAL_HEX32(0xE40C292C, topicHash("a")); }
+void test_hash_differs()    { TEST_ASSERT_NOT_EQUAL(topicHash("cave/battery/set"), topicHash("guest/battery/set")); }
+
+// --- backlightDuty (Matouch, active-low) ---
+void test_duty_full_is_zero() { TEST_ASSERT_EQUAL(0,    backlightDuty(1.0f, 1023)); }
+void test_duty_off_is_max()   { TEST_ASSERT_EQUAL(1023, backlightDuty(0.0f, 1023)); }
+void test_duty_dim()          { TEST_ASSERT_EQUAL(920,  backlightDuty(0.1f, 1023)); }
+void test_duty_clamped()      { TEST_ASSERT_EQUAL(1023, backlightDuty(-0.5f, 1023)); }
+
+// --- formatIntegerWithCommas ---
 void test_fmt_zero() {
     char buf[32];
-    format_integer_with_commas(0, buf, sizeof(buf));
+    formatIntegerWithCommas(0, buf, sizeof(buf));
     TEST_ASSERT_EQUAL_STRING("0", buf);
 }
 void test_fmt_small() {
     char buf[32];
-    format_integer_with_commas(999, buf, sizeof(buf));
+    formatIntegerWithCommas(999, buf, sizeof(buf));
     TEST_ASSERT_EQUAL_STRING("999", buf);
 }
 void test_fmt_thousands() {
     char buf[32];
-    format_integer_with_commas(1000, buf, sizeof(buf));
+    formatIntegerWithCommas(1000, buf, sizeof(buf));
     TEST_ASSERT_EQUAL_STRING("1,000", buf);
 }
 void test_fmt_millions() {
     char buf[32];
-    format_integer_with_commas(1234567, buf, sizeof(buf));
+    formatIntegerWithCommas(1234567, buf, sizeof(buf));
     TEST_ASSERT_EQUAL_STRING("1,234,567", buf);
 }
 void test_fmt_negative() {
     char buf[32];
-    format_integer_with_commas(-1000, buf, sizeof(buf));
+    formatIntegerWithCommas(-1000, buf, sizeof(buf));
     TEST_ASSERT_EQUAL_STRING("-1,000", buf);
 }
 
@@ -112,6 +123,15 @@ int main() {
     RUN_TEST(test_csum_xor);
     RUN_TEST(test_csum_self_cancels);
 
+    RUN_TEST(test_hash_empty);
+    RUN_TEST(test_hash_known);
+    RUN_TEST(test_hash_differs);
+
+    RUN_TEST(test_duty_full_is_zero);
+    RUN_TEST(test_duty_off_is_max);
+    RUN_TEST(test_duty_dim);
+    RUN_TEST(test_duty_clamped);
+
     RUN_TEST(test_fmt_zero);
     RUN_TEST(test_fmt_small);
     RUN_TEST(test_fmt_thousands);